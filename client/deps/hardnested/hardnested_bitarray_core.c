@@ -158,6 +158,128 @@ typedef uint32_t count_bitarray_AND4_t(uint32_t *, uint32_t *, uint32_t *, uint3
 count_bitarray_AND4_t count_bitarray_AND4_AVX512, count_bitarray_AND4_AVX2, count_bitarray_AND4_AVX, count_bitarray_AND4_SSE2, count_bitarray_AND4_MMX, count_bitarray_AND4_NOSIMD, count_bitarray_AND4_NEON, count_bitarray_AND4_dispatch;
 
 
+#if defined (__AVX512F__)
+// Explicit AVX-512 kernels. The compiler doesn't vectorize the popcounts on its own,
+// so they are done either with VPOPCNTDQ (if the CPU has it, checked at runtime)
+// or with a SWAR popcount on 64bit lanes (plain AVX512F has no byte shuffle).
+#include <immintrin.h>
+
+#define AVX512_BITARRAY_WORDS   (1 << 19)
+#define AVX512_WORDS_PER_VEC    16
+
+static int avx512_has_vpopcntdq = -1;
+
+static inline int avx512_use_vpopcntdq(void) {
+    int has = __atomic_load_n(&avx512_has_vpopcntdq, __ATOMIC_RELAXED);
+    if (has < 0) {
+        __builtin_cpu_init();
+        has = __builtin_cpu_supports("avx512vpopcntdq") ? 1 : 0;
+        __atomic_store_n(&avx512_has_vpopcntdq, has, __ATOMIC_RELAXED);
+    }
+    return has;
+}
+
+// GCC's unmasked shift and reduce intrinsics start from _mm512_undefined_*(), which
+// trips -Wuninitialized -Winit-self. Use the zero masked shift and sum by hand.
+#define AVX512_SRLI64(v, n) _mm512_maskz_srli_epi64((__mmask8)0xff, (v), (n))
+
+static inline uint32_t avx512_sum_epi64(__m512i v) {
+    uint64_t lanes[8] __attribute__((aligned(64)));
+    _mm512_store_si512((void *)lanes, v);
+    return lanes[0] + lanes[1] + lanes[2] + lanes[3] + lanes[4] + lanes[5] + lanes[6] + lanes[7];
+}
+
+static inline __m512i avx512_popcnt_swar(__m512i v) {
+    const __m512i m1 = _mm512_set1_epi64(0x5555555555555555ULL);
+    const __m512i m2 = _mm512_set1_epi64(0x3333333333333333ULL);
+    const __m512i m4 = _mm512_set1_epi64(0x0f0f0f0f0f0f0f0fULL);
+    v = _mm512_sub_epi64(v, _mm512_and_si512(AVX512_SRLI64(v, 1), m1));
+    v = _mm512_add_epi64(_mm512_and_si512(v, m2), _mm512_and_si512(AVX512_SRLI64(v, 2), m2));
+    v = _mm512_and_si512(_mm512_add_epi64(v, AVX512_SRLI64(v, 4)), m4);
+    v = _mm512_add_epi64(v, AVX512_SRLI64(v, 8));
+    v = _mm512_add_epi64(v, AVX512_SRLI64(v, 16));
+    v = _mm512_add_epi64(v, AVX512_SRLI64(v, 32));
+    return _mm512_and_si512(v, _mm512_set1_epi64(0x7f));
+}
+
+// keep 16bit halves of a where the matching half of b is non zero
+static inline __m512i avx512_low20_mask(__m512i a, __m512i b) {
+    const __m512i lo = _mm512_set1_epi32(0x0000ffff);
+    const __m512i hi = _mm512_set1_epi32(0xffff0000);
+    __m512i keep = _mm512_or_si512(_mm512_maskz_mov_epi32(_mm512_test_epi32_mask(b, lo), lo),
+                                   _mm512_maskz_mov_epi32(_mm512_test_epi32_mask(b, hi), hi));
+    return _mm512_and_si512(a, keep);
+}
+
+// defines a VPOPCNTDQ and a SWAR variant of a counting kernel plus the runtime switch between them.
+// BODY computes __m512i v for words i .. i+15 and may store results back.
+#define AVX512_COUNT_KERNEL(name, params, args, BODY)                                       \
+    __attribute__((target("avx512f,avx512vpopcntdq")))                                      \
+    static uint32_t name##_vpopcntdq params {                                                \
+        __m512i acc = _mm512_setzero_si512();                                                 \
+        for (uint32_t i = 0; i < AVX512_BITARRAY_WORDS; i += AVX512_WORDS_PER_VEC) {           \
+            __m512i v; BODY                                                                   \
+            acc = _mm512_add_epi64(acc, _mm512_popcnt_epi64(v));                              \
+        }                                                                                     \
+        return avx512_sum_epi64(acc);                                                         \
+    }                                                                                         \
+    static uint32_t name##_swar params {                                                      \
+        __m512i acc = _mm512_setzero_si512();                                                 \
+        for (uint32_t i = 0; i < AVX512_BITARRAY_WORDS; i += AVX512_WORDS_PER_VEC) {           \
+            __m512i v; BODY                                                                   \
+            acc = _mm512_add_epi64(acc, avx512_popcnt_swar(v));                               \
+        }                                                                                     \
+        return avx512_sum_epi64(acc);                                                         \
+    }                                                                                         \
+    static inline uint32_t name params {                                                      \
+        return avx512_use_vpopcntdq() ? name##_vpopcntdq args : name##_swar args;            \
+    }
+
+#define LD(X) _mm512_loadu_si512((const void *)((X) + i))
+#define ST(X, V) _mm512_storeu_si512((void *)((X) + i), (V))
+
+AVX512_COUNT_KERNEL(avx512_count_states, (uint32_t *A), (A),
+                    v = LD(A);)
+AVX512_COUNT_KERNEL(avx512_count_bitarray_AND, (uint32_t *A, uint32_t *B), (A, B),
+                    v = _mm512_and_si512(LD(A), LD(B)); ST(A, v);)
+AVX512_COUNT_KERNEL(avx512_count_bitarray_low20_AND, (uint32_t *A, uint32_t *B), (A, B),
+                    v = avx512_low20_mask(LD(A), LD(B)); ST(A, v);)
+AVX512_COUNT_KERNEL(avx512_count_bitarray_AND2, (uint32_t *A, uint32_t *B), (A, B),
+                    v = _mm512_and_si512(LD(A), LD(B));)
+AVX512_COUNT_KERNEL(avx512_count_bitarray_AND3, (uint32_t *A, uint32_t *B, uint32_t *C), (A, B, C),
+                    v = _mm512_and_si512(_mm512_and_si512(LD(A), LD(B)), LD(C));)
+AVX512_COUNT_KERNEL(avx512_count_bitarray_AND4, (uint32_t *A, uint32_t *B, uint32_t *C, uint32_t *D), (A, B, C, D),
+                    v = _mm512_and_si512(_mm512_and_si512(LD(A), LD(B)), _mm512_and_si512(LD(C), LD(D)));)
+
+static inline void avx512_bitarray_AND(uint32_t *A, uint32_t *B) {
+    for (uint32_t i = 0; i < AVX512_BITARRAY_WORDS; i += AVX512_WORDS_PER_VEC) {
+        ST(A, _mm512_and_si512(LD(A), LD(B)));
+    }
+}
+
+static inline void avx512_bitarray_low20_AND(uint32_t *A, uint32_t *B) {
+    for (uint32_t i = 0; i < AVX512_BITARRAY_WORDS; i += AVX512_WORDS_PER_VEC) {
+        ST(A, avx512_low20_mask(LD(A), LD(B)));
+    }
+}
+
+static inline void avx512_bitarray_AND4(uint32_t *A, uint32_t *B, uint32_t *C, uint32_t *D) {
+    for (uint32_t i = 0; i < AVX512_BITARRAY_WORDS; i += AVX512_WORDS_PER_VEC) {
+        ST(A, _mm512_and_si512(_mm512_and_si512(LD(B), LD(C)), LD(D)));
+    }
+}
+
+static inline void avx512_bitarray_OR(uint32_t *A, uint32_t *B) {
+    for (uint32_t i = 0; i < AVX512_BITARRAY_WORDS; i += AVX512_WORDS_PER_VEC) {
+        ST(A, _mm512_or_si512(LD(A), LD(B)));
+    }
+}
+
+#undef LD
+#undef ST
+#endif
+
+
 inline uint32_t *MALLOC_BITARRAY(uint32_t x) {
 #if defined (_WIN32)
     return __builtin_assume_aligned(_aligned_malloc((x), __BIGGEST_ALIGNMENT__), __BIGGEST_ALIGNMENT__);
@@ -189,24 +311,35 @@ inline uint32_t BITCOUNT(uint32_t a) {
 
 
 inline uint32_t COUNT_STATES(uint32_t *A) {
+#if defined (__AVX512F__)
+    return avx512_count_states(A);
+#else
     uint32_t count = 0;
     for (uint32_t i = 0; i < (1 << 19); i++) {
         count += BITCOUNT(A[i]);
     }
     return count;
+#endif
 }
 
 
 inline void BITARRAY_AND(uint32_t *restrict A, uint32_t *restrict B) {
+#if defined (__AVX512F__)
+    avx512_bitarray_AND(A, B);
+#else
     A = __builtin_assume_aligned(A, __BIGGEST_ALIGNMENT__);
     B = __builtin_assume_aligned(B, __BIGGEST_ALIGNMENT__);
     for (uint32_t i = 0; i < (1 << 19); i++) {
         A[i] &= B[i];
     }
+#endif
 }
 
 
 inline void BITARRAY_LOW20_AND(uint32_t *restrict A, uint32_t *restrict B) {
+#if defined (__AVX512F__)
+    avx512_bitarray_low20_AND(A, B);
+#else
     uint16_t *a = (uint16_t *)__builtin_assume_aligned(A, __BIGGEST_ALIGNMENT__);
     uint16_t *b = (uint16_t *)__builtin_assume_aligned(B, __BIGGEST_ALIGNMENT__);
 
@@ -215,10 +348,14 @@ inline void BITARRAY_LOW20_AND(uint32_t *restrict A, uint32_t *restrict B) {
             a[i] = 0;
         }
     }
+#endif
 }
 
 
 inline uint32_t COUNT_BITARRAY_AND(uint32_t *restrict A, uint32_t *restrict B) {
+#if defined (__AVX512F__)
+    return avx512_count_bitarray_AND(A, B);
+#else
     A = __builtin_assume_aligned(A, __BIGGEST_ALIGNMENT__);
     B = __builtin_assume_aligned(B, __BIGGEST_ALIGNMENT__);
     uint32_t count = 0;
@@ -227,10 +364,14 @@ inline uint32_t COUNT_BITARRAY_AND(uint32_t *restrict A, uint32_t *restrict B) {
         count += BITCOUNT(A[i]);
     }
     return count;
+#endif
 }
 
 
 inline uint32_t COUNT_BITARRAY_LOW20_AND(uint32_t *restrict A, uint32_t *restrict B) {
+#if defined (__AVX512F__)
+    return avx512_count_bitarray_low20_AND(A, B);
+#else
     uint16_t *a = (uint16_t *)__builtin_assume_aligned(A, __BIGGEST_ALIGNMENT__);
     uint16_t *b = (uint16_t *)__builtin_assume_aligned(B, __BIGGEST_ALIGNMENT__);
     uint32_t count = 0;
@@ -242,10 +383,14 @@ inline uint32_t COUNT_BITARRAY_LOW20_AND(uint32_t *restrict A, uint32_t *restric
         count += BITCOUNT(a[i]);
     }
     return count;
+#endif
 }
 
 
 inline void BITARRAY_AND4(uint32_t *restrict A, uint32_t *restrict B, uint32_t *restrict C, uint32_t *restrict D) {
+#if defined (__AVX512F__)
+    avx512_bitarray_AND4(A, B, C, D);
+#else
     A = __builtin_assume_aligned(A, __BIGGEST_ALIGNMENT__);
     B = __builtin_assume_aligned(B, __BIGGEST_ALIGNMENT__);
     C = __builtin_assume_aligned(C, __BIGGEST_ALIGNMENT__);
@@ -253,19 +398,27 @@ inline void BITARRAY_AND4(uint32_t *restrict A, uint32_t *restrict B, uint32_t *
     for (uint32_t i = 0; i < (1 << 19); i++) {
         A[i] = B[i] & C[i] & D[i];
     }
+#endif
 }
 
 
 inline void BITARRAY_OR(uint32_t *restrict A, uint32_t *restrict B) {
+#if defined (__AVX512F__)
+    avx512_bitarray_OR(A, B);
+#else
     A = __builtin_assume_aligned(A, __BIGGEST_ALIGNMENT__);
     B = __builtin_assume_aligned(B, __BIGGEST_ALIGNMENT__);
     for (uint32_t i = 0; i < (1 << 19); i++) {
         A[i] |= B[i];
     }
+#endif
 }
 
 
 inline uint32_t COUNT_BITARRAY_AND2(uint32_t *restrict A, uint32_t *restrict B) {
+#if defined (__AVX512F__)
+    return avx512_count_bitarray_AND2(A, B);
+#else
     A = __builtin_assume_aligned(A, __BIGGEST_ALIGNMENT__);
     B = __builtin_assume_aligned(B, __BIGGEST_ALIGNMENT__);
     uint32_t count = 0;
@@ -273,10 +426,14 @@ inline uint32_t COUNT_BITARRAY_AND2(uint32_t *restrict A, uint32_t *restrict B)
         count += BITCOUNT(A[i] & B[i]);
     }
     return count;
+#endif
 }
 
 
 inline uint32_t COUNT_BITARRAY_AND3(uint32_t *restrict A, uint32_t *restrict B, uint32_t *restrict C) {
+#if defined (__AVX512F__)
+    return avx512_count_bitarray_AND3(A, B, C);
+#else
     A = __builtin_assume_aligned(A, __BIGGEST_ALIGNMENT__);
     B = __builtin_assume_aligned(B, __BIGGEST_ALIGNMENT__);
     C = __builtin_assume_aligned(C, __BIGGEST_ALIGNMENT__);
@@ -285,10 +442,14 @@ inline uint32_t COUNT_BITARRAY_AND3(uint32_t *restrict A, uint32_t *restrict B,
         count += BITCOUNT(A[i] & B[i] & C[i]);
     }
     return count;
+#endif
 }
 
 
 inline uint32_t COUNT_BITARRAY_AND4(uint32_t *restrict A, uint32_t *restrict B, uint32_t *restrict C, uint32_t *restrict D) {
+#if defined (__AVX512F__)
+    return avx512_count_bitarray_AND4(A, B, C, D);
+#else
     A = __builtin_assume_aligned(A, __BIGGEST_ALIGNMENT__);
     B = __builtin_assume_aligned(B, __BIGGEST_ALIGNMENT__);
     C = __builtin_assume_aligned(C, __BIGGEST_ALIGNMENT__);
@@ -298,6 +459,7 @@ inline uint32_t COUNT_BITARRAY_AND4(uint32_t *restrict A, uint32_t *restrict B,
         count += BITCOUNT(A[i] & B[i] & C[i] & D[i]);
     }
     return count;
+#endif
 }
 
 
@@ -72,6 +72,10 @@ THE SOFTWARE.
 #define DEFAULT_BRUTE_FORCE_RATE        (120000000.0) // if benchmark doesn't succeed
 #define TEST_BENCH_SIZE                 (6000)        // number of odd and even states for brute force benchmark
 #define TEST_BENCH_FILENAME             "hardnested_bf_bench_data.bin"
+#define BF_CHUNK_KEYS                   (1ULL << 26)  // target number of keys per brute force work chunk
+#define BF_CHUNK_MIN_ODD_STATES         (64)          // keeps re-bitslicing the even states per chunk cheap
+#define BF_MAX_CHUNKS                   (1 << 16)
+#define BF_CHECKPOINT_INTERVAL          (60000)       // ms between brute force checkpoints
 //#define WRITE_BENCH_FILE
 
 // debugging options
@@ -87,12 +91,43 @@ static uint32_t nonces_to_bruteforce = 0;
 static uint32_t bf_test_nonce[256];
 static uint8_t bf_test_nonce_2nd_byte[256];
 static uint8_t bf_test_nonce_par[256];
-static uint32_t bucket_count = 0;
-static statelist_t *buckets[128];
 static uint32_t keys_found = 0;
 static uint64_t num_keys_tested;
 static uint64_t found_bs_key = 0;
 
+// A brute force work chunk is a range of odd states of one candidate bucket,
+// tested against all even states of that bucket.
+typedef struct {
+    statelist_t *bucket;
+    uint32_t odd_start;
+    uint32_t odd_len;
+} bf_chunk_t;
+
+// Every thread owns a contiguous range of chunks. When its own range is
+// exhausted it steals chunks from the range with the most work left.
+typedef struct {
+    uint32_t next;
+    uint32_t end;
+} bf_chunk_range_t;
+
+static bf_chunk_t *bf_chunks = NULL;
+static uint8_t *bf_chunk_done = NULL;
+static uint32_t bf_num_chunks = 0;
+static bf_chunk_range_t *bf_chunk_ranges = NULL;
+static uint64_t *bf_thread_keys_tested = NULL;
+
+static bf_checkpoint_t *bf_checkpoint = NULL;
+static const uint8_t *bf_resume_chunk_done = NULL;
+static uint32_t bf_resume_num_chunks = 0;
+static uint64_t bf_last_checkpoint = 0;
+static pthread_mutex_t bf_checkpoint_lock = PTHREAD_MUTEX_INITIALIZER;
+
+void set_brute_force_checkpoint(bf_checkpoint_t *checkpoint, const uint8_t *resume_chunk_done, uint32_t resume_num_chunks) {
+    bf_checkpoint = checkpoint;
+    bf_resume_chunk_done = resume_chunk_done;
+    bf_resume_num_chunks = resume_num_chunks;
+}
+
 inline uint8_t trailing_zeros(uint8_t byte) {
     static const uint8_t trailing_zeros_LUT[256] = {
         8, 0, 1, 0, 2, 0, 1, 0, 3, 0, 1, 0, 2, 0, 1, 0,
@@ -140,6 +175,43 @@ bool verify_key(uint32_t cuid, noncelist_t *nonces, const uint8_t *best_first_by
     }
     return true;
 }
+static bool claim_chunk(uint32_t range_idx, uint32_t *chunk_idx) {
+    bf_chunk_range_t *range = &bf_chunk_ranges[range_idx];
+    if (__atomic_load_n(&range->next, __ATOMIC_RELAXED) >= range->end) {
+        return false;
+    }
+    uint32_t idx = __atomic_fetch_add(&range->next, 1, __ATOMIC_SEQ_CST);
+    if (idx >= range->end) {
+        return false;
+    }
+    *chunk_idx = idx;
+    return true;
+}
+
+static bool next_chunk(uint32_t thread_id, uint32_t num_threads, uint32_t *chunk_idx) {
+    if (claim_chunk(thread_id, chunk_idx)) {
+        return true;
+    }
+    // own range exhausted, steal from the fullest range
+    while (true) {
+        uint32_t victim = num_threads;
+        uint32_t most_left = 0;
+        for (uint32_t i = 0; i < num_threads; i++) {
+            uint32_t next = __atomic_load_n(&bf_chunk_ranges[i].next, __ATOMIC_RELAXED);
+            if (next < bf_chunk_ranges[i].end && bf_chunk_ranges[i].end - next > most_left) {
+                most_left = bf_chunk_ranges[i].end - next;
+                victim = i;
+            }
+        }
+        if (victim == num_threads) {
+            return false;
+        }
+        if (claim_chunk(victim, chunk_idx)) {
+            return true;
+        }
+    }
+}
+
 static void *
 #ifdef __has_attribute
 #if __has_attribute(force_align_arg_pointer)
@@ -150,45 +222,67 @@ crack_states_thread(void *x) {
     struct arg {
         bool silent;
         int thread_ID;
+        uint32_t num_threads;
         uint32_t cuid;
         uint32_t num_acquired_nonces;
         uint64_t maximum_states;
+        uint64_t start_time;
         noncelist_t *nonces;
         uint8_t *best_first_bytes;
     } *thread_arg;
 
     thread_arg = (struct arg *)x;
     const int thread_id = thread_arg->thread_ID;
-    uint32_t current_bucket = thread_id;
-    while (current_bucket < bucket_count) {
-        statelist_t *bucket = buckets[current_bucket];
-        if (bucket) {
+    uint32_t chunk_idx;
+    while (keys_found == 0 && next_chunk(thread_id, thread_arg->num_threads, &chunk_idx)) {
+        if (bf_chunk_done[chunk_idx]) {
+            continue; // already tested in a previous run
+        }
+        bf_chunk_t *chunk = &bf_chunks[chunk_idx];
+        statelist_t chunk_states = *chunk->bucket;
+        chunk_states.states[ODD_STATE] += chunk->odd_start;
+        chunk_states.len[ODD_STATE] = chunk->odd_len;
+        chunk_states.next = NULL;
 #if defined (DEBUG_BRUTE_FORCE)
-            PrintAndLogEx(INFO, "Thread " _YELLOW_("%u") " starts working on bucket " _YELLOW_("%u") "\n", thread_id, current_bucket);
+        PrintAndLogEx(INFO, "Thread " _YELLOW_("%u") " starts working on chunk " _YELLOW_("%u") "\n", thread_id, chunk_idx);
 #endif
-            const uint64_t key = crack_states_bitsliced(thread_arg->cuid, thread_arg->best_first_bytes, bucket, &keys_found, &num_keys_tested, nonces_to_bruteforce, bf_test_nonce_2nd_byte, thread_arg->nonces);
-            if (key != -1) {
-                __atomic_fetch_add(&keys_found, 1, __ATOMIC_SEQ_CST);
-                __atomic_fetch_add(&found_bs_key, key, __ATOMIC_SEQ_CST);
-
-                char progress_text[80];
-                char keystr[19];
-                snprintf(keystr, sizeof(keystr), "%012" PRIX64 "  ", key);
-                snprintf(progress_text, sizeof(progress_text), "Brute force phase completed.  Key found: " _GREEN_("%s"), keystr);
-                hardnested_print_progress(thread_arg->num_acquired_nonces, progress_text, 0.0, 0);
-                break;
-            } else if (keys_found) {
-                break;
-            } else {
-                if (!thread_arg->silent) {
-                    char progress_text[80];
-                    snprintf(progress_text, sizeof(progress_text), "Brute force phase: %6.02f%%\t", 100.0 * (float)num_keys_tested / (float)(thread_arg->maximum_states));
-                    float remaining_bruteforce = thread_arg->nonces[thread_arg->best_first_bytes[0]].expected_num_brute_force - (float)num_keys_tested / 2;
-                    hardnested_print_progress(thread_arg->num_acquired_nonces, progress_text, remaining_bruteforce, 5000);
+        uint64_t chunk_keys_tested = 0;
+        const uint64_t key = crack_states_bitsliced(thread_arg->cuid, thread_arg->best_first_bytes, &chunk_states, &keys_found, &chunk_keys_tested, nonces_to_bruteforce, bf_test_nonce_2nd_byte, thread_arg->nonces);
+        __atomic_fetch_add(&num_keys_tested, chunk_keys_tested, __ATOMIC_SEQ_CST);
+        __atomic_fetch_add(&bf_thread_keys_tested[thread_id], chunk_keys_tested, __ATOMIC_SEQ_CST);
+        if (key != -1) {
+            __atomic_fetch_add(&keys_found, 1, __ATOMIC_SEQ_CST);
+            __atomic_fetch_add(&found_bs_key, key, __ATOMIC_SEQ_CST);
+
+            char progress_text[80];
+            char keystr[19];
+            snprintf(keystr, sizeof(keystr), "%012" PRIX64 "  ", key);
+            snprintf(progress_text, sizeof(progress_text), "Brute force phase completed.  Key found: " _GREEN_("%s"), keystr);
+            hardnested_print_progress(thread_arg->num_acquired_nonces, progress_text, 0.0, 0);
+            break;
+        } else if (keys_found) {
+            break;
+        } else {
+            bf_chunk_done[chunk_idx] = 1;
+            if (bf_checkpoint != NULL && msclock() - bf_last_checkpoint > BF_CHECKPOINT_INTERVAL && pthread_mutex_trylock(&bf_checkpoint_lock) == 0) {
+                bf_last_checkpoint = msclock();
+                bf_checkpoint(bf_chunk_done, bf_num_chunks);
+                pthread_mutex_unlock(&bf_checkpoint_lock);
+            }
+            if (!thread_arg->silent) {
+                uint32_t num_threads = thread_arg->num_threads;
+                float thread_rates[num_threads];
+                float elapsed = (float)(msclock() - thread_arg->start_time) / 1000.0;
+                for (uint32_t i = 0; i < num_threads; i++) {
+                    uint64_t tested = __atomic_load_n(&bf_thread_keys_tested[i], __ATOMIC_RELAXED);
+                    thread_rates[i] = elapsed > 0 ? (float)tested / elapsed : 0.0;
                 }
+                char progress_text[80];
+                snprintf(progress_text, sizeof(progress_text), "Brute force phase: %6.02f%%\t", 100.0 * (float)num_keys_tested / (float)(thread_arg->maximum_states));
+                float remaining_bruteforce = thread_arg->nonces[thread_arg->best_first_bytes[0]].expected_num_brute_force - (float)num_keys_tested / 2;
+                hardnested_print_progress_threads(thread_arg->num_acquired_nonces, progress_text, remaining_bruteforce, 5000, num_threads, thread_rates);
             }
         }
-        current_bucket += NUM_BRUTE_FORCE_THREADS;
     }
     return NULL;
 }
@@ -294,6 +388,78 @@ static void write_benchfile(statelist_t *candidates) {
 #endif
 
 
+static void free_chunks(void) {
+    free(bf_chunks);
+    bf_chunks = NULL;
+    free(bf_chunk_done);
+    bf_chunk_done = NULL;
+    free(bf_chunk_ranges);
+    bf_chunk_ranges = NULL;
+    free(bf_thread_keys_tested);
+    bf_thread_keys_tested = NULL;
+    bf_num_chunks = 0;
+}
+
+// Split the candidate buckets into chunks of roughly equal work. The chunk
+// list only depends on the candidates, so chunk indices are stable between runs.
+static bool split_into_chunks(statelist_t *candidates, uint64_t maximum_states, uint32_t num_threads) {
+    free_chunks();
+
+    uint64_t chunk_keys = MAX(BF_CHUNK_KEYS, maximum_states / BF_MAX_CHUNKS);
+
+    uint32_t num_chunks = 0;
+    for (statelist_t *p = candidates; p != NULL; p = p->next) {
+        if (p->states[ODD_STATE] != NULL && p->states[EVEN_STATE] != NULL && p->len[ODD_STATE] != 0 && p->len[EVEN_STATE] != 0) {
+            uint64_t odd_per_chunk = MAX(BF_CHUNK_MIN_ODD_STATES, chunk_keys / p->len[EVEN_STATE]);
+            num_chunks += (p->len[ODD_STATE] + odd_per_chunk - 1) / odd_per_chunk;
+        }
+    }
+
+    bf_chunks = calloc(MAX(num_chunks, 1), sizeof(bf_chunk_t));
+    bf_chunk_done = calloc(MAX(num_chunks, 1), sizeof(uint8_t));
+    bf_chunk_ranges = calloc(num_threads, sizeof(bf_chunk_range_t));
+    bf_thread_keys_tested = calloc(num_threads, sizeof(uint64_t));
+    if (bf_chunks == NULL || bf_chunk_done == NULL || bf_chunk_ranges == NULL || bf_thread_keys_tested == NULL) {
+        free_chunks();
+        return false;
+    }
+
+    for (statelist_t *p = candidates; p != NULL; p = p->next) {
+        if (p->states[ODD_STATE] != NULL && p->states[EVEN_STATE] != NULL && p->len[ODD_STATE] != 0 && p->len[EVEN_STATE] != 0) {
+            uint64_t odd_per_chunk = MAX(BF_CHUNK_MIN_ODD_STATES, chunk_keys / p->len[EVEN_STATE]);
+            for (uint32_t odd_start = 0; odd_start < p->len[ODD_STATE]; odd_start += odd_per_chunk) {
+                bf_chunks[bf_num_chunks].bucket = p;
+                bf_chunks[bf_num_chunks].odd_start = odd_start;
+                bf_chunks[bf_num_chunks].odd_len = MIN(odd_per_chunk, p->len[ODD_STATE] - odd_start);
+                bf_num_chunks++;
+            }
+        }
+    }
+
+    for (uint32_t i = 0; i < num_threads; i++) {
+        bf_chunk_ranges[i].next = (uint64_t)bf_num_chunks * i / num_threads;
+        bf_chunk_ranges[i].end = (uint64_t)bf_num_chunks * (i + 1) / num_threads;
+    }
+
+    // skip the chunks a previous run has completed. Resume data only applies once.
+    if (bf_resume_chunk_done != NULL) {
+        if (bf_resume_num_chunks == bf_num_chunks) {
+            for (uint32_t i = 0; i < bf_num_chunks; i++) {
+                if (bf_resume_chunk_done[i]) {
+                    bf_chunk_done[i] = 1;
+                    num_keys_tested += (uint64_t)bf_chunks[i].odd_len * bf_chunks[i].bucket->len[EVEN_STATE];
+                }
+            }
+        } else {
+            PrintAndLogEx(WARNING, "Checkpoint doesn't match the candidate states, brute force starts over");
+        }
+        bf_resume_chunk_done = NULL;
+        bf_resume_num_chunks = 0;
+    }
+    return true;
+}
+
+
 bool brute_force_bs(float *bf_rate, statelist_t *candidates, uint32_t cuid, uint32_t num_acquired_nonces, uint64_t maximum_states, noncelist_t *nonces, uint8_t *best_first_bytes, uint64_t *found_key) {
 #if defined (WRITE_BENCH_FILE)
     write_benchfile(candidates);
@@ -306,44 +472,47 @@ bool brute_force_bs(float *bf_rate, statelist_t *candidates, uint32_t cuid, uint
 
     bitslice_test_nonces(nonces_to_bruteforce, bf_test_nonce, bf_test_nonce_par);
 
-    // count number of states to go
-    bucket_count = 0;
-    for (statelist_t *p = candidates; p != NULL; p = p->next) {
-        if (p->states[ODD_STATE] != NULL && p->states[EVEN_STATE] != NULL) {
-            buckets[bucket_count] = p;
-            bucket_count++;
-        }
-    }
-
-    uint64_t start_time = msclock();
-
 #if defined(__linux__) ||  defined(__APPLE__)
     if (NUM_BRUTE_FORCE_THREADS < 0)
         return false;
 #endif
 
-    pthread_t threads[NUM_BRUTE_FORCE_THREADS];
+    const uint32_t num_threads = NUM_BRUTE_FORCE_THREADS;
+
+    if (split_into_chunks(candidates, maximum_states, num_threads) == false) {
+        PrintAndLogEx(WARNING, "Out of memory error in brute_force_bs(). Aborting...");
+        return false;
+    }
+
+    uint64_t start_time = msclock();
+    bf_last_checkpoint = start_time;
+
+    pthread_t threads[num_threads];
     struct args {
         bool silent;
         int thread_ID;
+        uint32_t num_threads;
         uint32_t cuid;
         uint32_t num_acquired_nonces;
         uint64_t maximum_states;
+        uint64_t start_time;
         noncelist_t *nonces;
         uint8_t *best_first_bytes;
-    } thread_args[NUM_BRUTE_FORCE_THREADS];
+    } thread_args[num_threads];
 
-    for (uint32_t i = 0; i < NUM_BRUTE_FORCE_THREADS; i++) {
+    for (uint32_t i = 0; i < num_threads; i++) {
         thread_args[i].thread_ID = i;
+        thread_args[i].num_threads = num_threads;
         thread_args[i].silent = silent;
         thread_args[i].cuid = cuid;
         thread_args[i].num_acquired_nonces = num_acquired_nonces;
         thread_args[i].maximum_states = maximum_states;
+        thread_args[i].start_time = start_time;
         thread_args[i].nonces = nonces;
         thread_args[i].best_first_bytes = best_first_bytes;
         pthread_create(&threads[i], NULL, crack_states_thread, (void *)&thread_args[i]);
     }
-    for (uint32_t i = 0; i < NUM_BRUTE_FORCE_THREADS; i++) {
+    for (uint32_t i = 0; i < num_threads; i++) {
         pthread_join(threads[i], 0);
     }
 
@@ -355,6 +524,8 @@ bool brute_force_bs(float *bf_rate, statelist_t *candidates, uint32_t cuid, uint
     if (keys_found > 0)
         *found_key = found_bs_key;
 
+    free_chunks();
+
     return (keys_found != 0);
 }
 
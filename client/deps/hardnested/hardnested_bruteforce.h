@@ -53,7 +53,11 @@ typedef struct {
     void *next;
 } statelist_t;
 
+// called periodically during brute force with the per chunk completion flags
+typedef void bf_checkpoint_t(const uint8_t *chunk_done, uint32_t num_chunks);
+
 void prepare_bf_test_nonces(noncelist_t *nonces, uint8_t best_first_byte);
+void set_brute_force_checkpoint(bf_checkpoint_t *checkpoint, const uint8_t *resume_chunk_done, uint32_t resume_num_chunks);
 bool brute_force_bs(float *bf_rate, statelist_t *candidates, uint32_t cuid, uint32_t num_acquired_nonces, uint64_t maximum_states, noncelist_t *nonces, uint8_t *best_first_bytes, uint64_t *found_key);
 float brute_force_benchmark(void);
 uint8_t trailing_zeros(uint8_t byte);
@@ -45,11 +45,6 @@
 #define HF_MARGINAL_V   5000
 #define ANTENNA_ERROR   1.00 // current algo has 3% error margin.
 
-uint8_t g_DemodBuffer[MAX_DEMOD_BUF_LEN];
-size_t g_DemodBufferLen = 0;
-int32_t g_DemodStartIdx = 0;
-int g_DemodClock = 0;
-
 static int CmdHelp(const char *Cmd);
 
 // set the g_DemodBuffer with given array ofq binary (one bit per byte)
@@ -156,25 +151,23 @@ static double compute_autoc(const int *data, size_t n, int lag) {
 
 // option '1' to save g_DemodBuffer any other to restore
 void save_restoreDB(uint8_t saveOpt) {
-    static uint8_t SavedDB[MAX_DEMOD_BUF_LEN];
-    static size_t SavedDBlen;
-    static bool DB_Saved = false;
-    static size_t savedDemodStartIdx = 0;
-    static int savedDemodClock = 0;
+    demod_ctx_t *ctx = g_demod_ctx;
 
     if (saveOpt == GRAPH_SAVE) { //save
 
-        memcpy(SavedDB, g_DemodBuffer, sizeof(g_DemodBuffer));
-        SavedDBlen = g_DemodBufferLen;
-        DB_Saved = true;
-        savedDemodStartIdx = g_DemodStartIdx;
-        savedDemodClock = g_DemodClock;
-    } else if (DB_Saved) { //restore
+        if (buf_snapshot_take(&ctx->saved_demod, &ctx->saved_demod, ctx->demod, ctx->demod_len) == false) {
+            PrintAndLogEx(WARNING, "Failed to allocate memory");
+            return;
+        }
+        ctx->demod_saved = true;
+        ctx->saved_demod_start = ctx->demod_start;
+        ctx->saved_demod_clock = ctx->demod_clock;
+    } else if (ctx->demod_saved) { //restore
 
-        memcpy(g_DemodBuffer, SavedDB, sizeof(g_DemodBuffer));
-        g_DemodBufferLen = SavedDBlen;
-        g_DemodClock = savedDemodClock;
-        g_DemodStartIdx = savedDemodStartIdx;
+        buf_snapshot_restore(&ctx->saved_demod, ctx->demod);
+        ctx->demod_len = ctx->saved_demod.len;
+        ctx->demod_clock = ctx->saved_demod_clock;
+        ctx->demod_start = ctx->saved_demod_start;
     }
 }
 
@@ -431,8 +424,11 @@ int ASKDemod_ext(int clk, int invert, int maxErr, size_t maxlen, bool amplify, b
 
     if (st) {
         *stCheck = st;
-        g_CursorCPos = ststart;
-        g_CursorDPos = stend;
+        // workers of a parallel search leave the plot window alone
+        if (demod_ctx_is_global()) {
+            g_CursorCPos = ststart;
+            g_CursorDPos = stend;
+        }
         if (verbose)
             PrintAndLogEx(DEBUG, "Found Sequence Terminator - First one is shown by orange / blue graph markers");
     }
@@ -687,7 +683,7 @@ int ASKbiphaseDemod(int offset, int clk, int invert, int maxErr, bool verbose) {
     //ask raw demod g_GraphBuffer first
 
     uint8_t bs[MAX_DEMOD_BUF_LEN];
-    size_t size = getFromGraphBuf(bs);
+    size_t size = getFromGraphBufEx(bs, sizeof(bs));
     if (size == 0) {
         PrintAndLogEx(DEBUG, "DEBUG: no data in graphbuf");
         return PM3_ESOFT;
@@ -789,10 +785,143 @@ static int Cmdaskrawdemod(const char *Cmd) {
     return ASKDemod_ext(clk, invert, max_err, max_len, amplify, true, false, 0, &st);
 }
 
+autocorr_plan_t *autocorr_plan_new(size_t maxlen) {
+    autocorr_plan_t *plan = calloc(1, sizeof(autocorr_plan_t));
+    if (plan == NULL) {
+        return NULL;
+    }
+
+    // linear, not circular, correlation needs room for twice the input
+    size_t n = 2;
+    while (n < 2 * maxlen) {
+        n <<= 1;
+    }
+
+    plan->maxlen = maxlen;
+    plan->fftlen = n;
+    plan->re = calloc(n, sizeof(double));
+    plan->im = calloc(n, sizeof(double));
+    plan->tw_re = calloc(n / 2, sizeof(double));
+    plan->tw_im = calloc(n / 2, sizeof(double));
+    plan->prefix = calloc(maxlen + 1, sizeof(int64_t));
+    plan->correl = calloc(maxlen + 1, sizeof(int));
+
+    if (plan->re == NULL || plan->im == NULL || plan->tw_re == NULL || plan->tw_im == NULL ||
+            plan->prefix == NULL || plan->correl == NULL) {
+        autocorr_plan_free(plan);
+        return NULL;
+    }
+
+    for (size_t k = 0; k < n / 2; k++) {
+        plan->tw_re[k] = cos(-2.0 * M_PI * k / n);
+        plan->tw_im[k] = sin(-2.0 * M_PI * k / n);
+    }
+    return plan;
+}
+
+void autocorr_plan_free(autocorr_plan_t *plan) {
+    if (plan == NULL) {
+        return;
+    }
+    free(plan->re);
+    free(plan->im);
+    free(plan->tw_re);
+    free(plan->tw_im);
+    free(plan->prefix);
+    free(plan->correl);
+    free(plan);
+}
+
+// in place iterative radix-2 forward FFT over plan->re / plan->im
+static void autocorr_fft(autocorr_plan_t *plan) {
+    size_t n = plan->fftlen;
+    double *re = plan->re;
+    double *im = plan->im;
+
+    for (size_t i = 1, j = 0; i < n; i++) {
+        size_t bit = n >> 1;
+        for (; j & bit; bit >>= 1) {
+            j ^= bit;
+        }
+        j ^= bit;
+        if (i < j) {
+            double t = re[i];
+            re[i] = re[j];
+            re[j] = t;
+            t = im[i];
+            im[i] = im[j];
+            im[j] = t;
+        }
+    }
+
+    for (size_t half = 1; half < n; half <<= 1) {
+        size_t step = n / (half * 2);
+        for (size_t i = 0; i < n; i += half * 2) {
+            for (size_t k = 0; k < half; k++) {
+                double wr = plan->tw_re[k * step];
+                double wi = plan->tw_im[k * step];
+                size_t a = i + k;
+                size_t b = a + half;
+                double xr = re[b] * wr - im[b] * wi;
+                double xi = re[b] * wi + im[b] * wr;
+                re[b] = re[a] - xr;
+                im[b] = im[a] - xi;
+                re[a] += xr;
+                im[a] += xi;
+            }
+        }
+    }
+}
+
+// plan->re[lag] = sum of in[j] * in[j + lag] over j < len - lag, for every lag < len
+static void autocorr_lagged_products(autocorr_plan_t *plan, const int *in, size_t len) {
+    size_t n = plan->fftlen;
+
+    for (size_t i = 0; i < len; i++) {
+        plan->re[i] = in[i];
+    }
+    memset(plan->re + len, 0, (n - len) * sizeof(double));
+    memset(plan->im, 0, n * sizeof(double));
+
+    autocorr_fft(plan);
+
+    // power spectrum is real and even, so a second forward FFT is the inverse
+    for (size_t i = 0; i < n; i++) {
+        plan->re[i] = plan->re[i] * plan->re[i] + plan->im[i] * plan->im[i];
+        plan->im[i] = 0;
+    }
+
+    autocorr_fft(plan);
+
+    // integer input, round away the FFT noise
+    for (size_t i = 0; i < len; i++) {
+        plan->re[i] = llround(plan->re[i] / n);
+    }
+}
+
 int AutoCorrelate(const int *in, int *out, size_t len, size_t window, bool SaveGrph, bool verbose) {
+    // keep the plan between calls,  the plot window slider calls us on every move
+    static autocorr_plan_t *plan = NULL;
+
+    if (plan == NULL || plan->maxlen < len) {
+        autocorr_plan_free(plan);
+        plan = autocorr_plan_new(MAX(len, MAX_GRAPH_TRACE_LEN));
+        if (plan == NULL) {
+            PrintAndLogEx(WARNING, "Failed to allocate memory");
+            return 0;
+        }
+    }
+    return AutoCorrelateEx(plan, in, out, len, window, SaveGrph, verbose);
+}
+
+int AutoCorrelateEx(autocorr_plan_t *plan, const int *in, int *out, size_t len, size_t window, bool SaveGrph, bool verbose) {
     // sanity check
     if (window > len) window = len;
 
+    if (plan == NULL || len == 0 || len > plan->maxlen) {
+        return 0;
+    }
+
     if (verbose) PrintAndLogEx(INFO, "performing " _YELLOW_("%zu") " correlations", g_GraphTraceLen - window);
 
     //test
@@ -805,13 +934,25 @@ int AutoCorrelate(const int *in, int *out, size_t len, size_t window, bool SaveG
     // Computed variance
     double variance = compute_variance(in, len);
 
-    int *correl_buf = calloc(MAX_GRAPH_TRACE_LEN, sizeof(int));
+    int *correl_buf = plan->correl;
+    memset(correl_buf, 0, (len + 1) * sizeof(int));
+
+    autocorr_lagged_products(plan, in, len);
+
+    plan->prefix[0] = 0;
+    for (size_t i = 0; i < len; i++) {
+        plan->prefix[i + 1] = plan->prefix[i] + in[i];
+    }
 
     for (size_t i = 0; i < len - window; ++i) {
 
-        for (size_t j = 0; j < (len - i); j++) {
-            autocv += (in[j] - mean) * (in[j + i] - mean);
-        }
+        // sum of (in[j] - mean) * (in[j + i] - mean) over j < len - i,
+        // expanded so the lagged products come from the FFT
+        size_t n = len - i;
+        double head = plan->prefix[n];
+        double tail = plan->prefix[len] - plan->prefix[i];
+        autocv += plan->re[i] - mean * (head + tail) + n * mean * mean;
+
         autocv = (1.0 / (len - i)) * autocv;
 
         correl_buf[i] = autocv;
@@ -871,7 +1012,6 @@ int AutoCorrelate(const int *in, int *out, size_t len, size_t window, bool SaveG
         g_DemodBufferLen = 0;
         RepaintGraphWindow();
     }
-    free(correl_buf);
     return retval;
 }
 
@@ -1015,27 +1155,59 @@ static int CmdUndecimate(const char *Cmd) {
     int factor = arg_get_int_def(ctx, 1, 2);
     CLIParserFree(ctx);
 
-    //We have memory, don't we?
-    int swap[MAX_GRAPH_TRACE_LEN] = {0};
-    uint32_t g_index = 0, s_index = 0;
-    while (g_index < g_GraphTraceLen && s_index + factor < MAX_GRAPH_TRACE_LEN) {
-        int count = 0;
-        for (count = 0; count < factor && s_index + count < MAX_GRAPH_TRACE_LEN; count++) {
+    if (factor < 1 || g_GraphTraceLen == 0) {
+        return PM3_SUCCESS;
+    }
+
+    size_t len = g_GraphTraceLen * factor;
+    int *swap = calloc(len, sizeof(int));
+    if (swap == NULL || graph_reserve(len) == false) {
+        PrintAndLogEx(WARNING, "Failed to allocate memory");
+        free(swap);
+        return PM3_EMALLOC;
+    }
+
+    size_t g_index = 0, s_index = 0;
+    while (g_index < g_GraphTraceLen) {
+        int next = (g_index + 1 < g_GraphTraceLen) ? g_GraphBuffer[g_index + 1] : 0;
+        for (int count = 0; count < factor; count++) {
             swap[s_index + count] = (
                                         (double)(factor - count) / (factor - 1)) * g_GraphBuffer[g_index] +
-                                    ((double)count / factor) * g_GraphBuffer[g_index + 1]
+                                    ((double)count / factor) * next
                                     ;
         }
-        s_index += count;
+        s_index += factor;
         g_index++;
     }
 
     memcpy(g_GraphBuffer, swap, s_index * sizeof(int));
+    free(swap);
     g_GraphTraceLen = s_index;
     RepaintGraphWindow();
     return PM3_SUCCESS;
 }
 
+static int CmdUndo(const char *Cmd) {
+    CLIParserContext *ctx;
+    CLIParserInit(&ctx, "data undo",
+                  "Undo the last change to the graphbuf, up to " _YELLOW_("16") " levels",
+                  "data undo"
+                 );
+    void *argtable[] = {
+        arg_param_begin,
+        arg_param_end
+    };
+    CLIExecWithReturn(ctx, Cmd, argtable, true);
+    CLIParserFree(ctx);
+
+    if (graph_undo() == false) {
+        PrintAndLogEx(INFO, "Nothing to undo");
+        return PM3_ENODATA;
+    }
+    PrintAndLogEx(SUCCESS, "Restored " _YELLOW_("%zu") " samples", g_GraphTraceLen);
+    return PM3_SUCCESS;
+}
+
 // shift graph zero up or down based on input + or -
 static int CmdGraphShiftZero(const char *Cmd) {
 
@@ -1221,7 +1393,7 @@ static int CmdDetectClockRate(const char *Cmd) {
 }
 
 static char *GetFSKType(uint8_t fchigh, uint8_t fclow, uint8_t invert) {
-    static char fType[8];
+    static __thread char fType[8];
     memset(fType, 0x00, 8);
     char *fskType = fType;
 
@@ -1642,6 +1814,10 @@ void setClockGrid(uint32_t clk, int offset) {
     if (offset < 0) offset += clk;
 
     if (offset > g_GraphTraceLen || offset < 0) return;
+
+    // workers of a parallel search leave the plot window alone
+    if (demod_ctx_is_global() == false) return;
+
     if (clk < 8 || clk > g_GraphTraceLen) {
         g_GridLocked = false;
         g_GridOffset = 0;
@@ -1779,13 +1955,18 @@ int CmdHpf(const char *Cmd) {
     CLIExecWithReturn(ctx, Cmd, argtable, true);
     CLIParserFree(ctx);
 
-    uint8_t bits[g_GraphTraceLen];
-    size_t size = getFromGraphBuf(bits);
+    uint8_t *bits = calloc(g_GraphTraceLen, sizeof(uint8_t));
+    if (bits == NULL) {
+        PrintAndLogEx(WARNING, "Failed to allocate memory");
+        return PM3_EMALLOC;
+    }
+    size_t size = getFromGraphBufEx(bits, g_GraphTraceLen);
     removeSignalOffset(bits, size);
     // push it back to graph
     setGraphBuf(bits, size);
     // set signal properties low/high/mean/amplitude and is_noise detection
     computeSignalProperties(bits, size);
+    free(bits);
 
     RepaintGraphWindow();
     return PM3_SUCCESS;
@@ -1805,6 +1986,33 @@ static uint8_t getByte(uint8_t bits_per_sample, BitstreamOut_t *b) {
     return val;
 }
 
+typedef struct {
+    const uint8_t *got;
+    uint32_t converted;
+    bool ignore_lf_config;
+} samples_dl_t;
+
+// 8 bits/sample data can go to the graph buffer while the rest is still downloading.
+// The sampling config only comes with the first segment ACK,  until then chunks stay queued in got[]
+static bool samples_dl_cb(const uint8_t *data, uint32_t offset, uint32_t len, const PacketResponseNG *ack, void *ctx) {
+    (void) data;
+    samples_dl_t *dl = (samples_dl_t *)ctx;
+
+    if (dl->ignore_lf_config == false) {
+        if (ack == NULL)
+            return true;
+
+        // Old devices without this feature would send 0 at arg[0]
+        if (ack->oldarg[0] > 0 && ((const sample_config *)ack->data.asBytes)->bits_per_sample < 8)
+            return true;
+    }
+
+    for (; dl->converted < offset + len; dl->converted++) {
+        g_GraphBuffer[dl->converted] = ((int)dl->got[dl->converted]) - 127;
+    }
+    return true;
+}
+
 int getSamples(uint32_t n, bool verbose) {
     return getSamplesEx(0, n, verbose, false);
 }
@@ -1831,8 +2039,10 @@ int getSamplesEx(uint32_t start, uint32_t end, bool verbose, bool ignore_lf_conf
     if (verbose)
         PrintAndLogEx(INFO, "Reading " _YELLOW_("%u") " bytes from device memory", n);
 
+    samples_dl_t dl = { got, 0, ignore_lf_config };
+
     PacketResponseNG response;
-    if (!GetFromDevice(BIG_BUF, got, n, start, NULL, 0, &response, 10000, true)) {
+    if (!GetFromDeviceStream(BIG_BUF, got, n, start, &response, 10000, true, samples_dl_cb, &dl)) {
         PrintAndLogEx(WARNING, "timeout while waiting for reply.");
         return PM3_ETIMEOUT;
     }
@@ -1864,16 +2074,22 @@ int getSamplesEx(uint32_t start, uint32_t end, bool verbose, bool ignore_lf_conf
         if (verbose) PrintAndLogEx(INFO, "Unpacked %d samples", j);
 
     } else {
-        for (uint32_t j = 0; j < n; j++) {
+        // most of it was converted during the download
+        for (uint32_t j = dl.converted; j < n; j++) {
             g_GraphBuffer[j] = ((int)got[j]) - 127;
         }
         g_GraphTraceLen = n;
     }
 
-    uint8_t bits[g_GraphTraceLen];
-    size_t size = getFromGraphBuf(bits);
+    uint8_t *bits = calloc(g_GraphTraceLen, sizeof(uint8_t));
+    if (bits == NULL) {
+        PrintAndLogEx(WARNING, "Failed to allocate memory");
+        return PM3_EMALLOC;
+    }
+    size_t size = getFromGraphBufEx(bits, g_GraphTraceLen);
     // set signal properties low/high/mean/amplitude and is_noise detection
     computeSignalProperties(bits, size);
+    free(bits);
 
     setClockGrid(0, 0);
     g_DemodBufferLen = 0;
@@ -2196,20 +2412,20 @@ static int CmdLoad(const char *Cmd) {
     if (is_bin) {
         uint8_t val[2];
         while (fread(val, 1, 1, f)) {
+            if (graph_reserve(g_GraphTraceLen + 1) == false)
+                break;
+
             g_GraphBuffer[g_GraphTraceLen] = val[0] - 127;
             g_GraphTraceLen++;
-
-            if (g_GraphTraceLen >= MAX_GRAPH_TRACE_LEN)
-                break;
         }
     } else {
         char line[80];
         while (fgets(line, sizeof(line), f)) {
+            if (graph_reserve(g_GraphTraceLen + 1) == false)
+                break;
+
             g_GraphBuffer[g_GraphTraceLen] = atoi(line);
             g_GraphTraceLen++;
-
-            if (g_GraphTraceLen >= MAX_GRAPH_TRACE_LEN)
-                break;
         }
     }
     fclose(f);
@@ -2217,12 +2433,17 @@ static int CmdLoad(const char *Cmd) {
     PrintAndLogEx(SUCCESS, "loaded " _YELLOW_("%zu") " samples", g_GraphTraceLen);
 
     if (nofix == false) {
-        uint8_t bits[g_GraphTraceLen];
-        size_t size = getFromGraphBuf(bits);
+        uint8_t *bits = calloc(g_GraphTraceLen, sizeof(uint8_t));
+        if (bits == NULL) {
+            PrintAndLogEx(WARNING, "Failed to allocate memory");
+            return PM3_EMALLOC;
+        }
+        size_t size = getFromGraphBufEx(bits, g_GraphTraceLen);
 
         removeSignalOffset(bits, size);
         setGraphBuf(bits, size);
         computeSignalProperties(bits, size);
+        free(bits);
     }
 
     setClockGrid(0, 0);
@@ -2398,10 +2619,15 @@ int CmdNorm(const char *Cmd) {
         }
     }
 
-    uint8_t bits[g_GraphTraceLen];
-    size_t size = getFromGraphBuf(bits);
+    uint8_t *bits = calloc(g_GraphTraceLen, sizeof(uint8_t));
+    if (bits == NULL) {
+        PrintAndLogEx(WARNING, "Failed to allocate memory");
+        return PM3_EMALLOC;
+    }
+    size_t size = getFromGraphBufEx(bits, g_GraphTraceLen);
     // set signal properties low/high/mean/amplitude and is_noise detection
     computeSignalProperties(bits, size);
+    free(bits);
 
     RepaintGraphWindow();
     return PM3_SUCCESS;
@@ -2544,10 +2770,15 @@ static int CmdDirectionalThreshold(const char *Cmd) {
     directionalThreshold(g_GraphBuffer, g_GraphBuffer, g_GraphTraceLen, up, down);
 
     // set signal properties low/high/mean/amplitude and isnoice detection
-    uint8_t bits[g_GraphTraceLen];
-    size_t size = getFromGraphBuf(bits);
+    uint8_t *bits = calloc(g_GraphTraceLen, sizeof(uint8_t));
+    if (bits == NULL) {
+        PrintAndLogEx(WARNING, "Failed to allocate memory");
+        return PM3_EMALLOC;
+    }
+    size_t size = getFromGraphBufEx(bits, g_GraphTraceLen);
     // set signal properties low/high/mean/amplitude and is_noice detection
     computeSignalProperties(bits, size);
+    free(bits);
 
     RepaintGraphWindow();
     return PM3_SUCCESS;
@@ -2587,10 +2818,15 @@ int CmdZerocrossings(const char *Cmd) {
         }
     }
 
-    uint8_t bits[g_GraphTraceLen];
-    size_t size = getFromGraphBuf(bits);
+    uint8_t *bits = calloc(g_GraphTraceLen, sizeof(uint8_t));
+    if (bits == NULL) {
+        PrintAndLogEx(WARNING, "Failed to allocate memory");
+        return PM3_EMALLOC;
+    }
+    size_t size = getFromGraphBufEx(bits, g_GraphTraceLen);
     // set signal properties low/high/mean/amplitude and is_noise detection
     computeSignalProperties(bits, size);
+    free(bits);
     RepaintGraphWindow();
     return PM3_SUCCESS;
 }
@@ -2898,10 +3134,15 @@ static int CmdDataIIR(const char *Cmd) {
 
     iceSimple_Filter(g_GraphBuffer, g_GraphTraceLen, k);
 
-    uint8_t bits[g_GraphTraceLen];
-    size_t size = getFromGraphBuf(bits);
+    uint8_t *bits = calloc(g_GraphTraceLen, sizeof(uint8_t));
+    if (bits == NULL) {
+        PrintAndLogEx(WARNING, "Failed to allocate memory");
+        return PM3_EMALLOC;
+    }
+    size_t size = getFromGraphBufEx(bits, g_GraphTraceLen);
     // set signal properties low/high/mean/amplitude and is_noise detection
     computeSignalProperties(bits, size);
+    free(bits);
     RepaintGraphWindow();
     return PM3_SUCCESS;
 }
@@ -3517,6 +3758,7 @@ static command_t CommandTable[] = {
     {"dirthreshold",    CmdDirectionalThreshold, AlwaysAvailable,  "Max rising higher up-thres/ Min falling lower down-thres, keep rest as prev."},
     {"decimate",        CmdDecimate,             AlwaysAvailable,  "Decimate samples"},
     {"undecimate",      CmdUndecimate,           AlwaysAvailable,  "Un-decimate samples"},
+    {"undo",            CmdUndo,                 AlwaysAvailable,  "Undo last change to graph buffer"},
     {"hide",            CmdHide,                 AlwaysAvailable,  "Hide graph window"},
     {"hpf",             CmdHpf,                  AlwaysAvailable,  "Remove DC offset from trace"},
     {"iir",             CmdDataIIR,              AlwaysAvailable,  "Apply IIR buttersworth filter on plot data"},
@@ -3562,6 +3804,10 @@ static int CmdHelp(const char *Cmd) {
 
 int CmdData(const char *Cmd) {
     clearCommandBuffer();
-    return CmdsParse(CommandTable, Cmd);
+    // every data command gets an undo level,  dropped again if it left the graph alone
+    graph_undo_checkpoint();
+    int res = CmdsParse(CommandTable, Cmd);
+    graph_undo_settle();
+    return res;
 }
 
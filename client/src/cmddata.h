@@ -21,6 +21,7 @@
 
 #include "common.h"
 #include <stdbool.h>
+#include "graph.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -87,6 +88,22 @@ int printDemodBuff(uint8_t offset, bool strip_leading, bool invert, bool print_h
 void setDemodBuff(const uint8_t *buff, size_t size, size_t start_idx);
 bool getDemodBuff(uint8_t *buff, size_t *size);
 void save_restoreDB(uint8_t saveOpt);// option '1' to save g_DemodBuffer any other to restore
+
+// FFT plan and workspace for AutoCorrelate, reusable for any input up to maxlen samples
+typedef struct {
+    size_t maxlen;
+    size_t fftlen;      // power of two, >= 2 * maxlen
+    double *re;
+    double *im;
+    double *tw_re;      // fftlen / 2 twiddle factors
+    double *tw_im;
+    int64_t *prefix;    // prefix sums of the input, maxlen + 1
+    int *correl;        // correlation result, maxlen + 1
+} autocorr_plan_t;
+
+autocorr_plan_t *autocorr_plan_new(size_t maxlen);
+void autocorr_plan_free(autocorr_plan_t *plan);
+int AutoCorrelateEx(autocorr_plan_t *plan, const int *in, int *out, size_t len, size_t window, bool SaveGrph, bool verbose);
 int AutoCorrelate(const int *in, int *out, size_t len, size_t window, bool SaveGrph, bool verbose);
 
 int getSamples(uint32_t n, bool verbose);
@@ -97,11 +114,11 @@ int directionalThreshold(const int *in, int *out, size_t len, int8_t up, int8_t
 int AskEdgeDetect(const int *in, int *out, int len, int threshold);
 
 #define MAX_DEMOD_BUF_LEN (1024*128)
-extern uint8_t g_DemodBuffer[MAX_DEMOD_BUF_LEN];
-extern size_t g_DemodBufferLen;
-
-extern int g_DemodClock;
-extern int32_t g_DemodStartIdx;
+// live in the demod context of the calling thread,  see graph.h
+#define g_DemodBuffer    (g_demod_ctx->demod)
+#define g_DemodBufferLen (g_demod_ctx->demod_len)
+#define g_DemodClock     (g_demod_ctx->demod_clock)
+#define g_DemodStartIdx  (g_demod_ctx->demod_start)
 
 #ifdef __cplusplus
 }
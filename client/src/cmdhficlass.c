@@ -39,6 +39,7 @@
 #include "iclass_cmd.h"
 #include "crypto/asn1utils.h"      // ASN1 decoder
 #include "preferences.h"
+#include "crc64.h"
 
 
 #define PICOPASS_BLOCK_SIZE    8
@@ -3120,12 +3121,154 @@ static void add_key(uint8_t *key) {
     }
 }
 
+// Precomputed MAC tables,  CACHE_SUBDIR/iclass-<dictionary crc>-<csn>-<ccnr>-<mode>.<kind>
+// header followed by keycnt entries,  so a repeat run on the same card maps them as is
+#define ICLASS_MACTABLE_MAGIC   0x4d334d50 // "PM3M"
+#define ICLASS_MACTABLE_VERSION 1
+
+typedef enum {
+    ICLASS_MACTABLE_PREMAC = 0,     // iclass_premac_t in dictionary order,  chk sends them in that order
+    ICLASS_MACTABLE_PREKEY,         // iclass_prekey_t sorted by mac,  for bsearch
+} iclass_mactable_kind_t;
+
+typedef struct {
+    uint32_t magic;
+    uint16_t version;
+    uint8_t kind;
+    uint8_t mode;       // 0 standard, 1 elite, 2 raw
+    uint32_t keycnt;
+    uint64_t dict_crc;  // crc64 of the dictionary keys
+    uint8_t csn[8];
+    uint8_t ccnr[12];
+} PACKED iclass_mactable_header_t;
+
+typedef struct {
+    void *items;
+    uint32_t keycnt;
+    void *map;          // mapping of the cache file,  NULL when the items live on the heap
+    size_t maplen;
+} iclass_mactable_t;
+
+static size_t mactable_itemsize(iclass_mactable_kind_t kind) {
+    return (kind == ICLASS_MACTABLE_PREMAC) ? sizeof(iclass_premac_t) : sizeof(iclass_prekey_t);
+}
+
+static char *mactable_path(const iclass_mactable_header_t *hdr) {
+    char filename[FILE_PATH_SIZE];
+    snprintf(filename, sizeof(filename), "iclass-%016" PRIx64 "-%016" PRIx64 "-%016" PRIx64 "%08" PRIx64 "-%c.%s"
+             , hdr->dict_crc
+             , bytes_to_num((uint8_t *)hdr->csn, 8)
+             , bytes_to_num((uint8_t *)hdr->ccnr, 8)
+             , bytes_to_num((uint8_t *)hdr->ccnr + 8, 4)
+             , "ser"[hdr->mode]
+             , (hdr->kind == ICLASS_MACTABLE_PREMAC) ? "premac" : "prekey"
+            );
+
+    char *path = NULL;
+    if (searchHomeFilePath(&path, CACHE_SUBDIR, filename, true) != PM3_SUCCESS) {
+        return NULL;
+    }
+    return path;
+}
+
+static bool mactable_usable(const void *map, size_t maplen, const iclass_mactable_header_t *want) {
+    if (maplen < sizeof(iclass_mactable_header_t)) {
+        return false;
+    }
+    const iclass_mactable_header_t *hdr = (const iclass_mactable_header_t *)map;
+    return memcmp(hdr, want, sizeof(iclass_mactable_header_t)) == 0
+           && maplen == sizeof(iclass_mactable_header_t) + (size_t)hdr->keycnt * mactable_itemsize(hdr->kind);
+}
+
+// MAC of every dictionary key for this CSN / CCNR.
+// With use_cache,  a table from an earlier run is mapped instead of computed,  and a new one is kept for the next run.
+static int mactable_get(iclass_mactable_kind_t kind, const dictionary_t *dict, uint8_t *csn, uint8_t *ccnr, bool use_raw, bool use_elite, bool use_cache, iclass_mactable_t *table) {
+
+    memset(table, 0, sizeof(iclass_mactable_t));
+
+    iclass_mactable_header_t hdr = {
+        .magic = ICLASS_MACTABLE_MAGIC,
+        .version = ICLASS_MACTABLE_VERSION,
+        .kind = kind,
+        .mode = (use_raw) ? 2 : (use_elite) ? 1 : 0,
+        .keycnt = dict->keycnt,
+    };
+    memcpy(hdr.csn, csn, sizeof(hdr.csn));
+    memcpy(hdr.ccnr, ccnr, sizeof(hdr.ccnr));
+
+    char *path = NULL;
+    if (use_cache) {
+        uint64_t dict_crc = 0;
+        crc64(dict->keys, (size_t)dict->keycnt * 8, &dict_crc);
+        hdr.dict_crc = dict_crc;
+        path = mactable_path(&hdr);
+    }
+
+    if (path && fileExists(path)) {
+        if (mapFilePath(path, &table->map, &table->maplen) == PM3_SUCCESS) {
+            if (mactable_usable(table->map, table->maplen, &hdr)) {
+                PrintAndLogEx(INFO, "Using precomputed MACs " _YELLOW_("%s"), path);
+                table->items = (uint8_t *)table->map + sizeof(iclass_mactable_header_t);
+                table->keycnt = hdr.keycnt;
+                free(path);
+                return PM3_SUCCESS;
+            }
+            unmapFile(table->map, table->maplen);
+            table->map = NULL;
+            table->maplen = 0;
+        }
+    }
+
+    size_t itemsize = mactable_itemsize(kind);
+    table->items = calloc(dict->keycnt, itemsize);
+    if (table->items == NULL) {
+        PrintAndLogEx(WARNING, "failed to allocate memory");
+        free(path);
+        return PM3_EMALLOC;
+    }
+    table->keycnt = dict->keycnt;
+
+    PrintAndLogEx(INFO, "Generating diversified keys %s", (use_elite || use_raw) ? NOLF : "");
+    if (use_elite)
+        PrintAndLogEx(NORMAL, "using " _YELLOW_("elite algo"));
+    if (use_raw)
+        PrintAndLogEx(NORMAL, "using " _YELLOW_("raw mode"));
+
+    if (kind == ICLASS_MACTABLE_PREMAC) {
+        GenerateMacFrom(csn, ccnr, use_raw, use_elite, (uint8_t *)dict->keys, dict->keycnt, table->items);
+    } else {
+        GenerateMacKeyFrom(csn, ccnr, use_raw, use_elite, (uint8_t *)dict->keys, dict->keycnt, table->items);
+        PrintAndLogEx(INFO, "Sorting...");
+        qsort(table->items, dict->keycnt, itemsize, cmp_uint32);
+    }
+
+    if (path) {
+        if (saveFileCache(path, &hdr, sizeof(hdr), table->items, (size_t)dict->keycnt * itemsize) == PM3_SUCCESS) {
+            PrintAndLogEx(INFO, "Saved precomputed MACs " _YELLOW_("%s"), path);
+        } else {
+            PrintAndLogEx(WARNING, "Failed to save precomputed MACs " _YELLOW_("%s"), path);
+        }
+        free(path);
+    }
+    return PM3_SUCCESS;
+}
+
+static void mactable_free(iclass_mactable_t *table) {
+    if (table->map) {
+        unmapFile(table->map, table->maplen);
+    } else {
+        free(table->items);
+    }
+    memset(table, 0, sizeof(iclass_mactable_t));
+}
+
 static int CmdHFiClassCheckKeys(const char *Cmd) {
     CLIParserContext *ctx;
     CLIParserInit(&ctx, "hf iclass chk",
                   "Checkkeys loads a dictionary text file with 8byte hex keys to test authenticating against a iClass tag",
                   "hf iclass chk -f iclass_default_keys.dic\n"
-                  "hf iclass chk -f iclass_default_keys.dic --elite");
+                  "hf iclass chk -f iclass_default_keys.dic --elite\n"
+                  "hf iclass chk -f iclass_default_keys.dic --cache   -> reuse the MACs of an earlier run on the same card");
 
     void *argtable[] = {
         arg_param_begin,
@@ -3133,6 +3276,7 @@ static int CmdHFiClassCheckKeys(const char *Cmd) {
         arg_lit0(NULL, "credit", "key is assumed to be the credit key"),
         arg_lit0(NULL, "elite", "elite computations applied to key"),
         arg_lit0(NULL, "raw", "no computations applied to key (raw)"),
+        arg_lit0(NULL, "cache", "keep / reuse precomputed MACs in the user cache directory"),
         arg_param_end
     };
     CLIExecWithReturn(ctx, Cmd, argtable, false);
@@ -3144,6 +3288,7 @@ static int CmdHFiClassCheckKeys(const char *Cmd) {
     bool use_credit_key = arg_get_lit(ctx, 2);
     bool use_elite = arg_get_lit(ctx, 3);
     bool use_raw = arg_get_lit(ctx, 4);
+    bool use_cache = arg_get_lit(ctx, 5);
 
     CLIParserFree(ctx);
 
@@ -3153,18 +3298,19 @@ static int CmdHFiClassCheckKeys(const char *Cmd) {
     uint64_t t1 = msclock();
 
     // load keys
-    uint8_t *keyBlock = NULL;
-    uint32_t keycount = 0;
-    int res = loadFileDICTIONARY_safe(filename, (void **)&keyBlock, 8, &keycount);
-    if (res != PM3_SUCCESS || keycount == 0) {
-        free(keyBlock);
+    dictionary_t dict;
+    int res = mapFileDICTIONARY(filename, 8, &dict, true);
+    if (res != PM3_SUCCESS || dict.keycnt == 0) {
+        unmapFileDICTIONARY(&dict);
         return res;
     }
+    uint8_t *keyBlock = (uint8_t *)dict.keys;
+    uint32_t keycount = dict.keycnt;
 
     // limit size of keys that can be held in memory
     if (keycount > 100000) {
         PrintAndLogEx(FAILED, "File contains more than 100 000 keys, aborting...");
-        free(keyBlock);
+        unmapFileDICTIONARY(&dict);
         return PM3_EFILE;
     }
 
@@ -3182,28 +3328,23 @@ static int CmdHFiClassCheckKeys(const char *Cmd) {
 
     if (got_csn == false) {
         PrintAndLogEx(WARNING, "Tried %d times. Can't select card, aborting...", ICLASS_AUTH_RETRY);
-        free(keyBlock);
+        unmapFileDICTIONARY(&dict);
         DropField();
         return PM3_ESOFT;
     }
 
-    // allocate memory for the pre calculated macs
-    iclass_premac_t *pre = calloc(keycount, sizeof(iclass_premac_t));
-    if (pre == NULL) {
-        PrintAndLogEx(WARNING, "failed to allocate memory");
-        return PM3_EMALLOC;
-    }
-
     PrintAndLogEx(SUCCESS, "    CSN: " _GREEN_("%s"), sprint_hex(CSN, sizeof(CSN)));
     PrintAndLogEx(SUCCESS, "   CCNR: " _GREEN_("%s"), sprint_hex(CCNR, sizeof(CCNR)));
 
-    PrintAndLogEx(INFO, "Generating diversified keys %s", (use_elite || use_raw) ? NOLF : "");
-    if (use_elite)
-        PrintAndLogEx(NORMAL, "using " _YELLOW_("elite algo"));
-    if (use_raw)
-        PrintAndLogEx(NORMAL, "using " _YELLOW_("raw mode"));
-
-    GenerateMacFrom(CSN, CCNR, use_raw, use_elite, keyBlock, keycount, pre);
+    // pre calculated macs
+    iclass_mactable_t table;
+    res = mactable_get(ICLASS_MACTABLE_PREMAC, &dict, CSN, CCNR, use_raw, use_elite, use_cache, &table);
+    if (res != PM3_SUCCESS) {
+        unmapFileDICTIONARY(&dict);
+        DropField();
+        return res;
+    }
+    iclass_premac_t *pre = (iclass_premac_t *)table.items;
 
     PrintAndLogEx(SUCCESS, "Searching for " _YELLOW_("%s") " key...", (use_credit_key) ? "CREDIT" : "DEBIT");
 
@@ -3306,8 +3447,8 @@ out:
         add_key(key);
     }
 
-    free(pre);
-    free(keyBlock);
+    mactable_free(&table);
+    unmapFileDICTIONARY(&dict);
     PrintAndLogEx(NORMAL, "");
     return PM3_SUCCESS;
 }
@@ -3320,7 +3461,8 @@ static int CmdHFiClassLookUp(const char *Cmd) {
     CLIParserInit(&ctx, "hf iclass lookup",
                   "Lookup keys takes some sniffed trace data and tries to verify what key was used against a dictionary file",
                   "hf iclass lookup --csn 9655a400f8ff12e0 --epurse f0ffffffffffffff --macs 0000000089cb984b -f iclass_default_keys.dic\n"
-                  "hf iclass lookup --csn 9655a400f8ff12e0 --epurse f0ffffffffffffff --macs 0000000089cb984b -f iclass_default_keys.dic --elite");
+                  "hf iclass lookup --csn 9655a400f8ff12e0 --epurse f0ffffffffffffff --macs 0000000089cb984b -f iclass_default_keys.dic --elite\n"
+                  "hf iclass lookup --csn 9655a400f8ff12e0 --epurse f0ffffffffffffff --macs 0000000089cb984b -f iclass_default_keys.dic --cache");
 
     void *argtable[] = {
         arg_param_begin,
@@ -3330,6 +3472,7 @@ static int CmdHFiClassLookUp(const char *Cmd) {
         arg_str1(NULL, "macs", "<hex>", "MACs"),
         arg_lit0(NULL, "elite", "Elite computations applied to key"),
         arg_lit0(NULL, "raw", "no computations applied to key"),
+        arg_lit0(NULL, "cache", "keep / reuse precomputed MACs in the user cache directory"),
         arg_param_end
     };
     CLIExecWithReturn(ctx, Cmd, argtable, false);
@@ -3376,6 +3519,7 @@ static int CmdHFiClassLookUp(const char *Cmd) {
 
     bool use_elite = arg_get_lit(ctx, 5);
     bool use_raw = arg_get_lit(ctx, 6);
+    bool use_cache = arg_get_lit(ctx, 7);
 
     CLIParserFree(ctx);
 
@@ -3396,35 +3540,23 @@ static int CmdHFiClassLookUp(const char *Cmd) {
     // run time
     uint64_t t1 = msclock();
 
-    uint8_t *keyBlock = NULL;
-    uint32_t keycount = 0;
-
     // load keys
-    int res = loadFileDICTIONARY_safe(filename, (void **)&keyBlock, 8, &keycount);
-    if (res != PM3_SUCCESS || keycount == 0) {
-        free(keyBlock);
+    dictionary_t dict;
+    int res = mapFileDICTIONARY(filename, 8, &dict, true);
+    if (res != PM3_SUCCESS || dict.keycnt == 0) {
+        unmapFileDICTIONARY(&dict);
         return res;
     }
+    uint32_t keycount = dict.keycnt;
 
-    //iclass_prekey_t
-    iclass_prekey_t *prekey = calloc(keycount, sizeof(iclass_prekey_t));
-    if (!prekey) {
-        free(keyBlock);
-        return PM3_EMALLOC;
+    // mac list,  sorted
+    iclass_mactable_t table;
+    res = mactable_get(ICLASS_MACTABLE_PREKEY, &dict, csn, CCNR, use_raw, use_elite, use_cache, &table);
+    if (res != PM3_SUCCESS) {
+        unmapFileDICTIONARY(&dict);
+        return res;
     }
-
-    PrintAndLogEx(INFO, "Generating diversified keys...");
-    GenerateMacKeyFrom(csn, CCNR, use_raw, use_elite, keyBlock, keycount, prekey);
-
-    if (use_elite)
-        PrintAndLogEx(INFO, "Using " _YELLOW_("elite algo"));
-    if (use_raw)
-        PrintAndLogEx(INFO, "Using " _YELLOW_("raw mode"));
-
-    PrintAndLogEx(INFO, "Sorting...");
-
-    // sort mac list.
-    qsort(prekey, keycount, sizeof(iclass_prekey_t), cmp_uint32);
+    iclass_prekey_t *prekey = (iclass_prekey_t *)table.items;
 
     PrintAndLogEx(SUCCESS, "Searching for " _YELLOW_("%s") " key...", "DEBIT");
     iclass_prekey_t *item;
@@ -3442,8 +3574,8 @@ static int CmdHFiClassLookUp(const char *Cmd) {
     t1 = msclock() - t1;
     PrintAndLogEx(SUCCESS, "time in iclass lookup " _YELLOW_("%.3f") " seconds", (float)t1 / 1000.0);
 
-    free(prekey);
-    free(keyBlock);
+    mactable_free(&table);
+    unmapFileDICTIONARY(&dict);
     PrintAndLogEx(NORMAL, "");
     return PM3_SUCCESS;
 }
@@ -3464,7 +3596,6 @@ typedef struct {
 
 static size_t iclass_tc = 1;
 
-static pthread_mutex_t generator_mutex = PTHREAD_MUTEX_INITIALIZER;
 static void *bf_generate_mac(void *thread_arg) {
 
     iclass_thread_arg_t *targ = (iclass_thread_arg_t *)thread_arg;
@@ -3488,14 +3619,12 @@ static void *bf_generate_mac(void *thread_arg) {
 
         memcpy(key, keys + 8 * i, 8);
 
-        pthread_mutex_lock(&generator_mutex);
         if (use_raw)
             memcpy(div_key, key, 8);
         else
             HFiClassCalcDivKey(csn, key, div_key, use_elite);
 
         doMAC(cc_nr, div_key, list[i].mac);
-        pthread_mutex_unlock(&generator_mutex);
     }
     return NULL;
 }
@@ -3503,8 +3632,6 @@ static void *bf_generate_mac(void *thread_arg) {
 // precalc diversified keys and their MAC
 void GenerateMacFrom(uint8_t *CSN, uint8_t *CCNR, bool use_raw, bool use_elite, uint8_t *keys, uint32_t keycnt, iclass_premac_t *list) {
 
-    pthread_mutex_init(&generator_mutex, NULL);
-
     iclass_tc = num_CPUs();
     pthread_t threads[iclass_tc];
     iclass_thread_arg_t args[iclass_tc];
@@ -3556,21 +3683,18 @@ static void *bf_generate_mackey(void *thread_arg) {
 
         memcpy(list[i].key, keys + 8 * i, 8);
 
-        pthread_mutex_lock(&generator_mutex);
         if (use_raw)
             memcpy(div_key, list[i].key, 8);
         else
             HFiClassCalcDivKey(csn, list[i].key, div_key, use_elite);
 
         doMAC(cc_nr, div_key, list[i].mac);
-        pthread_mutex_unlock(&generator_mutex);
     }
     return NULL;
 }
 
 void GenerateMacKeyFrom(uint8_t *CSN, uint8_t *CCNR, bool use_raw, bool use_elite, uint8_t *keys, uint32_t keycnt, iclass_prekey_t *list) {
 
-    pthread_mutex_init(&generator_mutex, NULL);
     iclass_tc = num_CPUs();
     pthread_t threads[iclass_tc];
     iclass_thread_arg_t args[iclass_tc];
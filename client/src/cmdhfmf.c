@@ -2739,7 +2739,7 @@ static int CmdHF14AMfNestedHarder(const char *Cmd) {
                   tests);
 
     uint64_t foundkey = 0;
-    int16_t isOK = mfnestedhard(blockno, keytype, key, trg_blockno, trg_keytype, know_target_key ? trg_key : NULL, nonce_file_read, nonce_file_write, slow, tests, &foundkey, filename);
+    int16_t isOK = mfnestedhard(blockno, keytype, key, trg_blockno, trg_keytype, know_target_key ? trg_key : NULL, nonce_file_read, nonce_file_write, slow, tests, &foundkey, filename, NULL, false);
 
     if ((tests == 0) && IfPm3Iso14443a()) {
         DropField();
@@ -2808,6 +2808,8 @@ static int CmdHF14AMfNestedHard(const char *Cmd) {
                   "hf mf hardnested -r\n"
                   "hf mf hardnested -r --tk a0a1a2a3a4a5\n"
                   "hf mf hardnested -t --tk a0a1a2a3a4a5\n"
+                  "hf mf hardnested --blk 0 -a -k FFFFFFFFFFFF --tblk 4 --ta -c hardnested.ckpt\n"
+                  "hf mf hardnested -c hardnested.ckpt --resume\n"
                   "hf mf hardnested --blk 0 -a -k a0a1a2a3a4a5 --tblk 4 --ta --tk FFFFFFFFFFFF"
                  );
 
@@ -2827,6 +2829,8 @@ static int CmdHF14AMfNestedHard(const char *Cmd) {
         arg_lit0("s",  "slow",           "Slower acquisition (required by some non standard cards)"),
         arg_lit0("t",  "tests",          "Run tests"),
         arg_lit0("w",  "write",             "Acquire nonces and UID, and write them to file `hf-mf-<UID>-nonces.bin`"),
+        arg_str0("c",  "ckpt",  "<fn>",  "Write nonces and brute force progress to checkpoint file"),
+        arg_lit0(NULL, "resume",         "Resume attack from checkpoint file given with `--ckpt`"),
 
         arg_lit0(NULL, "in", "None (use regular CPU instruction set)"),
 #if defined(COMPILER_HAS_SIMD_X86)
@@ -2888,18 +2892,23 @@ static int CmdHF14AMfNestedHard(const char *Cmd) {
     bool tests = arg_get_lit(ctx, 13);
     bool nonce_file_write = arg_get_lit(ctx, 14);
 
-    bool in = arg_get_lit(ctx, 15);
+    int ckptlen = 0;
+    char ckpt_filename[FILE_PATH_SIZE] = {0};
+    CLIParamStrToBuf(arg_get_str(ctx, 15), (uint8_t *)ckpt_filename, FILE_PATH_SIZE, &ckptlen);
+    bool resume = arg_get_lit(ctx, 16);
+
+    bool in = arg_get_lit(ctx, 17);
 #if defined(COMPILER_HAS_SIMD_X86)
-    bool im = arg_get_lit(ctx, 16);
-    bool is = arg_get_lit(ctx, 17);
-    bool ia = arg_get_lit(ctx, 18);
-    bool i2 = arg_get_lit(ctx, 19);
+    bool im = arg_get_lit(ctx, 18);
+    bool is = arg_get_lit(ctx, 19);
+    bool ia = arg_get_lit(ctx, 20);
+    bool i2 = arg_get_lit(ctx, 21);
 #endif
 #if defined(COMPILER_HAS_SIMD_AVX512)
-    bool i5 = arg_get_lit(ctx, 20);
+    bool i5 = arg_get_lit(ctx, 22);
 #endif
 #if defined(COMPILER_HAS_SIMD_NEON)
-    bool ie = arg_get_lit(ctx, 16);
+    bool ie = arg_get_lit(ctx, 18);
 #endif
     CLIParserFree(ctx);
 
@@ -2933,6 +2942,11 @@ static int CmdHF14AMfNestedHard(const char *Cmd) {
 
     bool know_target_key = (trg_keylen);
 
+    if (resume && ckptlen == 0) {
+        PrintAndLogEx(WARNING, "`--resume` needs a checkpoint file, use `--ckpt`");
+        return PM3_EINVARG;
+    }
+
     if (nonce_file_read) {
         char *fptr = GenerateFilename("hf-mf-", "-nonces.bin");
         if (fptr == NULL)
@@ -2954,7 +2968,7 @@ static int CmdHF14AMfNestedHard(const char *Cmd) {
         snprintf(filename, FILE_PATH_SIZE, "hf-mf-%s-nonces.bin", uid);
     }
 
-    if (know_target_key == false && nonce_file_read == false) {
+    if (know_target_key == false && nonce_file_read == false && resume == false) {
 
         // check if tag doesn't have static nonce
         if (detect_classic_static_nonce() == NONCE_STATIC) {
@@ -2978,12 +2992,12 @@ static int CmdHF14AMfNestedHard(const char *Cmd) {
                   know_target_key ? "" : " (not set)"
                  );
     PrintAndLogEx(INFO, "File action: " _YELLOW_("%s") ", Slow: " _YELLOW_("%s") ", Tests: " _YELLOW_("%d"),
-                  nonce_file_write ? "write" : nonce_file_read ? "read" : "none",
+                  resume ? "resume" : nonce_file_write ? "write" : nonce_file_read ? "read" : "none",
                   slow ? "Yes" : "No",
                   tests);
 
     uint64_t foundkey = 0;
-    int16_t isOK = mfnestedhard(blockno, keytype, key, trg_blockno, trg_keytype, know_target_key ? trg_key : NULL, nonce_file_read, nonce_file_write, slow, tests, &foundkey, filename);
+    int16_t isOK = mfnestedhard(blockno, keytype, key, trg_blockno, trg_keytype, know_target_key ? trg_key : NULL, nonce_file_read, nonce_file_write, slow, tests, &foundkey, filename, ckptlen ? ckpt_filename : NULL, resume);
 
     if ((tests == 0) && IfPm3Iso14443a()) {
         DropField();
@@ -3884,7 +3898,7 @@ tryHardnested: // If the nested attack fails then we try the hardnested attack
                                           slow ? _YELLOW_("yes") : _GREEN_("no"));
                         }
 
-                        isOK = mfnestedhard(mfFirstBlockOfSector(sectorno), keytype, key, mfFirstBlockOfSector(current_sector_i), current_key_type_i, NULL, false, false, slow, 0, &foundkey, NULL);
+                        isOK = mfnestedhard(mfFirstBlockOfSector(sectorno), keytype, key, mfFirstBlockOfSector(current_sector_i), current_key_type_i, NULL, false, false, slow, 0, &foundkey, NULL, NULL, false);
                         DropField();
                         if (isOK) {
                             switch (isOK) {
@@ -6076,9 +6090,9 @@ tryHardnested:
                         }
 
                         if (noncelen > 0){
-                            isOK = mfnestedhard(mfFirstBlockOfSector(sectorno), keytype, key, mfFirstBlockOfSector(current_sector_i), current_key_type_i, NULL, true, false, slow, use_tests, &foundkey, nonce_file);
+                            isOK = mfnestedhard(mfFirstBlockOfSector(sectorno), keytype, key, mfFirstBlockOfSector(current_sector_i), current_key_type_i, NULL, true, false, slow, use_tests, &foundkey, nonce_file, NULL, false);
                         } else {
-                            isOK = mfnestedhard(mfFirstBlockOfSector(sectorno), keytype, key, mfFirstBlockOfSector(current_sector_i), current_key_type_i, NULL, false, false, slow, use_tests, &foundkey, NULL);
+                            isOK = mfnestedhard(mfFirstBlockOfSector(sectorno), keytype, key, mfFirstBlockOfSector(current_sector_i), current_key_type_i, NULL, false, false, slow, use_tests, &foundkey, NULL, NULL, false);
                         }
                         if (tests == 0){
                             DropField();
@@ -6516,6 +6530,11 @@ static int mfLoadKeys(uint8_t **pkeyBlock, uint32_t *pkeycnt, uint8_t *userkey,
             free(keyBlock_tmp);
         }
     }
+
+    // user keys, default keys and dictionary overlap,  test every key once
+    uint32_t keycnt = dedupDICTIONARY(*pkeyBlock, *pkeycnt, 6);
+    PrintAndLogEx(DEBUG, "dropped %u repeated keys", *pkeycnt - keycnt);
+    *pkeycnt = keycnt;
     return PM3_SUCCESS;
 }
 
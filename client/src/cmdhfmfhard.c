@@ -50,9 +50,20 @@
 
 #define IGNORE_BITFLIP_THRESHOLD        0.99 // ignore bitflip arrays which have nearly only valid states
 
+#define CHECKPOINT_MAGIC                "PM3HNCK"
+#define CHECKPOINT_VERSION              1
+#define CHECKPOINT_NO_GUESS             0xff
+
 #define STATE_FILES_DIRECTORY           "hardnested_tables/"
 #define STATE_FILE_TEMPLATE             "bitflip_%d_%03" PRIx16 "_states.bin.bz2"
 
+// uncompressed copy of the bitflip state tables, memory mapped on later runs
+#define BITFLIP_CACHE_FILE              "hardnested_tables.cache"
+#define BITFLIP_CACHE_MAGIC             "PM3HNTC"
+#define BITFLIP_CACHE_VERSION           1
+#define BITFLIP_CACHE_ALIGN             4096
+#define BITFLIP_BITARRAY_SIZE           (sizeof(uint32_t) * (1 << 19))
+
 #define DEBUG_KEY_ELIMINATION
 // #define DEBUG_REDUCTION
 
@@ -129,6 +140,10 @@ static void print_progress_header(void) {
 }
 
 void hardnested_print_progress(uint32_t nonces, const char *activity, float brute_force, uint64_t min_diff_print_time) {
+    hardnested_print_progress_threads(nonces, activity, brute_force, min_diff_print_time, 0, NULL);
+}
+
+void hardnested_print_progress_threads(uint32_t nonces, const char *activity, float brute_force, uint64_t min_diff_print_time, uint32_t num_threads, const float *thread_rates) {
     static uint64_t last_print_time = 0;
     if (msclock() - last_print_time > min_diff_print_time) {
         last_print_time = msclock();
@@ -145,6 +160,15 @@ void hardnested_print_progress(uint32_t nonces, const char *activity, float brut
             snprintf(brute_force_time_string, sizeof(brute_force_time_string), "%2.0fd", brute_force_time / (60 * 60 * 24));
         }
         PrintAndLogEx(INFO, " %7.0f | %7u | %-55s | %15.0f | %5s", (float)total_time / 1000.0, nonces, activity, brute_force, brute_force_time_string);
+        // per thread brute force rates, in million keys/s
+        for (uint32_t i = 0; i < num_threads; i += 4) {
+            char rates[80] = "Mkeys/s per thread:";
+            for (uint32_t j = i; j < num_threads && j < i + 4; j++) {
+                size_t len = strlen(rates);
+                snprintf(rates + len, sizeof(rates) - len, " %2u:%5.1f", j, thread_rates[j] / 1000000.0);
+            }
+            PrintAndLogEx(INFO, " %7s | %7s | %-55s | %15s | %5s", "", "", rates, "", "");
+        }
     }
 }
 
@@ -247,7 +271,7 @@ static void init_bunzip2(bz_stream *compressed_stream, char *input_buffer, uint3
 
 }
 
-static void init_bitflip_bitarrays(void) {
+static void init_bitflip_bitarrays_bz2(void) {
 #if defined (DEBUG_REDUCTION)
     uint8_t line = 0;
 #endif
@@ -335,6 +359,195 @@ static void init_bitflip_bitarrays(void) {
         }
         effective_bitflip[odd_even][num_effective_bitflips[odd_even]] = 0x400; // EndOfList marker
     }
+}
+
+//----------------------------------------------------------------------------
+// Bitflip table cache: a header, one entry per effective table and the raw
+// 2MByte bitarrays at page aligned offsets. Mapped read only and shared, so
+// concurrent clients use the same page cache instead of private copies.
+//----------------------------------------------------------------------------
+typedef struct {
+    char magic[7];
+    uint8_t version;
+    uint32_t num_tables;
+    uint32_t table_size;
+} PACKED bitflip_cache_hdr_t;
+
+typedef struct {
+    uint8_t odd_even;
+    uint8_t reserved;
+    uint16_t bitflip;
+    uint32_t count;
+    uint64_t offset;
+} PACKED bitflip_cache_entry_t;
+
+static void *bitflip_cache = NULL;
+static size_t bitflip_cache_len = 0;
+
+static size_t bitflip_cache_data_offset(uint32_t num_tables) {
+    size_t len = sizeof(bitflip_cache_hdr_t) + num_tables * sizeof(bitflip_cache_entry_t);
+    return (len + BITFLIP_CACHE_ALIGN - 1) & ~((size_t)BITFLIP_CACHE_ALIGN - 1);
+}
+
+static bool map_bitflip_cache(void) {
+    char *path = NULL;
+    if (searchHomeFilePath(&path, RESOURCES_SUBDIR, BITFLIP_CACHE_FILE, false) != PM3_SUCCESS) {
+        return false;
+    }
+    if (fileExists(path) == false) {
+        free(path);
+        return false;
+    }
+
+    void *data = NULL;
+    size_t datalen = 0;
+    int res = mapFilePath(path, &data, &datalen);
+    free(path);
+    if (res != PM3_SUCCESS) {
+        return false;
+    }
+
+    const bitflip_cache_hdr_t *hdr = (const bitflip_cache_hdr_t *)data;
+    if (datalen < sizeof(bitflip_cache_hdr_t)
+            || memcmp(hdr->magic, BITFLIP_CACHE_MAGIC, sizeof(hdr->magic)) != 0
+            || hdr->version != BITFLIP_CACHE_VERSION
+            || hdr->table_size != BITFLIP_BITARRAY_SIZE
+            || hdr->num_tables > 2 * 0x400
+            || datalen < bitflip_cache_data_offset(hdr->num_tables)) {
+        PrintAndLogEx(WARNING, "Ignoring invalid bitflip table cache");
+        unmapFile(data, datalen);
+        return false;
+    }
+
+    const bitflip_cache_entry_t *entries = (const bitflip_cache_entry_t *)(hdr + 1);
+    for (uint32_t i = 0; i < hdr->num_tables; i++) {
+        if (entries[i].odd_even > ODD_STATE
+                || entries[i].bitflip == 0x000 || entries[i].bitflip >= 0x400
+                || (entries[i].offset % BITFLIP_CACHE_ALIGN) != 0
+                || datalen < BITFLIP_BITARRAY_SIZE
+                || entries[i].offset > datalen - BITFLIP_BITARRAY_SIZE) {
+            PrintAndLogEx(WARNING, "Ignoring invalid bitflip table cache");
+            unmapFile(data, datalen);
+            return false;
+        }
+    }
+
+    for (odd_even_t odd_even = EVEN_STATE; odd_even <= ODD_STATE; odd_even++) {
+        for (uint16_t bitflip = 0x001; bitflip < 0x400; bitflip++) {
+            bitflip_bitarrays[odd_even][bitflip] = NULL;
+            count_bitflip_bitarrays[odd_even][bitflip] = 1 << 24;
+        }
+    }
+    for (uint32_t i = 0; i < hdr->num_tables; i++) {
+        bitflip_bitarrays[entries[i].odd_even][entries[i].bitflip] = (uint32_t *)((uint8_t *)data + entries[i].offset);
+        count_bitflip_bitarrays[entries[i].odd_even][entries[i].bitflip] = entries[i].count;
+    }
+    for (odd_even_t odd_even = EVEN_STATE; odd_even <= ODD_STATE; odd_even++) {
+        num_effective_bitflips[odd_even] = 0;
+        for (uint16_t bitflip = 0x001; bitflip < 0x400; bitflip++) {
+            if (bitflip_bitarrays[odd_even][bitflip] != NULL) {
+                effective_bitflip[odd_even][num_effective_bitflips[odd_even]++] = bitflip;
+            }
+        }
+        effective_bitflip[odd_even][num_effective_bitflips[odd_even]] = 0x400; // EndOfList marker
+    }
+
+    bitflip_cache = data;
+    bitflip_cache_len = datalen;
+    return true;
+}
+
+// written to a temporary file first and renamed, so that a concurrently
+// starting client never maps a partially written cache
+static void save_bitflip_cache(void) {
+    uint32_t num_tables = num_effective_bitflips[EVEN_STATE] + num_effective_bitflips[ODD_STATE];
+    if (num_tables == 0) {
+        return;
+    }
+
+    char *path = NULL;
+    if (searchHomeFilePath(&path, RESOURCES_SUBDIR, BITFLIP_CACHE_FILE, true) != PM3_SUCCESS) {
+        return;
+    }
+
+    size_t tmplen = strlen(path) + 14;
+    char *tmppath = calloc(tmplen, sizeof(char));
+    if (tmppath == NULL) {
+        free(path);
+        return;
+    }
+    snprintf(tmppath, tmplen, "%s.%08x.tmp", path, (uint32_t)msclock());
+
+    FILE *f = fopen(tmppath, "wb");
+    if (f == NULL) {
+        PrintAndLogEx(WARNING, "Could not create bitflip table cache " _YELLOW_("%s"), tmppath);
+        free(tmppath);
+        free(path);
+        return;
+    }
+
+    bitflip_cache_hdr_t hdr = {
+        .version = BITFLIP_CACHE_VERSION,
+        .num_tables = num_tables,
+        .table_size = BITFLIP_BITARRAY_SIZE,
+    };
+    memcpy(hdr.magic, BITFLIP_CACHE_MAGIC, sizeof(hdr.magic));
+    bool ok = (fwrite(&hdr, sizeof(hdr), 1, f) == 1);
+
+    uint64_t offset = bitflip_cache_data_offset(num_tables);
+    for (odd_even_t odd_even = EVEN_STATE; ok && odd_even <= ODD_STATE; odd_even++) {
+        for (uint16_t i = 0; ok && i < num_effective_bitflips[odd_even]; i++) {
+            uint16_t bitflip = effective_bitflip[odd_even][i];
+            bitflip_cache_entry_t entry = {
+                .odd_even = odd_even,
+                .bitflip = bitflip,
+                .count = count_bitflip_bitarrays[odd_even][bitflip],
+                .offset = offset,
+            };
+            ok = (fwrite(&entry, sizeof(entry), 1, f) == 1);
+            offset += BITFLIP_BITARRAY_SIZE;
+        }
+    }
+
+    size_t padding = bitflip_cache_data_offset(num_tables) - (sizeof(hdr) + num_tables * sizeof(bitflip_cache_entry_t));
+    for (size_t i = 0; ok && i < padding; i++) {
+        ok = (fputc(0, f) != EOF);
+    }
+
+    for (odd_even_t odd_even = EVEN_STATE; ok && odd_even <= ODD_STATE; odd_even++) {
+        for (uint16_t i = 0; ok && i < num_effective_bitflips[odd_even]; i++) {
+            uint16_t bitflip = effective_bitflip[odd_even][i];
+            ok = (fwrite(bitflip_bitarrays[odd_even][bitflip], BITFLIP_BITARRAY_SIZE, 1, f) == 1);
+        }
+    }
+
+    if (fclose(f) != 0) {
+        ok = false;
+    }
+
+    if (ok) {
+#ifdef _WIN32
+        remove(path);
+#endif
+        ok = (rename(tmppath, path) == 0);
+    }
+
+    if (ok) {
+        PrintAndLogEx(INFO, "Saved bitflip table cache to " _YELLOW_("%s"), path);
+    } else {
+        PrintAndLogEx(WARNING, "Could not write bitflip table cache " _YELLOW_("%s"), path);
+        remove(tmppath);
+    }
+    free(tmppath);
+    free(path);
+}
+
+static void init_bitflip_bitarrays(void) {
+
+    if (map_bitflip_cache() == false) {
+        init_bitflip_bitarrays_bz2();
+        save_bitflip_cache();
+    }
 
     uint16_t i = 0;
     uint16_t j = 0;
@@ -376,6 +589,16 @@ static void init_bitflip_bitarrays(void) {
 }
 
 static void free_bitflip_bitarrays(void) {
+    if (bitflip_cache != NULL) {
+        unmapFile(bitflip_cache, bitflip_cache_len);
+        bitflip_cache = NULL;
+        bitflip_cache_len = 0;
+        for (uint16_t bitflip = 0x001; bitflip < 0x400; bitflip++) {
+            bitflip_bitarrays[EVEN_STATE][bitflip] = NULL;
+            bitflip_bitarrays[ODD_STATE][bitflip] = NULL;
+        }
+        return;
+    }
     for (int16_t bitflip = 0x3ff; bitflip > 0x000; bitflip--) {
         free_bitarray(bitflip_bitarrays[ODD_STATE][bitflip]);
     }
@@ -687,6 +910,135 @@ static float sum_probability(uint16_t i_K, uint16_t n, uint16_t k) {
 
 static uint32_t part_sum_count[2][NUM_PART_SUMS][NUM_PART_SUMS];
 
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Reduction worker threads.
+// The bitarray operations between nonce batches are independent of each other, each one is a job.
+// A pool of worker threads lives for the whole attack, each reduction round hands it a batch of
+// jobs and the workers (and the caller) pick the next job until all are done.
+
+typedef void reduction_job_t(uint32_t job, void *arg);
+
+typedef struct {
+    reduction_job_t *fn;
+    void *arg;
+    uint32_t num_jobs;
+    uint32_t next_job;
+} reduction_jobs_t;
+
+static struct {
+    pthread_mutex_t lock;
+    pthread_cond_t work;            // new batch or stop
+    pthread_cond_t done;            // last worker left the batch
+    pthread_t *threads;
+    uint32_t num_threads;
+    uint32_t batch;                 // number of the current batch
+    uint32_t busy;                  // workers still in the current batch
+    bool stop;
+    reduction_jobs_t *jobs;
+} reduction_pool = { PTHREAD_MUTEX_INITIALIZER, PTHREAD_COND_INITIALIZER, PTHREAD_COND_INITIALIZER, NULL, 0, 0, 0, false, NULL };
+
+static void do_reduction_jobs(reduction_jobs_t *jobs) {
+    for (;;) {
+        uint32_t job = __atomic_fetch_add(&jobs->next_job, 1, __ATOMIC_RELAXED);
+        if (job >= jobs->num_jobs) {
+            break;
+        }
+        jobs->fn(job, jobs->arg);
+    }
+}
+
+static void
+#ifdef __has_attribute
+#if __has_attribute(force_align_arg_pointer)
+__attribute__((force_align_arg_pointer))
+#endif
+#endif
+*reduction_worker_thread(void *args) {
+    (void)args;
+    uint32_t batch = 0;
+
+    pthread_mutex_lock(&reduction_pool.lock);
+    for (;;) {
+        while (reduction_pool.stop == false && reduction_pool.batch == batch) {
+            pthread_cond_wait(&reduction_pool.work, &reduction_pool.lock);
+        }
+        if (reduction_pool.stop) {
+            break;
+        }
+        batch = reduction_pool.batch;
+        reduction_jobs_t *jobs = reduction_pool.jobs;
+        pthread_mutex_unlock(&reduction_pool.lock);
+
+        do_reduction_jobs(jobs);
+
+        pthread_mutex_lock(&reduction_pool.lock);
+        if (--reduction_pool.busy == 0) {
+            pthread_cond_signal(&reduction_pool.done);
+        }
+    }
+    pthread_mutex_unlock(&reduction_pool.lock);
+    return NULL;
+}
+
+// the calling thread works on every batch too, so the pool has one thread less than there are CPUs
+static void start_reduction_pool(void) {
+    uint32_t num_threads = NUM_REDUCTION_WORKING_THREADS - 1;
+    reduction_pool.threads = calloc(num_threads, sizeof(pthread_t));
+    if (reduction_pool.threads == NULL) {
+        return;
+    }
+    reduction_pool.stop = false;
+    reduction_pool.batch = 0;
+    reduction_pool.num_threads = 0;
+    for (uint32_t i = 0; i < num_threads; i++) {
+        if (pthread_create(&reduction_pool.threads[i], NULL, reduction_worker_thread, NULL) != 0) {
+            break;
+        }
+        reduction_pool.num_threads++;
+    }
+}
+
+static void stop_reduction_pool(void) {
+    pthread_mutex_lock(&reduction_pool.lock);
+    reduction_pool.stop = true;
+    pthread_cond_broadcast(&reduction_pool.work);
+    pthread_mutex_unlock(&reduction_pool.lock);
+
+    for (uint32_t i = 0; i < reduction_pool.num_threads; i++) {
+        pthread_join(reduction_pool.threads[i], NULL);
+    }
+    free(reduction_pool.threads);
+    reduction_pool.threads = NULL;
+    reduction_pool.num_threads = 0;
+    reduction_pool.stop = false;
+}
+
+static void run_reduction_jobs(uint32_t num_jobs, reduction_job_t *fn, void *arg) {
+    reduction_jobs_t jobs = {fn, arg, num_jobs, 0};
+
+    if (reduction_pool.num_threads == 0 || num_jobs <= 1) {
+        do_reduction_jobs(&jobs);
+        return;
+    }
+
+    pthread_mutex_lock(&reduction_pool.lock);
+    reduction_pool.jobs = &jobs;
+    reduction_pool.busy = reduction_pool.num_threads;
+    reduction_pool.batch++;
+    pthread_cond_broadcast(&reduction_pool.work);
+    pthread_mutex_unlock(&reduction_pool.lock);
+
+    do_reduction_jobs(&jobs);
+
+    // jobs lives on this stack, wait until no worker looks at it any more
+    pthread_mutex_lock(&reduction_pool.lock);
+    while (reduction_pool.busy > 0) {
+        pthread_cond_wait(&reduction_pool.done, &reduction_pool.lock);
+    }
+    reduction_pool.jobs = NULL;
+    pthread_mutex_unlock(&reduction_pool.lock);
+}
+
 static void init_allbitflips_array(void) {
     for (odd_even_t odd_even = EVEN_STATE; odd_even <= ODD_STATE; odd_even++) {
         uint32_t *bitset = all_bitflips_bitarray[odd_even] = (uint32_t *)malloc_bitarray(sizeof(uint32_t) * (1 << 19));
@@ -742,7 +1094,61 @@ static uint32_t estimated_num_states_part_sum(uint8_t first_byte, uint16_t part_
     // }
 }
 
+typedef struct {
+    uint8_t first_byte;
+    uint16_t num_jobs;
+    struct {
+        odd_even_t odd_even;
+        uint8_t part_sum_a0_idx;
+        uint8_t part_sum_a8_idx;
+    } job[2 * NUM_PART_SUMS * NUM_PART_SUMS];
+    uint32_t count[2][NUM_PART_SUMS][NUM_PART_SUMS];
+} part_sum_estimate_t;
+
+static void estimated_num_states_part_sum_job(uint32_t job, void *arg) {
+    part_sum_estimate_t *e = (part_sum_estimate_t *)arg;
+    odd_even_t odd_even = e->job[job].odd_even;
+    uint8_t a0 = e->job[job].part_sum_a0_idx;
+    uint8_t a8 = e->job[job].part_sum_a8_idx;
+    e->count[odd_even][a0][a8] = estimated_num_states_part_sum(e->first_byte, a0, a8, odd_even);
+}
+
 static uint64_t estimated_num_states(uint8_t first_byte, uint16_t sum_a0, uint16_t sum_a8) {
+
+    // collect the distinct partial sum combinations first, they are counted in parallel
+    part_sum_estimate_t e;
+    bool needed[2][NUM_PART_SUMS][NUM_PART_SUMS] = {{{false}}};
+    e.first_byte = first_byte;
+    e.num_jobs = 0;
+    for (uint8_t p = 0; p < NUM_PART_SUMS; p++) {
+        for (uint8_t q = 0; q < NUM_PART_SUMS; q++) {
+            if (2 * p * (16 - 2 * q) + (16 - 2 * p) * 2 * q == sum_a0) {
+                for (uint8_t r = 0; r < NUM_PART_SUMS; r++) {
+                    for (uint8_t s = 0; s < NUM_PART_SUMS; s++) {
+                        if (2 * r * (16 - 2 * s) + (16 - 2 * r) * 2 * s == sum_a8) {
+                            if (needed[ODD_STATE][p][r] == false) {
+                                needed[ODD_STATE][p][r] = true;
+                                e.job[e.num_jobs].odd_even = ODD_STATE;
+                                e.job[e.num_jobs].part_sum_a0_idx = p;
+                                e.job[e.num_jobs].part_sum_a8_idx = r;
+                                e.num_jobs++;
+                            }
+                            if (needed[EVEN_STATE][q][s] == false) {
+                                needed[EVEN_STATE][q][s] = true;
+                                e.job[e.num_jobs].odd_even = EVEN_STATE;
+                                e.job[e.num_jobs].part_sum_a0_idx = q;
+                                e.job[e.num_jobs].part_sum_a8_idx = s;
+                                e.num_jobs++;
+                            }
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+    run_reduction_jobs(e.num_jobs, estimated_num_states_part_sum_job, &e);
+
     uint64_t num_states = 0;
     for (uint8_t p = 0; p < NUM_PART_SUMS; p++) {
         for (uint8_t q = 0; q < NUM_PART_SUMS; q++) {
@@ -750,8 +1156,7 @@ static uint64_t estimated_num_states(uint8_t first_byte, uint16_t sum_a0, uint16
                 for (uint8_t r = 0; r < NUM_PART_SUMS; r++) {
                     for (uint8_t s = 0; s < NUM_PART_SUMS; s++) {
                         if (2 * r * (16 - 2 * s) + (16 - 2 * r) * 2 * s == sum_a8) {
-                            num_states += (uint64_t)estimated_num_states_part_sum(first_byte, p, r, ODD_STATE)
-                                          * estimated_num_states_part_sum(first_byte, q, s, EVEN_STATE);
+                            num_states += (uint64_t)e.count[ODD_STATE][p][r] * e.count[EVEN_STATE][q][s];
                         }
                     }
                 }
@@ -801,21 +1206,32 @@ static void update_p_K(void) {
     }
 }
 
+static void update_sum_bitarrays_job(uint32_t job, void *arg) {
+    odd_even_t odd_even = *(odd_even_t *)arg;
+    if (job < NUM_PART_SUMS) {
+        bitarray_AND(part_sum_a0_bitarrays[odd_even][job], all_bitflips_bitarray[odd_even]);
+    } else if (job < 2 * NUM_PART_SUMS) {
+        bitarray_AND(part_sum_a8_bitarrays[odd_even][job - NUM_PART_SUMS], all_bitflips_bitarray[odd_even]);
+    } else {
+        uint16_t i = job - 2 * NUM_PART_SUMS;
+        nonces[i].num_states_bitarray[odd_even] = count_bitarray_AND(nonces[i].states_bitarray[odd_even], all_bitflips_bitarray[odd_even]);
+    }
+}
+
+static void update_part_sum_count_job(uint32_t job, void *arg) {
+    odd_even_t odd_even = *(odd_even_t *)arg;
+    uint8_t part_sum_a0 = job / NUM_PART_SUMS;
+    uint8_t part_sum_a8 = job % NUM_PART_SUMS;
+    part_sum_count[odd_even][part_sum_a0][part_sum_a8]
+    += count_bitarray_AND2(part_sum_a0_bitarrays[odd_even][part_sum_a0], part_sum_a8_bitarrays[odd_even][part_sum_a8]);
+}
+
 static void update_sum_bitarrays(odd_even_t odd_even) {
     if (all_bitflips_bitarray_dirty[odd_even]) {
-        for (uint8_t part_sum = 0; part_sum < NUM_PART_SUMS; part_sum++) {
-            bitarray_AND(part_sum_a0_bitarrays[odd_even][part_sum], all_bitflips_bitarray[odd_even]);
-            bitarray_AND(part_sum_a8_bitarrays[odd_even][part_sum], all_bitflips_bitarray[odd_even]);
-        }
-        for (uint16_t i = 0; i < 256; i++) {
-            nonces[i].num_states_bitarray[odd_even] = count_bitarray_AND(nonces[i].states_bitarray[odd_even], all_bitflips_bitarray[odd_even]);
-        }
-        for (uint8_t part_sum_a0 = 0; part_sum_a0 < NUM_PART_SUMS; part_sum_a0++) {
-            for (uint8_t part_sum_a8 = 0; part_sum_a8 < NUM_PART_SUMS; part_sum_a8++) {
-                part_sum_count[odd_even][part_sum_a0][part_sum_a8]
-                += count_bitarray_AND2(part_sum_a0_bitarrays[odd_even][part_sum_a0], part_sum_a8_bitarrays[odd_even][part_sum_a8]);
-            }
-        }
+        // part sum bitarrays and the 256 nonce bitarrays are independent
+        run_reduction_jobs(2 * NUM_PART_SUMS + 256, update_sum_bitarrays_job, &odd_even);
+        // counts need the updated part sum bitarrays
+        run_reduction_jobs(NUM_PART_SUMS * NUM_PART_SUMS, update_part_sum_count_job, &odd_even);
         all_bitflips_bitarray_dirty[odd_even] = false;
     }
 }
@@ -1039,6 +1455,17 @@ static void estimate_sum_a8(void) {
     }
 }
 
+static int match_first_byte_sum(void) {
+    for (uint8_t i = 0; i < NUM_SUMS; i++) {
+        if (first_byte_Sum == sums[i]) {
+            first_byte_Sum = i;
+            return PM3_SUCCESS;
+        }
+    }
+    PrintAndLogEx(FAILED, "No match for the First_Byte_Sum (%u), is the card a genuine MFC Ev1? ", first_byte_Sum);
+    return 1;
+}
+
 static int read_nonce_file(char *filename) {
 
     if (filename == NULL) {
@@ -1085,21 +1512,251 @@ static int read_nonce_file(char *filename) {
     snprintf(progress_string, sizeof(progress_string), "Target Block=%d, Keytype=%c", trgBlockNo, trgKeyType == 0 ? 'A' : 'B');
     hardnested_print_progress(num_acquired_nonces, progress_string, (float)(1LL << 47), 0);
 
-    bool got_match = false;
-    for (uint8_t i = 0; i < NUM_SUMS; i++) {
-        if (first_byte_Sum == sums[i]) {
-            first_byte_Sum = i;
-            got_match = true;
-            break;
+    return match_first_byte_sum();
+}
+
+//----------------------------------------------------------------------------
+// Checkpoint file: header, the acquired nonces as nonces.bin records (before
+// pre_XOR_nonces()), and the completed chunk ranges of the running brute force.
+//----------------------------------------------------------------------------
+typedef struct {
+    char magic[7];
+    uint8_t version;
+    uint32_t cuid;
+    uint8_t trgBlockNo;
+    uint8_t trgKeyType;
+    uint8_t ignore_sum_a8;           // brute force without Sum(a8) guesses
+    uint8_t current_sum_a8;          // Sum(a8) index of the running guess, or CHECKPOINT_NO_GUESS
+    uint32_t done_sum_a8;            // bitmask of Sum(a8) indexes completely brute forced
+    uint32_t num_acquired_nonces;
+    uint32_t nonces_len;             // bytes of nonce records following the header
+    uint64_t maximum_states;         // key space of the running guess
+    uint32_t num_chunks;
+    uint32_t num_ranges;             // completed chunk ranges following the nonces
+    uint8_t best_first_bytes[256];
+} PACKED checkpoint_hdr_t;
+
+typedef struct {
+    uint32_t start;
+    uint32_t end;
+} PACKED checkpoint_range_t;
+
+static char *checkpoint_filename = NULL;
+static checkpoint_hdr_t checkpoint;
+static uint8_t *checkpoint_nonces = NULL;
+static uint8_t *resume_chunk_done = NULL;
+
+static void free_checkpoint(void) {
+    free(checkpoint_nonces);
+    checkpoint_nonces = NULL;
+    free(resume_chunk_done);
+    resume_chunk_done = NULL;
+    set_brute_force_checkpoint(NULL, NULL, 0);
+}
+
+// take a copy of the nonces in nonces.bin format. Must be called before pre_XOR_nonces()
+static int init_checkpoint(uint8_t trgBlockNo, uint8_t trgKeyType) {
+    uint32_t num = 0;
+    for (uint16_t i = 0; i < 256; i++) {
+        num += nonces[i].num;
+    }
+
+    free(checkpoint_nonces);
+    checkpoint_nonces = calloc((num + 1) / 2 * 9 + 1, sizeof(uint8_t));
+    if (checkpoint_nonces == NULL) {
+        return PM3_EMALLOC;
+    }
+
+    uint8_t *p = checkpoint_nonces;
+    bool second = false;
+    for (uint16_t i = 0; i < 256; i++) {
+        for (noncelistentry_t *n = nonces[i].first; n != NULL; n = n->next) {
+            num_to_bytes(n->nonce_enc, 4, p + (second ? 4 : 0));
+            p[8] |= second ? (n->par_enc & 0x0f) : (n->par_enc & 0x0f) << 4;
+            if (second) {
+                p += 9;
+            }
+            second = !second;
         }
     }
-    if (got_match == false) {
-        PrintAndLogEx(FAILED, "No match for the First_Byte_Sum (%u), is the card a genuine MFC Ev1? ", first_byte_Sum);
-        return 1;
+    if (second) {
+        // odd number of nonces, repeat the last one. add_nonce() drops the duplicate.
+        memcpy(p + 4, p, 4);
+        p[8] |= p[8] >> 4;
+        p += 9;
     }
+
+    memcpy(checkpoint.magic, CHECKPOINT_MAGIC, sizeof(checkpoint.magic));
+    checkpoint.version = CHECKPOINT_VERSION;
+    checkpoint.cuid = cuid;
+    checkpoint.trgBlockNo = trgBlockNo;
+    checkpoint.trgKeyType = trgKeyType;
+    checkpoint.num_acquired_nonces = num_acquired_nonces;
+    checkpoint.nonces_len = p - checkpoint_nonces;
+    memcpy(checkpoint.best_first_bytes, best_first_bytes, sizeof(checkpoint.best_first_bytes));
     return PM3_SUCCESS;
 }
 
+static void write_checkpoint(const uint8_t *chunk_done, uint32_t num_chunks) {
+    if (checkpoint_filename == NULL || checkpoint_nonces == NULL) {
+        return;
+    }
+
+    size_t tmplen = strlen(checkpoint_filename) + 5;
+    char *tmpname = calloc(tmplen, sizeof(char));
+    if (tmpname == NULL) {
+        return;
+    }
+    snprintf(tmpname, tmplen, "%s.tmp", checkpoint_filename);
+
+    FILE *f = fopen(tmpname, "wb");
+    if (f == NULL) {
+        PrintAndLogEx(WARNING, "Could not create checkpoint file " _YELLOW_("%s"), tmpname);
+        free(tmpname);
+        return;
+    }
+
+    checkpoint.num_chunks = (chunk_done != NULL) ? num_chunks : 0;
+    checkpoint.num_ranges = 0;
+    for (uint32_t i = 0; i < checkpoint.num_chunks; i++) {
+        if (chunk_done[i] && (i == 0 || chunk_done[i - 1] == 0)) {
+            checkpoint.num_ranges++;
+        }
+    }
+
+    bool ok = (fwrite(&checkpoint, sizeof(checkpoint), 1, f) == 1);
+    ok = ok && (fwrite(checkpoint_nonces, 1, checkpoint.nonces_len, f) == checkpoint.nonces_len);
+    for (uint32_t i = 0; ok && i < checkpoint.num_chunks; i++) {
+        if (chunk_done[i] && (i == 0 || chunk_done[i - 1] == 0)) {
+            checkpoint_range_t range = {.start = i, .end = i};
+            while (range.end < checkpoint.num_chunks && chunk_done[range.end]) {
+                range.end++;
+            }
+            ok = (fwrite(&range, sizeof(range), 1, f) == 1);
+        }
+    }
+
+    if (fclose(f) != 0) {
+        ok = false;
+    }
+    if (ok) {
+#ifdef _WIN32
+        remove(checkpoint_filename);
+#endif
+        ok = (rename(tmpname, checkpoint_filename) == 0);
+    }
+    if (ok == false) {
+        PrintAndLogEx(WARNING, "Could not write checkpoint file " _YELLOW_("%s"), checkpoint_filename);
+        remove(tmpname);
+    }
+    free(tmpname);
+}
+
+// set up checkpointing for the brute force of one Sum(a8) guess, or of all
+// candidates when CHECKPOINT_NO_GUESS. Call after the candidates are generated.
+static void checkpoint_brute_force(uint8_t sum_a8_idx) {
+    if (checkpoint_filename == NULL) {
+        return;
+    }
+    if (resume_chunk_done != NULL && (checkpoint.current_sum_a8 != sum_a8_idx || checkpoint.maximum_states != maximum_states)) {
+        PrintAndLogEx(WARNING, "Checkpoint doesn't match the candidate states, brute force starts over");
+        free(resume_chunk_done);
+        resume_chunk_done = NULL;
+    }
+    checkpoint.current_sum_a8 = sum_a8_idx;
+    checkpoint.maximum_states = maximum_states;
+    uint32_t num_chunks = (resume_chunk_done != NULL) ? checkpoint.num_chunks : 0;
+    write_checkpoint(resume_chunk_done, num_chunks);
+    set_brute_force_checkpoint(write_checkpoint, resume_chunk_done, num_chunks);
+}
+
+// the brute force of the current guess completed without finding the key
+static void checkpoint_brute_force_done(void) {
+    if (checkpoint_filename == NULL) {
+        return;
+    }
+    if (checkpoint.current_sum_a8 != CHECKPOINT_NO_GUESS) {
+        checkpoint.done_sum_a8 |= 1 << checkpoint.current_sum_a8;
+    }
+    checkpoint.current_sum_a8 = CHECKPOINT_NO_GUESS;
+    free(resume_chunk_done);
+    resume_chunk_done = NULL;
+    write_checkpoint(NULL, 0);
+}
+
+static int read_checkpoint(char *filename) {
+
+    num_acquired_nonces = 0;
+
+    FILE *f = fopen(filename, "rb");
+    if (f == NULL) {
+        PrintAndLogEx(WARNING, "Could not open checkpoint file " _YELLOW_("%s"), filename);
+        return 1;
+    }
+
+    char progress_text[80];
+    snprintf(progress_text, sizeof(progress_text), "Resuming from checkpoint file " _YELLOW_("%s"), filename);
+    hardnested_print_progress(0, progress_text, (float)(1LL << 47), 0);
+
+    if (fread(&checkpoint, sizeof(checkpoint), 1, f) != 1
+            || memcmp(checkpoint.magic, CHECKPOINT_MAGIC, sizeof(checkpoint.magic)) != 0
+            || checkpoint.version != CHECKPOINT_VERSION
+            || (checkpoint.nonces_len % 9) != 0) {
+        PrintAndLogEx(ERR, "Not a valid checkpoint file " _YELLOW_("%s"), filename);
+        fclose(f);
+        return 1;
+    }
+
+    free(checkpoint_nonces);
+    checkpoint_nonces = calloc(checkpoint.nonces_len + 1, sizeof(uint8_t));
+    if (checkpoint_nonces == NULL) {
+        fclose(f);
+        return PM3_EMALLOC;
+    }
+    if (fread(checkpoint_nonces, 1, checkpoint.nonces_len, f) != checkpoint.nonces_len) {
+        PrintAndLogEx(ERR, "File reading error.");
+        fclose(f);
+        return 1;
+    }
+
+    cuid = checkpoint.cuid;
+    for (uint32_t i = 0; i < checkpoint.nonces_len; i += 9) {
+        uint32_t nt_enc1 = bytes_to_num(checkpoint_nonces + i, 4);
+        uint32_t nt_enc2 = bytes_to_num(checkpoint_nonces + i + 4, 4);
+        uint8_t par_enc = checkpoint_nonces[i + 8];
+        add_nonce(nt_enc1, par_enc >> 4);
+        add_nonce(nt_enc2, par_enc & 0x0f);
+    }
+    num_acquired_nonces = checkpoint.num_acquired_nonces;
+
+    free(resume_chunk_done);
+    resume_chunk_done = NULL;
+    if (checkpoint.num_chunks != 0) {
+        resume_chunk_done = calloc(checkpoint.num_chunks, sizeof(uint8_t));
+        if (resume_chunk_done == NULL) {
+            fclose(f);
+            return PM3_EMALLOC;
+        }
+        for (uint32_t i = 0; i < checkpoint.num_ranges; i++) {
+            checkpoint_range_t range;
+            if (fread(&range, sizeof(range), 1, f) != 1 || range.start > range.end || range.end > checkpoint.num_chunks) {
+                PrintAndLogEx(ERR, "File reading error.");
+                fclose(f);
+                return 1;
+            }
+            memset(resume_chunk_done + range.start, 1, range.end - range.start);
+        }
+    }
+    fclose(f);
+
+    snprintf(progress_text, sizeof(progress_text), "Read %u nonces from checkpoint. cuid = %08x", num_acquired_nonces, cuid);
+    hardnested_print_progress(num_acquired_nonces, progress_text, (float)(1LL << 47), 0);
+    snprintf(progress_text, sizeof(progress_text), "Target Block=%d, Keytype=%c", checkpoint.trgBlockNo, checkpoint.trgKeyType == 0 ? 'A' : 'B');
+    hardnested_print_progress(num_acquired_nonces, progress_text, (float)(1LL << 47), 0);
+
+    return match_first_byte_sum();
+}
+
 static noncelistentry_t *SearchFor2ndByte(uint8_t b1, uint8_t b2) {
     noncelistentry_t *p = nonces[b1].first;
     while (p != NULL) {
@@ -2206,7 +2863,7 @@ static void init_it_all(void) {
     memset(sum_a0_bitarrays, 0, sizeof(sum_a0_bitarrays));
 }
 
-int mfnestedhard(uint8_t blockNo, uint8_t keyType, uint8_t *key, uint8_t trgBlockNo, uint8_t trgKeyType, uint8_t *trgkey, bool nonce_file_read, bool nonce_file_write, bool slow, int tests, uint64_t *foundkey, char *filename) {
+static int mfnestedhard_attack(uint8_t blockNo, uint8_t keyType, uint8_t *key, uint8_t trgBlockNo, uint8_t trgKeyType, uint8_t *trgkey, bool nonce_file_read, bool nonce_file_write, bool slow, int tests, uint64_t *foundkey, char *filename, char *ckpt_filename, bool resume) {
     char progress_text[80];
     char instr_set[12] = {0};
 
@@ -2353,20 +3010,28 @@ int mfnestedhard(uint8_t blockNo, uint8_t keyType, uint8_t *key, uint8_t trgBloc
         init_nonce_memory();
         update_reduction_rate(0.0, true);
 
-        if (nonce_file_read) {  // use pre-acquired data from file nonces.bin
-            if (read_nonce_file(filename) != 0) {
+        if (nonce_file_read || resume) {  // use pre-acquired data from file nonces.bin or a checkpoint
+            int res = resume ? read_checkpoint(ckpt_filename) : read_nonce_file(filename);
+            if (res != 0) {
                 free_bitflip_bitarrays();
                 free_nonces_memory();
                 free_bitarray(all_bitflips_bitarray[ODD_STATE]);
                 free_bitarray(all_bitflips_bitarray[EVEN_STATE]);
                 free_sum_bitarrays();
                 free_part_sum_bitarrays();
+                free_checkpoint();
                 return 3;
             }
             hardnested_stage = CHECK_1ST_BYTES | CHECK_2ND_BYTES;
             update_nonce_data(false);
             float brute_force_depth;
             shrink_key_space(&brute_force_depth);
+            if (resume) {
+                // continue with the first bytes the interrupted run has chosen
+                memcpy(best_first_bytes, checkpoint.best_first_bytes, sizeof(best_first_bytes));
+                trgBlockNo = checkpoint.trgBlockNo;
+                trgKeyType = checkpoint.trgKeyType;
+            }
         } else { // acquire nonces.
             uint16_t is_OK = acquire_nonces(blockNo, keyType, key, trgBlockNo, trgKeyType, nonce_file_write, slow, filename);
             if (is_OK != 0) {
@@ -2389,6 +3054,18 @@ int mfnestedhard(uint8_t blockNo, uint8_t keyType, uint8_t *key, uint8_t trgBloc
 
         Tests();
 
+        checkpoint_filename = ckpt_filename;
+        if (checkpoint_filename != NULL) {
+            if (resume == false) {
+                memset(&checkpoint, 0, sizeof(checkpoint));
+                checkpoint.current_sum_a8 = CHECKPOINT_NO_GUESS;
+            }
+            if (init_checkpoint(trgBlockNo, trgKeyType) != PM3_SUCCESS) {
+                PrintAndLogEx(WARNING, "Out of memory, no checkpoints will be written");
+                checkpoint_filename = NULL;
+            }
+        }
+
         free_bitflip_bitarrays();
         bool key_found = false;
         num_keys_tested = 0;
@@ -2397,7 +3074,17 @@ int mfnestedhard(uint8_t blockNo, uint8_t keyType, uint8_t *key, uint8_t trgBloc
         float expected_brute_force1 = (float)num_odd * num_even / 2.0;
         float expected_brute_force2 = nonces[best_first_bytes[0]].expected_num_brute_force;
 
-        if (expected_brute_force1 < expected_brute_force2) {
+        bool ignore_sum_a8 = (expected_brute_force1 < expected_brute_force2);
+        if (resume && checkpoint.ignore_sum_a8 != ignore_sum_a8) {
+            PrintAndLogEx(WARNING, "Checkpoint used a different brute force strategy, brute force starts over");
+            checkpoint.done_sum_a8 = 0;
+            checkpoint.current_sum_a8 = CHECKPOINT_NO_GUESS;
+            free(resume_chunk_done);
+            resume_chunk_done = NULL;
+        }
+        checkpoint.ignore_sum_a8 = ignore_sum_a8;
+
+        if (ignore_sum_a8) {
             hardnested_print_progress(num_acquired_nonces, "(Ignoring Sum(a8) properties)", expected_brute_force1, 0);
             set_test_state(best_first_byte_smallest_bitarray);
             add_bitflip_candidates(best_first_byte_smallest_bitarray);
@@ -2412,7 +3099,11 @@ int mfnestedhard(uint8_t blockNo, uint8_t keyType, uint8_t *key, uint8_t trgBloc
             pre_XOR_nonces();
             prepare_bf_test_nonces(nonces, best_first_bytes[0]);
 
+            checkpoint_brute_force(CHECKPOINT_NO_GUESS);
             key_found = brute_force(foundkey);
+            if (!key_found) {
+                checkpoint_brute_force_done();
+            }
             free(candidates->states[ODD_STATE]);
             free(candidates->states[EVEN_STATE]);
             free_candidates_memory(candidates);
@@ -2423,8 +3114,17 @@ int mfnestedhard(uint8_t blockNo, uint8_t keyType, uint8_t *key, uint8_t trgBloc
             prepare_bf_test_nonces(nonces, best_first_bytes[0]);
 
             for (uint8_t j = 0; j < NUM_SUMS && !key_found; j++) {
+                uint8_t sum_a8_idx = nonces[best_first_bytes[0]].sum_a8_guess[j].sum_a8_idx;
                 float expected_brute_force = nonces[best_first_bytes[0]].expected_num_brute_force;
-                snprintf(progress_text, sizeof(progress_text), "(%d. guess: Sum(a8) = %" PRIu16 ")", j + 1, sums[nonces[best_first_bytes[0]].sum_a8_guess[j].sum_a8_idx]);
+                if (checkpoint_filename != NULL && (checkpoint.done_sum_a8 & (1 << sum_a8_idx))) {
+                    snprintf(progress_text, sizeof(progress_text), "(%d. guess: Sum(a8) = %" PRIu16 " already done)", j + 1, sums[sum_a8_idx]);
+                    hardnested_print_progress(num_acquired_nonces, progress_text, expected_brute_force, 0);
+                    nonces[best_first_bytes[0]].sum_a8_guess[j].prob = 0;
+                    nonces[best_first_bytes[0]].sum_a8_guess[j].num_states = 0;
+                    update_expected_brute_force(best_first_bytes[0]);
+                    continue;
+                }
+                snprintf(progress_text, sizeof(progress_text), "(%d. guess: Sum(a8) = %" PRIu16 ")", j + 1, sums[sum_a8_idx]);
                 hardnested_print_progress(num_acquired_nonces, progress_text, expected_brute_force, 0);
 
                 if (trgkey != NULL && sums[nonces[best_first_bytes[0]].sum_a8_guess[j].sum_a8_idx] != real_sum_a8) {
@@ -2433,11 +3133,13 @@ int mfnestedhard(uint8_t blockNo, uint8_t keyType, uint8_t *key, uint8_t trgBloc
                 }
 
                 generate_candidates(first_byte_Sum, nonces[best_first_bytes[0]].sum_a8_guess[j].sum_a8_idx);
+                checkpoint_brute_force(sum_a8_idx);
                 key_found = brute_force(foundkey);
                 free_statelist_cache();
                 free_candidates_memory(candidates);
                 candidates = NULL;
                 if (!key_found) {
+                    checkpoint_brute_force_done();
                     // update the statistics
                     nonces[best_first_bytes[0]].sum_a8_guess[j].prob = 0;
                     nonces[best_first_bytes[0]].sum_a8_guess[j].num_states = 0;
@@ -2452,6 +3154,15 @@ int mfnestedhard(uint8_t blockNo, uint8_t keyType, uint8_t *key, uint8_t trgBloc
         free_bitarray(all_bitflips_bitarray[EVEN_STATE]);
         free_sum_bitarrays();
         free_part_sum_bitarrays();
+        free_checkpoint();
+        checkpoint_filename = NULL;
     }
     return 0;
 }
+
+int mfnestedhard(uint8_t blockNo, uint8_t keyType, uint8_t *key, uint8_t trgBlockNo, uint8_t trgKeyType, uint8_t *trgkey, bool nonce_file_read, bool nonce_file_write, bool slow, int tests, uint64_t *foundkey, char *filename, char *ckpt_filename, bool resume) {
+    start_reduction_pool();
+    int res = mfnestedhard_attack(blockNo, keyType, key, trgBlockNo, trgKeyType, trgkey, nonce_file_read, nonce_file_write, slow, tests, foundkey, filename, ckpt_filename, resume);
+    stop_reduction_pool();
+    return res;
+}
@@ -22,12 +22,15 @@
 #include <limits.h>
 #include <ctype.h>
 #include <time.h>
+#include <pthread.h>
+#include <dirent.h>
 #include "cmdparser.h"      // command_t
 #include "comms.h"
 #include "commonutil.h"     // ARRAYLEN
 #include "lfdemod.h"        // device/client demods of LF signals
 #include "ui.h"             // for show graph controls
 #include "proxgui.h"
+#include "util.h"           // num_CPUs
 #include "util_posix.h"
 #include "cliparser.h"      // args parsing
 #include "graph.h"          // for graph data
@@ -67,6 +70,7 @@
 #include "cmdlfzx8211.h"    // for ZX8211 menu
 #include "crc.h"
 #include "pm3_cmd.h"        // for LF_CMDREAD_MAX_EXTRA_SYMBOLS
+#include "fileutils.h"      // mapFilePath
 
 static bool gs_lf_threshold_set = false;
 
@@ -437,10 +441,18 @@ int CmdFlexdemod(const char *Cmd) {
 #endif
     int i, j, start, bit, sum;
 
-    int data[g_GraphTraceLen];
-    memcpy(data, g_GraphBuffer, g_GraphTraceLen);
-
     size_t size = g_GraphTraceLen;
+    if (size <= LONG_WAIT) {
+        PrintAndLogEx(WARNING, "not enough samples");
+        return PM3_ENODATA;
+    }
+
+    int *data = calloc(size, sizeof(int));
+    if (data == NULL) {
+        PrintAndLogEx(WARNING, "Failed to allocate memory");
+        return PM3_EMALLOC;
+    }
+    memcpy(data, g_GraphBuffer, size * sizeof(int));
 
     for (i = 0; i < g_GraphTraceLen; ++i)
         data[i] = (data[i] < 0) ? -1 : 1;
@@ -458,6 +470,14 @@ int CmdFlexdemod(const char *Cmd) {
 
     if (start == size - LONG_WAIT) {
         PrintAndLogEx(WARNING, "nothing to wait for");
+        free(data);
+        return PM3_ENODATA;
+    }
+
+    // two passes over 64 bits of 16 samples each
+    if (start + 2 * 64 * 16 > size) {
+        PrintAndLogEx(WARNING, "not enough samples");
+        free(data);
         return PM3_ENODATA;
     }
 
@@ -486,6 +506,7 @@ int CmdFlexdemod(const char *Cmd) {
         if (sum < 0 && bits[bit] != 0) PrintAndLogEx(WARNING, "oops2 at %d", bit);
 
     }
+    free(data);
 
     // iceman,  use g_DemodBuffer?  blue line?
     // HACK writing back to graphbuffer.
@@ -1459,6 +1480,125 @@ out:
     return retval;
 }
 
+// known tag demodulators tried by lf search,  in priority order
+typedef struct {
+    int (*demod)(bool verbose);
+    const char *name;
+    const char *modulation;
+    bool serial;        // not safe to run on a worker thread
+} lf_search_demod_t;
+
+static const lf_search_demod_t lf_search_demods[] = {
+    // ask / man
+    {demodEM410x,    "EM410x ID",               "ASK/MAN", false},
+    {demodDestron,   "FDX-A FECAVA Destron ID", "FSK",     false},    // to do before HID
+    {demodGallagher, "GALLAGHER ID",            "ASK/MAN", false},
+    {demodNoralsy,   "Noralsy ID",              "ASK/MAN", false},
+    {demodPresco,    "Presco ID",               "ASK/MAN", false},
+    {demodSecurakey, "Securakey ID",            "ASK/MAN", false},
+    {demodViking,    "Viking ID",               "ASK/MAN", false},
+    {demodVisa2k,    "Visa2000 ID",             "ASK/MAN", false},
+    // ask / bi
+    {demodFDXB,      "FDX-B ID",                "ASK/BI",  false},
+    {demodJablotron, "Jablotron ID",            "ASK/BI",  false},
+    {demodGuard,     "Guardall G-Prox II ID",   "ASK/BI",  false},
+    {demodNedap,     "NEDAP ID",                "ASK/BI",  false},
+    // nrz
+    {demodPac,       "PAC/Stanley ID",          "NRZ",     false},
+    // fsk
+    {demodHID,       "HID Prox ID",             "FSK",     false},
+    {demodAWID,      "AWID ID",                 "FSK",     false},
+    {demodIOProx,    "IO Prox ID",              "FSK",     false},
+    {demodPyramid,   "Pyramid ID",              "FSK",     false},
+    {demodParadox,   "Paradox ID",              "FSK",     false},
+    // psk
+    {demodIdteck,    "Idteck ID",               "PSK",     false},
+    {demodKeri,      "KERI ID",                 "PSK",     true},     // goes through the CLI parser
+    {demodNexWatch,  "NexWatch ID",             "PSK",     false},
+    {demodIndala,    "Indala ID",               "PSK",     false},
+};
+
+#define LF_SEARCH_UNTRIED   1
+
+typedef struct {
+    const demod_ctx_t *src;
+    signal_t signal;
+    int *results;
+    size_t count;
+    size_t next;
+} lf_search_job_t;
+
+static void *lf_search_worker(void *arg) {
+    lf_search_job_t *job = (lf_search_job_t *)arg;
+
+    demod_ctx_t *ctx = demod_ctx_new();
+    if (ctx == NULL) {
+        // whatever is left untried gets run by the caller
+        return NULL;
+    }
+
+    g_demod_ctx = ctx;
+    *getSignalProperties() = job->signal;
+    SetPrintMuted(true);
+
+    while (true) {
+        size_t i = __atomic_fetch_add(&job->next, 1, __ATOMIC_RELAXED);
+        if (i >= job->count) {
+            break;
+        }
+
+        if (lf_search_demods[i].serial) {
+            continue;
+        }
+
+        if (demod_ctx_copy(ctx, job->src) == false) {
+            job->results[i] = PM3_EMALLOC;
+            continue;
+        }
+        job->results[i] = lf_search_demods[i].demod(true);
+    }
+
+    SetPrintMuted(false);
+    demod_ctx_free(ctx);
+    return NULL;
+}
+
+// Try every known demodulator at once against the current graph buffer.
+// The buffer is only read,  each worker demodulates a private copy.
+// results[i] is the demodulator's return value or LF_SEARCH_UNTRIED
+static void lf_search_parallel(int *results, size_t count) {
+
+    for (size_t i = 0; i < count; i++) {
+        results[i] = LF_SEARCH_UNTRIED;
+    }
+
+    lf_search_job_t job = {
+        .src = g_demod_ctx,
+        .signal = *getSignalProperties(),
+        .results = results,
+        .count = count,
+        .next = 0,
+    };
+
+    // debugging wants the log of every failed attempt,  keep it serial
+    size_t thread_count = MIN((size_t)num_CPUs(), count);
+    if (thread_count < 2 || g_debugMode) {
+        return;
+    }
+
+    pthread_t threads[thread_count];
+    size_t started = 0;
+    for (size_t i = 0; i < thread_count; i++) {
+        if (pthread_create(&threads[started], NULL, lf_search_worker, &job) == 0) {
+            started++;
+        }
+    }
+
+    for (size_t i = 0; i < started; i++) {
+        pthread_join(threads[i], NULL);
+    }
+}
+
 int CmdLFfind(const char *Cmd) {
 
     CLIParserContext *ctx;
@@ -1561,189 +1701,23 @@ int CmdLFfind(const char *Cmd) {
 
     int retval = PM3_SUCCESS;
 
-    // ask / man
-    if (demodEM410x(true) == PM3_SUCCESS) {
-        PrintAndLogEx(SUCCESS, "\nValid " _GREEN_("EM410x ID") " found!");
-        if (search_cont) {
-            found++;
-        } else {
-            goto out;
-        }
-    }
-    if (demodDestron(true) == PM3_SUCCESS) { // to do before HID
-        PrintAndLogEx(SUCCESS, "\nValid " _GREEN_("FDX-A FECAVA Destron ID") " found!");
-        if (search_cont) {
-            found++;
-        } else {
-            goto out;
-        }
-    }
-    if (demodGallagher(true) == PM3_SUCCESS) {
-        PrintAndLogEx(SUCCESS, "\nValid " _GREEN_("GALLAGHER ID") " found!");
-        if (search_cont) {
-            found++;
-        } else {
-            goto out;
-        }
-    }
-    if (demodNoralsy(true) == PM3_SUCCESS) {
-        PrintAndLogEx(SUCCESS, "\nValid " _GREEN_("Noralsy ID") " found!");
-        if (search_cont) {
-            found++;
-        } else {
-            goto out;
-        }
-    }
-    if (demodPresco(true) == PM3_SUCCESS) {
-        PrintAndLogEx(SUCCESS, "\nValid " _GREEN_("Presco ID") " found!");
-        if (search_cont) {
-            found++;
-        } else {
-            goto out;
-        }
-    }
-    if (demodSecurakey(true) == PM3_SUCCESS) {
-        PrintAndLogEx(SUCCESS, "\nValid " _GREEN_("Securakey ID") " found!");
-        if (search_cont) {
-            found++;
-        } else {
-            goto out;
-        }
-    }
-    if (demodViking(true) == PM3_SUCCESS) {
-        PrintAndLogEx(SUCCESS, "\nValid " _GREEN_("Viking ID") " found!");
-        if (search_cont) {
-            found++;
-        } else {
-            goto out;
-        }
-    }
-    if (demodVisa2k(true) == PM3_SUCCESS) {
-        PrintAndLogEx(SUCCESS, "\nValid " _GREEN_("Visa2000 ID") " found!");
-        if (search_cont) {
-            found++;
-        } else {
-            goto out;
-        }
-    }
+    // every known demodulator runs on its own copy of the samples,
+    // the hits are replayed here in priority order
+    int results[ARRAYLEN(lf_search_demods)];
+    lf_search_parallel(results, ARRAYLEN(lf_search_demods));
 
-    // ask / bi
-    if (demodFDXB(true) == PM3_SUCCESS) {
-        PrintAndLogEx(SUCCESS, "\nValid " _GREEN_("FDX-B ID") " found!");
-        if (search_cont) {
-            found++;
-        } else {
-            goto out;
-        }
-    }
-    if (demodJablotron(true) == PM3_SUCCESS) {
-        PrintAndLogEx(SUCCESS, "\nValid " _GREEN_("Jablotron ID") " found!");
-        if (search_cont) {
-            found++;
-        } else {
-            goto out;
-        }
-    }
-    if (demodGuard(true) == PM3_SUCCESS) {
-        PrintAndLogEx(SUCCESS, "\nValid " _GREEN_("Guardall G-Prox II ID") " found!");
-        if (search_cont) {
-            found++;
-        } else {
-            goto out;
-        }
-    }
-    if (demodNedap(true) == PM3_SUCCESS) {
-        PrintAndLogEx(SUCCESS, "\nValid " _GREEN_("NEDAP ID") " found!");
-        if (search_cont) {
-            found++;
-        } else {
-            goto out;
-        }
-    }
-
-    // nrz
-    if (demodPac(true) == PM3_SUCCESS) {
-        PrintAndLogEx(SUCCESS, "\nValid " _GREEN_("PAC/Stanley ID") " found!");
-        if (search_cont) {
-            found++;
-        } else {
-            goto out;
-        }
-    }
-
-    // fsk
-    if (demodHID(true) == PM3_SUCCESS) {
-        PrintAndLogEx(SUCCESS, "\nValid " _GREEN_("HID Prox ID") " found!");
-        if (search_cont) {
-            found++;
-        } else {
-            goto out;
-        }
-    }
-    if (demodAWID(true) == PM3_SUCCESS) {
-        PrintAndLogEx(SUCCESS, "\nValid " _GREEN_("AWID ID") " found!");
-        if (search_cont) {
-            found++;
-        } else {
-            goto out;
-        }
-    }
-    if (demodIOProx(true) == PM3_SUCCESS) {
-        PrintAndLogEx(SUCCESS, "\nValid " _GREEN_("IO Prox ID") " found!");
-        if (search_cont) {
-            found++;
-        } else {
-            goto out;
-        }
-    }
-    if (demodPyramid(true) == PM3_SUCCESS) {
-        PrintAndLogEx(SUCCESS, "\nValid " _GREEN_("Pyramid ID") " found!");
-        if (search_cont) {
-            found++;
-        } else {
-            goto out;
-        }
-    }
-    if (demodParadox(true) == PM3_SUCCESS) {
-        PrintAndLogEx(SUCCESS, "\nValid " _GREEN_("Paradox ID") " found!");
-        if (search_cont) {
-            found++;
-        } else {
-            goto out;
+    for (size_t i = 0; i < ARRAYLEN(lf_search_demods); i++) {
+        if (results[i] != PM3_SUCCESS && results[i] != LF_SEARCH_UNTRIED) {
+            continue;
         }
-    }
 
-    // psk
-    if (demodIdteck(true) == PM3_SUCCESS) {
-        PrintAndLogEx(SUCCESS, "\nValid " _GREEN_("Idteck ID") " found!");
-        if (search_cont) {
-            found++;
-        } else {
-            goto out;
-        }
-    }
-    if (demodKeri(true) == PM3_SUCCESS) {
-        PrintAndLogEx(SUCCESS, "\nValid " _GREEN_("KERI ID") " found!");
-        if (search_cont) {
-            found++;
-        } else {
-            goto out;
-        }
-    }
-    if (demodNexWatch(true) == PM3_SUCCESS) {
-        PrintAndLogEx(SUCCESS, "\nValid " _GREEN_("NexWatch ID") " found!");
-        if (search_cont) {
-            found++;
-        } else {
-            goto out;
-        }
-    }
-    if (demodIndala(true) == PM3_SUCCESS) {
-        PrintAndLogEx(SUCCESS, "\nValid " _GREEN_("Indala ID") " found!");
-        if (search_cont) {
-            found++;
-        } else {
-            goto out;
+        if (lf_search_demods[i].demod(true) == PM3_SUCCESS) {
+            PrintAndLogEx(SUCCESS, "\nValid " _GREEN_("%s") " found!", lf_search_demods[i].name);
+            if (search_cont) {
+                found++;
+            } else {
+                goto out;
+            }
         }
     }
     /*
@@ -1835,6 +1809,383 @@ out:
     return retval;
 }
 
+// `lf batch`,  lf search -1 over every sample file in a directory tree
+
+typedef struct {
+    char *path;
+    size_t samples;
+    int status;                         // PM3_SUCCESS,  PM3_ESOFT no tag found,  PM3_EFILE, ...
+    const lf_search_demod_t *demod;     // the tag found
+    int clock;
+    char id[DEMOD_TAG_ID_LEN];          // as the demod printed it
+    char raw[MAX_DEMOD_BUF_LEN / 4 + 2]; // demod buffer in hex
+} lf_batch_item_t;
+
+typedef struct {
+    lf_batch_item_t *items;
+    size_t count;
+    size_t next;
+    pthread_mutex_t serial_lock;        // for the demodulators not safe to run side by side
+} lf_batch_job_t;
+
+static bool lf_batch_add(lf_batch_item_t **items, size_t *count, size_t *size, const char *path) {
+    if (*count == *size) {
+        size_t n = (*size) ? *size * 2 : 64;
+        lf_batch_item_t *tmp = realloc(*items, n * sizeof(lf_batch_item_t));
+        if (tmp == NULL) {
+            return false;
+        }
+        *items = tmp;
+        *size = n;
+    }
+
+    lf_batch_item_t *item = &(*items)[*count];
+    memset(item, 0, sizeof(lf_batch_item_t));
+    item->path = strdup(path);
+    if (item->path == NULL) {
+        return false;
+    }
+    (*count)++;
+    return true;
+}
+
+// collect the .pm3 files below dir
+static int lf_batch_walk(const char *dir, lf_batch_item_t **items, size_t *count, size_t *size) {
+
+    DIR *d = opendir(dir);
+    if (d == NULL) {
+        return PM3_EFILE;
+    }
+
+    int res = PM3_SUCCESS;
+    struct dirent *ent;
+    while ((ent = readdir(d)) != NULL) {
+        if (strcmp(ent->d_name, ".") == 0 || strcmp(ent->d_name, "..") == 0) {
+            continue;
+        }
+
+        size_t plen = strlen(dir) + strlen(ent->d_name) + 2;
+        char *path = calloc(plen, sizeof(char));
+        if (path == NULL) {
+            res = PM3_EMALLOC;
+            break;
+        }
+        snprintf(path, plen, "%s%s%s", dir, str_endswith(dir, PATHSEP) ? "" : PATHSEP, ent->d_name);
+
+        // links are skipped,  one pointing up the tree would be walked forever
+#ifdef _WIN32
+        struct _stat st;
+        int sres = _stat(path, &st);
+#else
+        struct stat st;
+        int sres = lstat(path, &st);
+#endif
+        if (sres == 0) {
+            if (S_ISDIR(st.st_mode)) {
+                lf_batch_walk(path, items, count, size);
+            } else if (S_ISREG(st.st_mode) && str_endswith(path, ".pm3")) {
+                if (lf_batch_add(items, count, size, path) == false) {
+                    res = PM3_EMALLOC;
+                }
+            }
+        }
+        free(path);
+
+        if (res != PM3_SUCCESS) {
+            break;
+        }
+    }
+    closedir(d);
+    return res;
+}
+
+static int lf_batch_cmp(const void *a, const void *b) {
+    return strcmp(((const lf_batch_item_t *)a)->path, ((const lf_batch_item_t *)b)->path);
+}
+
+// read a sample file into the current context,  one sample per line like `data load`
+static int lf_batch_load(const char *path) {
+
+    g_GraphTraceLen = 0;
+    g_DemodBufferLen = 0;
+    g_DemodStartIdx = 0;
+    g_DemodClock = 0;
+
+    void *map = NULL;
+    size_t maplen = 0;
+    if (mapFilePath(path, &map, &maplen) != PM3_SUCCESS) {
+        return PM3_EFILE;
+    }
+
+    const char *p = map;
+    const char *end = p + maplen;
+    while (p < end) {
+        while (p < end && (*p == ' ' || *p == '\t')) {
+            p++;
+        }
+
+        bool neg = false;
+        if (p < end && (*p == '-' || *p == '+')) {
+            neg = (*p == '-');
+            p++;
+        }
+
+        int val = 0;
+        while (p < end && isdigit((unsigned char)*p)) {
+            val = (val * 10) + (*p - '0');
+            p++;
+        }
+
+        while (p < end && *p != '\n') {
+            p++;
+        }
+        p++;
+
+        if (graph_reserve(g_GraphTraceLen + 1) == false) {
+            unmapFile(map, maplen);
+            return PM3_EMALLOC;
+        }
+        g_GraphBuffer[g_GraphTraceLen++] = (neg) ? -val : val;
+    }
+    unmapFile(map, maplen);
+
+    // same clean up as `data load`
+    uint8_t *bits = calloc(g_GraphTraceLen + 1, sizeof(uint8_t));
+    if (bits == NULL) {
+        return PM3_EMALLOC;
+    }
+    size_t size = getFromGraphBufEx(bits, g_GraphTraceLen);
+    removeSignalOffset(bits, size);
+    for (size_t i = 0; i < size; i++) {
+        g_GraphBuffer[i] = bits[i] - 128;
+    }
+    g_GraphTraceLen = size;
+    computeSignalProperties(bits, size);
+    free(bits);
+    return PM3_SUCCESS;
+}
+
+static void lf_batch_search(lf_batch_job_t *job, lf_batch_item_t *item, demod_ctx_t *src, demod_ctx_t *work) {
+
+    g_demod_ctx = src;
+    item->status = lf_batch_load(item->path);
+    item->samples = g_GraphTraceLen;
+    if (item->status != PM3_SUCCESS) {
+        return;
+    }
+
+    // lf search wants this much too
+    item->status = PM3_ESOFT;
+    if (item->samples < 2000) {
+        return;
+    }
+
+    for (size_t i = 0; i < ARRAYLEN(lf_search_demods); i++) {
+
+        if (demod_ctx_copy(work, src) == false) {
+            item->status = PM3_EMALLOC;
+            break;
+        }
+        g_demod_ctx = work;
+
+        if (lf_search_demods[i].serial) {
+            pthread_mutex_lock(&job->serial_lock);
+        }
+        int res = lf_search_demods[i].demod(true);
+        if (lf_search_demods[i].serial) {
+            pthread_mutex_unlock(&job->serial_lock);
+        }
+
+        if (res == PM3_SUCCESS) {
+            item->status = PM3_SUCCESS;
+            item->demod = &lf_search_demods[i];
+            item->clock = g_DemodClock;
+            memcpy(item->id, work->tag_id, sizeof(item->id));
+            binarraytohex(item->raw, sizeof(item->raw), (char *)g_DemodBuffer, g_DemodBufferLen);
+            break;
+        }
+    }
+    g_demod_ctx = src;
+}
+
+static void *lf_batch_worker(void *arg) {
+    lf_batch_job_t *job = (lf_batch_job_t *)arg;
+
+    demod_ctx_t *src = demod_ctx_new();
+    demod_ctx_t *work = demod_ctx_new();
+    if (src == NULL || work == NULL) {
+        demod_ctx_free(src);
+        demod_ctx_free(work);
+        return NULL;
+    }
+
+    demod_ctx_t *old = g_demod_ctx;
+    SetPrintMuted(true);
+
+    while (true) {
+        size_t i = __atomic_fetch_add(&job->next, 1, __ATOMIC_RELAXED);
+        if (i >= job->count) {
+            break;
+        }
+        lf_batch_search(job, &job->items[i], src, work);
+    }
+
+    SetPrintMuted(false);
+    g_demod_ctx = old;
+    demod_ctx_free(src);
+    demod_ctx_free(work);
+    return NULL;
+}
+
+// one worker per core,  each takes the next file when done
+static void lf_batch_run(lf_batch_job_t *job) {
+
+    pthread_mutex_init(&job->serial_lock, NULL);
+
+    size_t thread_count = MAX(MIN((size_t)num_CPUs(), job->count), 1);
+    pthread_t threads[thread_count];
+    size_t started = 0;
+    for (size_t i = 0; i < thread_count; i++) {
+        if (pthread_create(&threads[started], NULL, lf_batch_worker, job) == 0) {
+            started++;
+        }
+    }
+
+    // no thread to be had,  do it here
+    if (started == 0) {
+        lf_batch_worker(job);
+    }
+
+    for (size_t i = 0; i < started; i++) {
+        pthread_join(threads[i], NULL);
+    }
+    pthread_mutex_destroy(&job->serial_lock);
+}
+
+static char *lf_batch_json(const lf_batch_item_t *item) {
+
+    json_t *root = json_object();
+    if (root == NULL) {
+        return NULL;
+    }
+
+    json_object_set_new(root, "file", json_string(item->path));
+    json_object_set_new(root, "samples", json_integer(item->samples));
+
+    if (item->status == PM3_SUCCESS) {
+        // "EM410x ID" -> "EM410x"
+        const char *name = item->demod->name;
+        size_t len = strlen(name);
+        if (str_endswith(name, " ID")) {
+            len -= 3;
+        }
+        json_object_set_new(root, "type", json_stringn(name, len));
+        json_object_set_new(root, "id", (item->id[0]) ? json_string(item->id) : json_null());
+        json_object_set_new(root, "raw", json_string(item->raw));
+        json_object_set_new(root, "clock", json_integer(item->clock));
+        json_object_set_new(root, "modulation", json_string(item->demod->modulation));
+    } else {
+        json_object_set_new(root, "type", json_null());
+        if (item->status != PM3_ESOFT) {
+            json_object_set_new(root, "error", json_string((item->status == PM3_EMALLOC) ? "out of memory" : "can't read file"));
+        }
+    }
+
+    char *s = json_dumps(root, JSON_COMPACT | JSON_PRESERVE_ORDER);
+    json_decref(root);
+    return s;
+}
+
+static int CmdLFBatch(const char *Cmd) {
+
+    CLIParserContext *ctx;
+    CLIParserInit(&ctx, "lf batch",
+                  "Search every .pm3 sample file below a directory for known tags, like `lf search -1` does.\n"
+                  "Files are searched side by side on all cores, one JSON line per file is written with\n"
+                  "tag type, decoded id, raw frame (hex), clock and modulation. Type is null when no tag is found.\n"
+                  "No device needed, `proxmark3 -c \"lf batch -d traces/ -f index.jsonl\"` runs it headless.",
+                  "lf batch -d traces/\n"
+                  "lf batch -d traces/ -f index.jsonl"
+                 );
+
+    void *argtable[] = {
+        arg_param_begin,
+        arg_str1("d", "dir", "<dir>", "directory to search"),
+        arg_str0("f", "file", "<fn>", "write JSON lines to file instead of the console"),
+        arg_param_end
+    };
+    CLIExecWithReturn(ctx, Cmd, argtable, false);
+
+    int dlen = 0;
+    char dir[FILE_PATH_SIZE] = {0};
+    CLIParamStrToBuf(arg_get_str(ctx, 1), (uint8_t *)dir, FILE_PATH_SIZE, &dlen);
+
+    int fnlen = 0;
+    char filename[FILE_PATH_SIZE] = {0};
+    CLIParamStrToBuf(arg_get_str(ctx, 2), (uint8_t *)filename, FILE_PATH_SIZE, &fnlen);
+    CLIParserFree(ctx);
+
+    uint64_t t1 = msclock();
+
+    lf_batch_job_t job = {0};
+    size_t size = 0;
+    int res = lf_batch_walk(dir, &job.items, &job.count, &size);
+    if (res != PM3_SUCCESS) {
+        PrintAndLogEx(FAILED, "Can't read directory " _YELLOW_("%s"), dir);
+        goto out;
+    }
+    qsort(job.items, job.count, sizeof(lf_batch_item_t), lf_batch_cmp);
+
+    FILE *f = stdout;
+    if (fnlen) {
+        f = fopen(filename, "w");
+        if (f == NULL) {
+            PrintAndLogEx(FAILED, "Can't create file " _YELLOW_("%s"), filename);
+            res = PM3_EFILE;
+            goto out;
+        }
+        PrintAndLogEx(INFO, "Searching " _YELLOW_("%zu") " sample files...", job.count);
+    }
+
+    lf_batch_run(&job);
+
+    size_t found = 0;
+    for (size_t i = 0; i < job.count; i++) {
+        char *line = lf_batch_json(&job.items[i]);
+        if (line == NULL) {
+            continue;
+        }
+        if (f == stdout) {
+            PrintAndLogEx(NORMAL, "%s", line);
+        } else {
+            fprintf(f, "%s\n", line);
+        }
+        free(line);
+
+        if (job.items[i].status == PM3_SUCCESS) {
+            found++;
+        }
+    }
+
+    if (f != stdout) {
+        fclose(f);
+        t1 = msclock() - t1;
+        PrintAndLogEx(SUCCESS, "Found known tags in " _YELLOW_("%zu") " / " _YELLOW_("%zu") " files, saved to " _YELLOW_("%s") " ( %.1f s )"
+                      , found
+                      , job.count
+                      , filename
+                      , (float)t1 / 1000.0
+                     );
+    }
+
+out:
+    for (size_t i = 0; i < job.count; i++) {
+        free(job.items[i].path);
+    }
+    free(job.items);
+    return res;
+}
+
 static command_t CommandTable[] = {
     {"help",        CmdHelp,            AlwaysAvailable, "This help"},
     {"-----------", CmdHelp,            AlwaysAvailable, "-------------- " _CYAN_("Low Frequency") " --------------"},
@@ -1868,6 +2219,7 @@ static command_t CommandTable[] = {
     {"visa",        CmdLFVisa2k,        AlwaysAvailable, "[ Visa2000 RFIDs...          ]"},
 //    {"zx",          CmdLFZx8211,        AlwaysAvailable, "{ ZX8211 RFIDs...            }"},
     {"-----------", CmdHelp,            AlwaysAvailable, "--------------------- " _CYAN_("General") " ---------------------"},
+    {"batch",       CmdLFBatch,         AlwaysAvailable, "Search a directory of sample files for known tags"},
     {"conf",        CmdLFConfig,        IfPm3Lf,         "Get/Set config for LF sampling, bit/sample, decimation, frequency"},
     {"cmdread",     CmdLFCommandRead,   IfPm3Lf,         "Modulate LF reader field to send command before read"},
     {"read",        CmdLFRead,          IfPm3Lf,         "Read LF tag"},
@@ -272,6 +272,11 @@ int demodAWID(bool verbose) {
             }
             break;
     }
+    if (fmtLen > 32) {
+        demod_set_tag_id("%x%08x", code1, code2);
+    } else {
+        demod_set_tag_id("%x", code1);
+    }
     free(bits);
 
     PrintAndLogEx(DEBUG, "DEBUG: AWID idx: %d, Len: %zu Printing DemodBuffer:", idx, size);
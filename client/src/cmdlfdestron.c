@@ -86,6 +86,7 @@ int demodDestron(bool verbose) {
         PrintAndLogEx(DEBUG, "DEBUG: Error - Destron: parity errors: %d", parity_err);
         return PM3_ESOFT;
     }
+    demod_set_tag_id("%s", sprint_hex_inrow(data, 5));
     PrintAndLogEx(SUCCESS, "FDX-A FECAVA Destron: " _GREEN_("%s"), sprint_hex_inrow(data, 5));
     return PM3_SUCCESS;
 }
@@ -40,7 +40,7 @@
 #include "cliparser.h"
 #include "cmdhw.h"
 
-static uint64_t gs_em410xid = 0;
+static __thread uint64_t gs_em410xid = 0;
 
 static int CmdHelp(const char *Cmd);
 /* Read the ID of an EM410x tag.
@@ -279,6 +279,13 @@ int AskEm410xDecode(bool verbose, uint32_t *hi, uint64_t *lo) {
     }
 
     printEM410x(*hi, *lo, verbose, ans);
+    if (ans & 0x1) {
+        demod_set_tag_id("%010" PRIX64, *lo);
+    } else if (ans & 0x4) {
+        demod_set_tag_id("%010" PRIX64, ((uint64_t)*hi << 16) | (*lo >> 48));
+    } else {
+        demod_set_tag_id("%06X%016" PRIX64, *hi, *lo);
+    }
     gs_em410xid = *lo;
     return PM3_SUCCESS;
 }
@@ -1376,36 +1376,32 @@ int CmdEM4x05Chk(const char *Cmd) {
     }
 
     // Loop dictionary
-    uint8_t *keyBlock = NULL;
+    dictionary_t dict = {0};
     if (found == false) {
 
-        uint32_t keycount = 0;
-
-        res = loadFileDICTIONARY_safe(filename, (void **) &keyBlock, 4, &keycount);
-        if (res != PM3_SUCCESS || keycount == 0 || keyBlock == NULL) {
+        res = mapFileDICTIONARY(filename, 4, &dict, true);
+        if (res != PM3_SUCCESS || dict.keycnt == 0) {
             PrintAndLogEx(WARNING, "no keys found in file");
-            if (keyBlock != NULL)
-                free(keyBlock);
-
+            unmapFileDICTIONARY(&dict);
             return PM3_ESOFT;
         }
 
         PrintAndLogEx(INFO, "press " _GREEN_("<Enter>") " to exit");
 
-        for (uint32_t c = 0; c < keycount; ++c) {
+        for (uint32_t c = 0; c < dict.keycnt; ++c) {
 
             if (!g_session.pm3_present) {
                 PrintAndLogEx(WARNING, "device offline\n");
-                free(keyBlock);
+                unmapFileDICTIONARY(&dict);
                 return PM3_ENODATA;
             }
 
             if (is_cancelled()) {
-                free(keyBlock);
+                unmapFileDICTIONARY(&dict);
                 return PM3_EOPABORTED;
             }
 
-            uint32_t curr_password = bytes_to_num(keyBlock + 4 * c, 4);
+            uint32_t curr_password = bytes_to_num((uint8_t *)dict.keys + 4 * c, 4);
 
             PrintAndLogEx(INFO, "testing %08"PRIX32, curr_password);
 
@@ -1423,7 +1419,7 @@ int CmdEM4x05Chk(const char *Cmd) {
     if (found == false)
         PrintAndLogEx(WARNING, "check pwd failed");
 
-    free(keyBlock);
+    unmapFileDICTIONARY(&dict);
 
     t1 = msclock() - t1;
     PrintAndLogEx(SUCCESS, "\ntime in check pwd " _YELLOW_("%.0f") " seconds\n", (float)t1 / 1000.0);
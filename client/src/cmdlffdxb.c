@@ -563,6 +563,8 @@ int demodFDXB(bool verbose) {
     uint8_t raw[8];
     num_to_bytes(rawid, 8, raw);
 
+    demod_set_tag_id("%03u-%012" PRIu64, countryCode, NationalCode);
+
     if (!verbose) {
         PROMPT_CLEARLINE;
         PrintAndLogEx(SUCCESS, "Animal ID          " _GREEN_("%04u-%012"PRIu64), countryCode, NationalCode);
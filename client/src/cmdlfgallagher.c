@@ -85,6 +85,7 @@ int demodGallagher(bool verbose) {
     GallagherCredentials_t creds = {0};
     gallagher_decode_creds(arr, &creds);
 
+    demod_set_tag_id("%u-%u", creds.facility_code, creds.card_number);
     PrintAndLogEx(SUCCESS, "GALLAGHER - Region: " _GREEN_("%u") " Facility: " _GREEN_("%u") " Card No.: " _GREEN_("%u") " Issue Level: " _GREEN_("%u"),
                   creds.region_code, creds.facility_code, creds.card_number, creds.issue_level);
     PrintAndLogEx(SUCCESS, "   Displayed: " _GREEN_("%C%u"), creds.region_code + 'A', creds.facility_code);
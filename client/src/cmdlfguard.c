@@ -172,9 +172,10 @@ int demodGuard(bool verbose) {
             unknown = true;
             break;
     }
-    if (!unknown)
+    if (!unknown) {
+        demod_set_tag_id("%u-%u", FC, Card);
         PrintAndLogEx(SUCCESS, "G-Prox-II - len: " _GREEN_("%u")" FC: " _GREEN_("%u") " Card: " _GREEN_("%u") ", Raw: %08x%08x%08x", fmtLen, FC, Card, raw1, raw2, raw3);
-    else
+    } else
         PrintAndLogEx(SUCCESS, "G-Prox-II - Unknown len: " _GREEN_("%u") ", Raw: %08x%08x%08x", fmtLen, raw1, raw2, raw3);
 
     return PM3_SUCCESS;
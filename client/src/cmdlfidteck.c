@@ -91,6 +91,7 @@ int demodIdteck(bool verbose) {
     //checksum check (TBD)
 
     //output
+    demod_set_tag_id("%u", id);
     PrintAndLogEx(SUCCESS, "IDTECK Tag Found: Card ID %u ,  Raw: %08X%08X", id, raw1, raw2);
     return PM3_SUCCESS;
 }
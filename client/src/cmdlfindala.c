@@ -175,6 +175,7 @@ int demodIndalaEx(int clk, int invert, int maxErr, bool verbose) {
 
     if (g_DemodBufferLen == 64) {
         PrintAndLogEx(SUCCESS, "Indala (len %zu)  Raw: " _GREEN_("%x%08x"), g_DemodBufferLen, uid1, uid2);
+        demod_set_tag_id("%x%08x", uid1, uid2);
 
         uint16_t p1  = 0;
         p1 |= g_DemodBuffer[32 + 3] << 8;
@@ -250,6 +251,7 @@ int demodIndalaEx(int clk, int invert, int maxErr, bool verbose) {
         uint32_t uid5 = bytebits_to_byte(g_DemodBuffer + 128, 32);
         uint32_t uid6 = bytebits_to_byte(g_DemodBuffer + 160, 32);
         uint32_t uid7 = bytebits_to_byte(g_DemodBuffer + 192, 32);
+        demod_set_tag_id("%x%08x%08x%08x%08x%08x%08x", uid1, uid2, uid3, uid4, uid5, uid6, uid7);
         PrintAndLogEx(
             SUCCESS
             , "Indala (len %zu)  Raw: " _GREEN_("%x%08x%08x%08x%08x%08x%08x")
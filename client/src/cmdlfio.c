@@ -146,6 +146,7 @@ int demodIOProx(bool verbose) {
         retval = PM3_ESOFT;
     }
 
+    demod_set_tag_id("XSF(%02d)%02x:%05d", version, facilitycode, number);
     PrintAndLogEx(SUCCESS, "IO Prox - " _GREEN_("XSF(%02d)%02x:%05d") ", Raw: %08x%08x %s", version, facilitycode, number, code, code2, crc_str);
 
     if (g_debugMode) {
@@ -95,6 +95,7 @@ int demodJablotron(bool verbose) {
     uint64_t rawid = ((uint64_t)(bytebits_to_byte(g_DemodBuffer + 16, 8) & 0xff) << 32) | bytebits_to_byte(g_DemodBuffer + 24, 32);
     uint64_t id = getJablontronCardId(rawid);
 
+    demod_set_tag_id("%" PRIx64, id);
     PrintAndLogEx(SUCCESS, "Jablotron - Card: " _GREEN_("%"PRIx64) ", Raw: %08X%08X", id, raw1, raw2);
 
     uint8_t chksum = raw2 & 0xFF;
@@ -173,6 +173,7 @@ int demodKeri(bool verbose) {
     uint32_t ID = raw2;
     ID &= 0x7FFFFFFF;
 
+    demod_set_tag_id("%u", ID);
     PrintAndLogEx(SUCCESS, "KERI - Internal ID: " _GREEN_("%u") ", Raw: %08X%08X", ID, raw1, raw2);
 
     // Just need to the low 32 bits without the 111 trailer
@@ -143,6 +143,7 @@ int demodNedap(bool verbose) {
 
         badgeId = r1 * 10000 + r2 * 1000 + r3 * 100 + r4 * 10 + r5;
 
+        demod_set_tag_id("%05u", badgeId);
         PrintAndLogEx(SUCCESS, "NEDAP (%s) - ID: " _YELLOW_("%05u") " subtype: " _YELLOW_("%1u")" customer code: " _YELLOW_("%u / 0x%03X") " Raw: " _YELLOW_("%s")
                       , (size == 128) ? "128b" : "64b"
                       , badgeId
@@ -232,6 +232,7 @@ int demodNexWatch(bool verbose) {
     } else {
         nexwatch_magic_bruteforce(cn, calc_parity, chk);
     }
+    demod_set_tag_id("%" PRIu32, cn);
     PrintAndLogEx(SUCCESS, "        88bit id : " _YELLOW_("%"PRIu32) " ("  _YELLOW_("0x%08"PRIx32)")", cn, cn);
     PrintAndLogEx(SUCCESS, "            mode : %x", mode);
 
@@ -103,6 +103,7 @@ int demodNoralsy(bool verbose) {
         return PM3_ESOFT;
     }
 
+    demod_set_tag_id("%u", cardid);
     PrintAndLogEx(SUCCESS, "Noralsy - Card: " _GREEN_("%u")", Year: " _GREEN_("%u") ", Raw: %08X%08X%08X", cardid, year, raw1, raw2, raw3);
     if (raw1 != 0xBB0214FF) {
         PrintAndLogEx(WARNING, "Unknown bits set in first block! Expected 0xBB0214FF, Found: 0x%08X", raw1);
@@ -111,6 +111,7 @@ int demodPresco(bool verbose) {
     uint32_t usercode = fullcode & 0x0000FFFF;
     uint32_t sitecode = (fullcode >> 24) & 0x000000FF;
 
+    demod_set_tag_id("%08X", fullcode);
     PrintAndLogEx(SUCCESS, "Presco Site code: " _GREEN_("%u") " User code: " _GREEN_("%u") " Full code: " _GREEN_("%08X") " Raw: " _YELLOW_("%08X%08X%08X%08X")
                   , sitecode
                   , usercode
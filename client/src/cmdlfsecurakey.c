@@ -110,6 +110,7 @@ int demodSecurakey(bool verbose) {
     // test parities - evenparity32 looks to add an even parity returns 0 if already even...
     bool parity = !evenparity32(lWiegand) && !oddparity32(rWiegand);
 
+    demod_set_tag_id("%u-%u", fc, cardid);
     PrintAndLogEx(SUCCESS, "Securakey - len: " _GREEN_("%u") " FC: " _GREEN_("0x%X")" Card: " _GREEN_("%u") ", Raw: %08X%08X%08X", bitLen, fc, cardid, raw1, raw2, raw3);
     if (bitLen <= 32)
         PrintAndLogEx(SUCCESS, "Wiegand: " _GREEN_("%08X") " parity ( %s )", (lWiegand << (bitLen / 2)) | rWiegand, parity ? _GREEN_("ok") : _RED_("fail"));
@@ -3170,34 +3170,30 @@ static int CmdT55xxChkPwds(const char *Cmd) {
     }
 
     if ((found == false) && use_pwd_file) {
-        uint32_t keycount = 0;
-        uint8_t *keyblock = NULL;
-
-        res = loadFileDICTIONARY_safe(filename, (void **) &keyblock, 4, &keycount);
-        if (res != PM3_SUCCESS || keycount == 0 || keyblock == NULL) {
+        dictionary_t dict;
+        res = mapFileDICTIONARY(filename, 4, &dict, true);
+        if (res != PM3_SUCCESS || dict.keycnt == 0) {
             PrintAndLogEx(WARNING, "no keys found in file");
-            if (keyblock != NULL)
-                free(keyblock);
-
+            unmapFileDICTIONARY(&dict);
             return PM3_ESOFT;
         }
 
         PrintAndLogEx(INFO, "press " _GREEN_("<Enter>") " to exit");
 
-        for (uint32_t c = 0; c < keycount && found == false; ++c) {
+        for (uint32_t c = 0; c < dict.keycnt && found == false; ++c) {
 
             if (!g_session.pm3_present) {
                 PrintAndLogEx(WARNING, "device offline\n");
-                free(keyblock);
+                unmapFileDICTIONARY(&dict);
                 return PM3_ENODATA;
             }
 
             if (IsCancelled()) {
-                free(keyblock);
+                unmapFileDICTIONARY(&dict);
                 return PM3_EOPABORTED;
             }
 
-            uint32_t curr_password = bytes_to_num(keyblock + 4 * c, 4);
+            uint32_t curr_password = bytes_to_num((uint8_t *)dict.keys + 4 * c, 4);
 
             PrintAndLogEx(INFO, "testing %08"PRIX32, curr_password);
             for (dl_mode = downlink_mode; dl_mode <= 3; dl_mode++) {
@@ -3216,7 +3212,7 @@ static int CmdT55xxChkPwds(const char *Cmd) {
             }
         }
 
-        free(keyblock);
+        unmapFileDICTIONARY(&dict);
     }
 
     if (found == false)
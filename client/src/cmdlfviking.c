@@ -54,6 +54,7 @@ int demodViking(bool verbose) {
     uint32_t raw2 = bytebits_to_byte(g_DemodBuffer + ans + 32, 32);
     uint32_t cardid = bytebits_to_byte(g_DemodBuffer + ans + 24, 32);
     uint8_t  checksum = bytebits_to_byte(g_DemodBuffer + ans + 32 + 24, 8);
+    demod_set_tag_id("%08X", cardid);
     PrintAndLogEx(SUCCESS, "Viking - Card " _GREEN_("%08X") ", Raw: %08X%08X", cardid, raw1, raw2);
     PrintAndLogEx(DEBUG, "Checksum: %02X", checksum);
     setDemodBuff(g_DemodBuffer, 64, ans);
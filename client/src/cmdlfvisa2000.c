@@ -136,6 +136,7 @@ int demodVisa2k(bool verbose) {
         save_restoreGB(GRAPH_RESTORE);
         return PM3_ESOFT;
     }
+    demod_set_tag_id("%u", raw2);
     PrintAndLogEx(SUCCESS, "Visa2000 - Card " _GREEN_("%u") ", Raw: %08X%08X%08X", raw2,  raw1, raw2, raw3);
     return PM3_SUCCESS;
 }
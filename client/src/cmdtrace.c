@@ -34,19 +34,232 @@
 static int CmdHelp(const char *Cmd);
 
 // trace pointer
+// Either heap allocated (downloaded from device) or memory mapped from a trace file.
+// Positions are 32bit so sniff captures larger than the device BigBuf can be listed.
 static uint8_t *gs_trace;
-static uint16_t gs_traceLen = 0;
+static uint32_t gs_traceLen = 0;
+static bool gs_trace_mapped = false;
+
+// Sidecar index <.tidx> written by `trace save --index`.
+// One fixed size entry per record so `trace list` filters can seek
+// straight to matching records without walking the trace.
+#define TRACE_INDEX_MAGIC     "PM3TIDX"
+#define TRACE_INDEX_VERSION   1
+
+typedef struct {
+    char magic[7];
+    uint8_t version;
+    uint32_t count;          // number of entries
+    uint32_t tracelen;       // size of the trace this index belongs to
+} PACKED trace_index_hdr_t;
+
+typedef struct {
+    uint32_t offset;         // record position in trace
+    uint32_t timestamp;
+    uint16_t data_len;
+    uint8_t isResponse;
+    uint8_t cmd;             // first frame byte,  0 for empty frames
+} PACKED trace_index_entry_t;
+
+static uint8_t *gs_traceidx;
+static size_t gs_traceidxLen = 0;
+
+// trace list filters
+typedef struct {
+    bool active;
+    uint32_t start;          // relative to first record
+    uint32_t end;
+    bool reader_only;
+    bool tag_only;
+    bool use_cmd;
+    uint8_t cmd;
+    bool cmd_matched;        // last reader frame matched cmd,  show the answers too
+    uint32_t idx;            // index cursor
+} trace_filter_t;
+
+static void free_trace(void) {
+    if (gs_trace_mapped) {
+        unmapFile(gs_trace, gs_traceLen);
+    } else {
+        free(gs_trace);
+    }
+    gs_trace = NULL;
+    gs_traceLen = 0;
+    gs_trace_mapped = false;
+
+    unmapFile(gs_traceidx, gs_traceidxLen);
+    gs_traceidx = NULL;
+    gs_traceidxLen = 0;
+}
+
+static const trace_index_hdr_t *get_trace_index(void) {
+    return (const trace_index_hdr_t *)gs_traceidx;
+}
+
+static const trace_index_entry_t *get_trace_index_entries(void) {
+    return (const trace_index_entry_t *)(gs_traceidx + sizeof(trace_index_hdr_t));
+}
+
+static bool trace_index_valid(const uint8_t *idx, size_t idxlen, uint32_t traceLen) {
+    if (idx == NULL || idxlen < sizeof(trace_index_hdr_t)) {
+        return false;
+    }
+
+    const trace_index_hdr_t *ih = (const trace_index_hdr_t *)idx;
+    if (memcmp(ih->magic, TRACE_INDEX_MAGIC, sizeof(ih->magic)) != 0 || ih->version != TRACE_INDEX_VERSION) {
+        return false;
+    }
+
+    return (ih->tracelen == traceLen) &&
+           (idxlen == sizeof(trace_index_hdr_t) + ((size_t)ih->count * sizeof(trace_index_entry_t)));
+}
+
+// caller must free the returned buffer
+static int build_trace_index(const uint8_t *trace, uint32_t traceLen, uint8_t **pidx, size_t *pidxlen) {
+
+    uint32_t count = 0;
+    uint32_t tracepos = 0;
+    while (tracepos + TRACELOG_HDR_LEN < traceLen) {
+        const tracelog_hdr_t *hdr = (const tracelog_hdr_t *)(trace + tracepos);
+        tracepos += TRACELOG_HDR_LEN + hdr->data_len + TRACELOG_PARITY_LEN(hdr);
+        if (tracepos > traceLen) {
+            break;
+        }
+        count++;
+    }
+
+    size_t idxlen = sizeof(trace_index_hdr_t) + ((size_t)count * sizeof(trace_index_entry_t));
+    uint8_t *idx = calloc(idxlen, sizeof(uint8_t));
+    if (idx == NULL) {
+        PrintAndLogEx(FAILED, "Cannot allocate memory for trace index");
+        return PM3_EMALLOC;
+    }
+
+    trace_index_hdr_t *ih = (trace_index_hdr_t *)idx;
+    memcpy(ih->magic, TRACE_INDEX_MAGIC, sizeof(ih->magic));
+    ih->version = TRACE_INDEX_VERSION;
+    ih->count = count;
+    ih->tracelen = traceLen;
+
+    trace_index_entry_t *e = (trace_index_entry_t *)(idx + sizeof(trace_index_hdr_t));
+    tracepos = 0;
+    for (uint32_t i = 0; i < count; i++) {
+        const tracelog_hdr_t *hdr = (const tracelog_hdr_t *)(trace + tracepos);
+        e[i].offset = tracepos;
+        e[i].timestamp = hdr->timestamp;
+        e[i].data_len = hdr->data_len;
+        e[i].isResponse = hdr->isResponse;
+        e[i].cmd = (hdr->data_len) ? hdr->frame[0] : 0;
+        tracepos += TRACELOG_HDR_LEN + hdr->data_len + TRACELOG_PARITY_LEN(hdr);
+    }
+
+    *pidx = idx;
+    *pidxlen = idxlen;
+    return PM3_SUCCESS;
+}
+
+// 0 = no match,  1 = match,  2 = no match and no later record can match
+static int trace_filter_match(trace_filter_t *f, uint32_t reltime, bool isResponse, uint16_t data_len, uint8_t cmd) {
 
-static bool is_last_record(uint16_t tracepos, uint16_t traceLen) {
+    // timestamps grow monotonic within a trace
+    if (reltime > f->end) {
+        return 2;
+    }
+
+    if (isResponse == false && f->use_cmd) {
+        f->cmd_matched = (data_len && cmd == f->cmd);
+    }
+
+    if (reltime < f->start) {
+        return 0;
+    }
+
+    if ((f->reader_only && isResponse) || (f->tag_only && isResponse == false)) {
+        return 0;
+    }
+
+    if (f->use_cmd && f->cmd_matched == false) {
+        return 0;
+    }
+
+    return 1;
+}
+
+// returns position of the next record at or after tracepos matching the filter,  traceLen if none
+static uint32_t trace_filter_seek(trace_filter_t *f, uint32_t tracepos, uint32_t traceLen, const uint8_t *trace) {
+
+    if (f->active == false) {
+        return tracepos;
+    }
+
+    if (gs_traceidx) {
+        const trace_index_hdr_t *ih = get_trace_index();
+        const trace_index_entry_t *e = get_trace_index_entries();
+        if (ih->count == 0) {
+            return traceLen;
+        }
+
+        uint32_t first_ts = e[0].timestamp;
+
+        // first seek,  jump to start time.
+        // Command filter needs the preceding reader frame,  step back one record
+        if (f->idx == 0 && f->start) {
+            uint32_t lo = 0, hi = ih->count;
+            while (lo < hi) {
+                uint32_t mid = lo + (hi - lo) / 2;
+                if (e[mid].timestamp - first_ts < f->start)
+                    lo = mid + 1;
+                else
+                    hi = mid;
+            }
+            f->idx = (lo) ? lo - 1 : 0;
+        }
+
+        while (f->idx < ih->count && e[f->idx].offset < tracepos) {
+            f->idx++;
+        }
+
+        for (; f->idx < ih->count; f->idx++) {
+            int res = trace_filter_match(f, e[f->idx].timestamp - first_ts, e[f->idx].isResponse, e[f->idx].data_len, e[f->idx].cmd);
+            if (res == 2) {
+                break;
+            }
+            if (res == 1) {
+                return e[f->idx++].offset;
+            }
+        }
+        return traceLen;
+    }
+
+    uint32_t first_ts = ((const tracelog_hdr_t *)trace)->timestamp;
+
+    while (tracepos + TRACELOG_HDR_LEN < traceLen) {
+        const tracelog_hdr_t *hdr = (const tracelog_hdr_t *)(trace + tracepos);
+        if (tracepos + TRACELOG_HDR_LEN + hdr->data_len + TRACELOG_PARITY_LEN(hdr) > traceLen) {
+            break;
+        }
+        int res = trace_filter_match(f, hdr->timestamp - first_ts, hdr->isResponse, hdr->data_len, (hdr->data_len) ? hdr->frame[0] : 0);
+        if (res == 2) {
+            break;
+        }
+        if (res == 1) {
+            return tracepos;
+        }
+        tracepos += TRACELOG_HDR_LEN + hdr->data_len + TRACELOG_PARITY_LEN(hdr);
+    }
+    return traceLen;
+}
+
+static bool is_last_record(uint32_t tracepos, uint32_t traceLen) {
     return ((tracepos + TRACELOG_HDR_LEN) >= traceLen);
 }
 
-static bool next_record_is_response(uint16_t tracepos, uint8_t *trace) {
+static bool next_record_is_response(uint32_t tracepos, uint8_t *trace) {
     tracelog_hdr_t *hdr = (tracelog_hdr_t *)(trace + tracepos);
     return (hdr->isResponse);
 }
 
-static bool merge_topaz_reader_frames(uint32_t timestamp, uint32_t *duration, uint16_t *tracepos, uint16_t traceLen,
+static bool merge_topaz_reader_frames(uint32_t timestamp, uint32_t *duration, uint32_t *tracepos, uint32_t traceLen,
                                       uint8_t *trace, uint8_t *frame, uint8_t *topaz_reader_command, uint16_t *data_len) {
 
 #define MAX_TOPAZ_READER_CMD_LEN 16
@@ -100,7 +313,7 @@ static uint8_t extract_epurse[8] = {0};
 
 #define SKIP_TO_NEXT(a)  (TRACELOG_HDR_LEN + (a)->data_len + TRACELOG_PARITY_LEN((a)))
 
-static uint16_t extractChall_ev2(uint16_t tracepos, uint8_t *trace, uint8_t cmdpos, uint8_t long_jmp) {
+static uint32_t extractChall_ev2(uint32_t tracepos, uint8_t *trace, uint8_t cmdpos, uint8_t long_jmp) {
     tracelog_hdr_t *next_hdr = (tracelog_hdr_t *)(trace + tracepos);
     if (next_hdr->data_len != 21) {
         return 0;
@@ -122,7 +335,7 @@ static uint16_t extractChall_ev2(uint16_t tracepos, uint8_t *trace, uint8_t cmdp
     return tracepos;
 }
 
-static uint16_t extractChallenges(uint16_t tracepos, uint16_t traceLen, uint8_t *trace) {
+static uint32_t extractChallenges(uint32_t tracepos, uint32_t traceLen, uint8_t *trace) {
 
     // sanity check
     if (is_last_record(tracepos, traceLen)) {
@@ -569,7 +782,7 @@ static uint16_t extractChallenges(uint16_t tracepos, uint16_t traceLen, uint8_t
             }
             case MFDES_AUTHENTICATE_EV2F: {
                 PrintAndLogEx(INFO, "AUTH EV2 First");
-                uint16_t tmp = extractChall_ev2(tracepos, trace, pos, long_jmp);
+                uint32_t tmp = extractChall_ev2(tracepos, trace, pos, long_jmp);
                 if (tmp == 0)
                     break;
                 else
@@ -578,7 +791,7 @@ static uint16_t extractChallenges(uint16_t tracepos, uint16_t traceLen, uint8_t
             }
             case MFDES_AUTHENTICATE_EV2NF: {
                 PrintAndLogEx(INFO, "AUTH EV2 Non First");
-                uint16_t tmp = extractChall_ev2(tracepos, trace, pos, long_jmp);
+                uint32_t tmp = extractChall_ev2(tracepos, trace, pos, long_jmp);
                 if (tmp == 0)
                     break;
                 else
@@ -590,13 +803,13 @@ static uint16_t extractChallenges(uint16_t tracepos, uint16_t traceLen, uint8_t
     return tracepos;
 }
 
-static uint16_t printHexLine(uint16_t tracepos, uint16_t traceLen, uint8_t *trace, uint8_t protocol) {
+static uint32_t printHexLine(uint32_t tracepos, uint32_t traceLen, uint8_t *trace, uint8_t protocol) {
     // sanity check
     if (is_last_record(tracepos, traceLen)) return traceLen;
 
     tracelog_hdr_t *hdr = (tracelog_hdr_t *)(trace + tracepos);
 
-    if (TRACELOG_HDR_LEN + hdr->data_len + TRACELOG_PARITY_LEN(hdr) > traceLen) {
+    if (tracepos + TRACELOG_HDR_LEN + hdr->data_len + TRACELOG_PARITY_LEN(hdr) > traceLen) {
         return traceLen;
     }
 
@@ -608,7 +821,7 @@ static uint16_t printHexLine(uint16_t tracepos, uint16_t traceLen, uint8_t *trac
         return tracepos;
     }
 
-    uint16_t ret;
+    uint32_t ret;
 
     switch (protocol) {
         case ISO_14443A: {
@@ -656,7 +869,7 @@ static uint16_t printHexLine(uint16_t tracepos, uint16_t traceLen, uint8_t *trac
     return ret;
 }
 
-static uint16_t printTraceLine(uint16_t tracepos, uint16_t traceLen, uint8_t *trace, uint8_t protocol, bool showWaitCycles, bool markCRCBytes, uint32_t *prev_eot, bool use_us,
+static uint32_t printTraceLine(uint32_t tracepos, uint32_t traceLen, uint8_t *trace, uint8_t protocol, bool showWaitCycles, bool markCRCBytes, uint32_t *prev_eot, bool use_us,
                                const uint64_t *mfDicKeys, uint32_t mfDicKeysCount) {
     // sanity check
     if (is_last_record(tracepos, traceLen)) {
@@ -729,15 +942,20 @@ static uint16_t printTraceLine(uint16_t tracepos, uint16_t traceLen, uint8_t *tr
                 crcStatus = iso14443A_CRC_check(hdr->isResponse, frame, data_len) == 1 ? 3 : 0;
                 crcStatus = iso14443B_CRC_check(frame, data_len) == 1 ? 4 : crcStatus;
                 break;
-            case THINFILM:
-                frame[data_len - 1] ^= frame[data_len - 2];
-                frame[data_len - 2] ^= frame[data_len - 1];
-                frame[data_len - 1] ^= frame[data_len - 2];
-                crcStatus = iso14443A_CRC_check(true, frame, data_len);
-                frame[data_len - 1] ^= frame[data_len - 2];
-                frame[data_len - 2] ^= frame[data_len - 1];
-                frame[data_len - 1] ^= frame[data_len - 2];
+            case THINFILM: {
+                // frame may point into a read-only mapped trace file,  swap the CRC bytes in a copy.
+                // The check only looks at the first 255 bytes,  longer frames never reach the CRC
+                uint8_t swapped[UINT8_MAX];
+                if (data_len > sizeof(swapped)) {
+                    crcStatus = iso14443A_CRC_check(true, frame, data_len);
+                    break;
+                }
+                memcpy(swapped, frame, data_len);
+                swapped[data_len - 1] = frame[data_len - 2];
+                swapped[data_len - 2] = frame[data_len - 1];
+                crcStatus = iso14443A_CRC_check(true, swapped, data_len);
                 break;
+            }
             case ISO_15693:
                 crcStatus = iso15693_CRC_check(frame, data_len);
                 break;
@@ -1054,10 +1272,7 @@ static int download_trace(void) {
     }
 
     // reserve some space.
-    if (gs_trace)
-        free(gs_trace);
-
-    gs_traceLen = 0;
+    free_trace();
 
     gs_trace = calloc(PM3_CMD_DATA_SIZE, sizeof(uint8_t));
     if (gs_trace == NULL) {
@@ -1071,8 +1286,7 @@ static int download_trace(void) {
     PacketResponseNG response;
     if (!GetFromDevice(BIG_BUF, gs_trace, PM3_CMD_DATA_SIZE, 0, NULL, 0, &response, 4000, true)) {
         PrintAndLogEx(WARNING, "timeout while waiting for reply.");
-        free(gs_trace);
-        gs_trace = NULL;
+        free_trace();
         return PM3_ETIMEOUT;
     }
 
@@ -1081,17 +1295,18 @@ static int download_trace(void) {
     // if tracelog buffer was larger and we need to download more.
     if (gs_traceLen > PM3_CMD_DATA_SIZE) {
 
-        free(gs_trace);
-        gs_trace = calloc(gs_traceLen, sizeof(uint8_t));
-        if (gs_trace == NULL) {
+        // keep the first chunk,  only the remaining part is downloaded
+        uint8_t *tmp = realloc(gs_trace, gs_traceLen);
+        if (tmp == NULL) {
             PrintAndLogEx(FAILED, "Cannot allocate memory for trace");
+            free_trace();
             return PM3_EMALLOC;
         }
+        gs_trace = tmp;
 
-        if (!GetFromDevice(BIG_BUF, gs_trace, gs_traceLen, 0, NULL, 0, NULL, 2500, false)) {
+        if (!GetFromDeviceStream(BIG_BUF, gs_trace + PM3_CMD_DATA_SIZE, gs_traceLen - PM3_CMD_DATA_SIZE, PM3_CMD_DATA_SIZE, NULL, 2500, false, NULL, NULL)) {
             PrintAndLogEx(WARNING, "command execution time out");
-            free(gs_trace);
-            gs_trace = NULL;
+            free_trace();
             return PM3_ETIMEOUT;
         }
     }
@@ -1135,7 +1350,7 @@ static int CmdTraceExtract(const char *Cmd) {
         PrintAndLogEx(SUCCESS, "Recorded trace (len = " _LIGHT_BLUE_("%u") " bytes)", gs_traceLen);
     }
 
-    uint16_t tracepos = 0;
+    uint32_t tracepos = 0;
 
     while (tracepos < gs_traceLen) {
         tracepos = extractChallenges(tracepos, gs_traceLen, gs_trace);
@@ -1168,18 +1383,42 @@ static int CmdTraceLoad(const char *Cmd) {
     CLIParamStrToBuf(arg_get_str(ctx, 1), (uint8_t *)filename, FILE_PATH_SIZE, &fnlen);
     CLIParserFree(ctx);
 
-    if (gs_trace) {
-        free(gs_trace);
-        gs_trace = NULL;
-    }
+    free_trace();
 
+    // map the file instead of reading it,  records are paged in while listing
     size_t len = 0;
-    if (loadFile_safe(filename, ".trace", (void **)&gs_trace, &len) != PM3_SUCCESS) {
+    if (mapFile_safe(filename, ".trace", (void **)&gs_trace, &len) != PM3_SUCCESS) {
         PrintAndLogEx(FAILED, "Could not open file " _YELLOW_("%s"), filename);
         return PM3_EIO;
     }
 
-    gs_traceLen = (long)len;
+    if (len > UINT32_MAX) {
+        PrintAndLogEx(FAILED, "Trace file too large (%zu bytes)", len);
+        unmapFile(gs_trace, len);
+        gs_trace = NULL;
+        return PM3_EOVFLOW;
+    }
+
+    gs_traceLen = (uint32_t)len;
+    gs_trace_mapped = true;
+
+    // pick up sidecar index if there is a matching one
+    char idxname[FILE_PATH_SIZE] = {0};
+    memcpy(idxname, filename, sizeof(idxname));
+    if (str_endswith(idxname, ".trace")) {
+        idxname[strlen(idxname) - strlen(".trace")] = '\0';
+    }
+
+    if (mapFile_safeEx(idxname, ".tidx", (void **)&gs_traceidx, &gs_traceidxLen, false) == PM3_SUCCESS) {
+        if (trace_index_valid(gs_traceidx, gs_traceidxLen, gs_traceLen)) {
+            PrintAndLogEx(SUCCESS, "Trace index loaded (" _YELLOW_("%u") " records)", get_trace_index()->count);
+        } else {
+            PrintAndLogEx(WARNING, "Trace index doesn't match trace, ignoring it");
+            unmapFile(gs_traceidx, gs_traceidxLen);
+            gs_traceidx = NULL;
+            gs_traceidxLen = 0;
+        }
+    }
 
     PrintAndLogEx(SUCCESS, "Recorded Activity (TraceLen = " _YELLOW_("%u") " bytes)", gs_traceLen);
     PrintAndLogEx(HINT, "try " _YELLOW_("`trace list -1 -t ...`") " to view trace.  Remember the " _YELLOW_("`-1`") " param");
@@ -1191,13 +1430,15 @@ static int CmdTraceSave(const char *Cmd) {
     CLIParserContext *ctx;
     CLIParserInit(&ctx, "trace save",
                   "Save protocol data from trace buffer to binary file\n"
-                  "File extension is <.trace>",
-                  "trace save -f mytracefile    -> w/o file extension"
+                  "File extension is <.trace>, index file extension is <.tidx>",
+                  "trace save -f mytracefile    -> w/o file extension\n"
+                  "trace save -f mytracefile -i -> also save record index for filtered listing"
                  );
 
     void *argtable[] = {
         arg_param_begin,
         arg_str1("f", "file", "<fn>", "Specify trace file to save"),
+        arg_lit0("i", "index", "save sidecar record index"),
         arg_param_end
     };
     CLIExecWithReturn(ctx, Cmd, argtable, false);
@@ -1205,6 +1446,7 @@ static int CmdTraceSave(const char *Cmd) {
     int fnlen = 0;
     char filename[FILE_PATH_SIZE] = {0};
     CLIParamStrToBuf(arg_get_str(ctx, 1), (uint8_t *)filename, FILE_PATH_SIZE, &fnlen);
+    bool save_index = arg_get_lit(ctx, 2);
     CLIParserFree(ctx);
 
     if (gs_traceLen == 0) {
@@ -1215,8 +1457,33 @@ static int CmdTraceSave(const char *Cmd) {
         }
     }
 
-    saveFile(filename, ".trace", gs_trace, gs_traceLen);
-    return PM3_SUCCESS;
+    if (save_index == false) {
+        saveFile(filename, ".trace", gs_trace, gs_traceLen);
+        return PM3_SUCCESS;
+    }
+
+    // index must share the name picked for the trace
+    char *fn = newfilenamemcopy(filename, ".trace");
+    if (fn == NULL) {
+        return PM3_EMALLOC;
+    }
+
+    int res = saveFileEx(fn, ".trace", gs_trace, gs_traceLen, true);
+    if (res != PM3_SUCCESS) {
+        free(fn);
+        return res;
+    }
+
+    uint8_t *idx = NULL;
+    size_t idxlen = 0;
+    res = build_trace_index(gs_trace, gs_traceLen, &idx, &idxlen);
+    if (res == PM3_SUCCESS) {
+        fn[strlen(fn) - strlen(".trace")] = '\0';
+        res = saveFileEx(fn, ".tidx", idx, idxlen, true);
+        free(idx);
+    }
+    free(fn);
+    return res;
 }
 
 int CmdTraceListAlias(const char *Cmd, const char *alias, const char *protocol) {
@@ -1246,6 +1513,11 @@ int CmdTraceListAlias(const char *Cmd, const char *alias, const char *protocol)
         arg_lit0("x", NULL, "show hexdump to convert to pcap(ng)\n"
                  "                                   or to import into Wireshark using encapsulation type \"ISO 14443\""),
         arg_str0(NULL, "dict", "<file>", "use dictionary keys file"),
+        arg_u64_0(NULL, "start", "<dec>", "only show frames starting at or after this time"),
+        arg_u64_0(NULL, "end", "<dec>", "only show frames starting at or before this time"),
+        arg_lit0(NULL, "rdr", "only show reader frames"),
+        arg_lit0(NULL, "tag", "only show tag frames"),
+        arg_str0(NULL, "cmd", "<hex>", "only show exchanges starting with this command byte"),
         arg_param_end
     };
     CLIExecWithReturn(ctx, Cmd, argtable, true);
@@ -1284,7 +1556,9 @@ int CmdTraceList(const char *Cmd) {
                   "\n"
                   "trace list -t mf --dict <mfc_default_keys>    -> use dictionary keys file\n"
                   "trace list -t 14a -F                          -> show frame delay times\n"
-                  "trace list -t 14a -1                          -> use trace buffer "
+                  "trace list -t 14a -1                          -> use trace buffer \n"
+                  "trace list -t 14a --cmd 30                    -> only show READBLOCK exchanges\n"
+                  "trace list -t 14a --start 100000 --end 200000 --tag  -> only show tag frames within time range"
                  );
 
     void *argtable[] = {
@@ -1298,6 +1572,11 @@ int CmdTraceList(const char *Cmd) {
                  "                                   or to import into Wireshark using encapsulation type \"ISO 14443\""),
         arg_str0("t", "type", NULL, "protocol to annotate the trace"),
         arg_str0("f", "dict", "<fn>", "use dictionary keys file"),
+        arg_u64_0(NULL, "start", "<dec>", "only show frames starting at or after this time"),
+        arg_u64_0(NULL, "end", "<dec>", "only show frames starting at or before this time"),
+        arg_lit0(NULL, "rdr", "only show reader frames"),
+        arg_lit0(NULL, "tag", "only show tag frames"),
+        arg_str0(NULL, "cmd", "<hex>", "only show exchanges starting with this command byte"),
         arg_param_end
     };
     CLIExecWithReturn(ctx, Cmd, argtable, true);
@@ -1325,8 +1604,31 @@ int CmdTraceList(const char *Cmd) {
         diclen = 0;
     }
 
+    trace_filter_t filter = {0};
+    filter.start = arg_get_u32_def(ctx, 9, 0);
+    filter.end = arg_get_u32_def(ctx, 10, UINT32_MAX);
+    filter.reader_only = arg_get_lit(ctx, 11);
+    filter.tag_only = arg_get_lit(ctx, 12);
+
+    int cmdlen = 0;
+    uint8_t cmd[2] = {0};
+    CLIGetHexWithReturn(ctx, 13, cmd, &cmdlen);
     CLIParserFree(ctx);
 
+    if (cmdlen > 1) {
+        PrintAndLogEx(FAILED, "Command filter must be one byte");
+        return PM3_EINVARG;
+    }
+    filter.use_cmd = (cmdlen == 1);
+    filter.cmd = cmd[0];
+
+    if (filter.reader_only && filter.tag_only) {
+        PrintAndLogEx(FAILED, "Select only one of " _YELLOW_("--rdr") " or " _YELLOW_("--tag"));
+        return PM3_EINVARG;
+    }
+
+    filter.active = (filter.start || filter.end != UINT32_MAX || filter.reader_only || filter.tag_only || filter.use_cmd);
+
     clearCommandBuffer();
 
     // no crc, no annotations
@@ -1369,11 +1671,14 @@ int CmdTraceList(const char *Cmd) {
         return PM3_SUCCESS;
     }
 
-    uint16_t tracepos = 0;
+    uint32_t tracepos = 0;
+
+    if (filter.active) {
+        PrintAndLogEx(INFO, "Filtering records%s", (gs_traceidx) ? " using trace index" : "");
+    }
 
-    
     if (show_hex) {
-        while (tracepos < gs_traceLen) {
+        while ((tracepos = trace_filter_seek(&filter, tracepos, gs_traceLen, gs_trace)) < gs_traceLen) {
             tracepos = printHexLine(tracepos, gs_traceLen, gs_trace, protocol);
         }
     } else {
@@ -1476,7 +1781,7 @@ int CmdTraceList(const char *Cmd) {
             prev_EOT = &previous_EOT;
         }
 
-        while (tracepos < gs_traceLen) {
+        while ((tracepos = trace_filter_seek(&filter, tracepos, gs_traceLen, gs_trace)) < gs_traceLen) {
             tracepos = printTraceLine(tracepos, gs_traceLen, gs_trace, protocol, show_wait_cycles, mark_crc, prev_EOT, use_us, dicKeys, dicKeysCount);
 
             if (kbd_enter_pressed())
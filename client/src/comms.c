@@ -22,6 +22,7 @@
 #include <string.h>
 #include <stdio.h>
 #include <stdlib.h>
+#include <sys/time.h>
 
 #include "uart/uart.h"
 #include "ui.h"
@@ -52,16 +53,26 @@ static pthread_cond_t txBufferSig = PTHREAD_COND_INITIALIZER;
 
 // Used by PacketResponseReceived as a ring buffer for messages that are yet to be
 // processed by a command handler (WaitForResponse{,Timeout})
-static PacketResponseNG rxBuffer[CMD_BUFFER_SIZE];
+// Starts with CMD_BUFFER_SIZE slots and grows instead of overwriting unread replies.
+static PacketResponseNG *rxBuffer = NULL;
+static size_t rxBufferSize = 0;
 
 // Points to the next empty position to write to
-static int cmd_head = 0;
+static size_t cmd_head = 0;
 
 // Points to the position of the last unread command
-static int cmd_tail = 0;
+static size_t cmd_tail = 0;
 
 // to lock rxBuffer operations from different threads
 static pthread_mutex_t rxBufferMutex = PTHREAD_MUTEX_INITIALIZER;
+// signaled by storeReply when a reply the waiting thread cares about got stored
+static pthread_cond_t rxBufferSig = PTHREAD_COND_INITIALIZER;
+// command the waiting thread is waiting for, CMD_UNKNOWN wakes up on any reply
+static uint32_t rx_wait_cmd = CMD_UNKNOWN;
+static bool rx_waiting = false;
+
+// upper bound for a single wait on rxBufferSig,  timeouts are re-evaluated in between
+#define RX_WAIT_SLICE_MS 100
 
 // Global start time for WaitForResponseTimeout & dl_it, so we can reset timeout when we get packets
 // as sending lot of these packets can slow down things wuite a lot on slow links (e.g. hw status or lf read at 9600)
@@ -221,18 +232,38 @@ void clearCommandBuffer(void) {
  */
 static void storeReply(PacketResponseNG *packet) {
     pthread_mutex_lock(&rxBufferMutex);
-    if ((cmd_head + 1) % CMD_BUFFER_SIZE == cmd_tail) {
-        //If these two are equal, we're about to overwrite in the
-        // circular buffer.
-        PrintAndLogEx(FAILED, "WARNING: Command buffer about to overwrite command! This needs to be fixed!");
-        fflush(stdout);
+    if (rxBufferSize == 0 || (cmd_head + 1) % rxBufferSize == cmd_tail) {
+        // If these two are equal, we're about to overwrite in the
+        // circular buffer. Grow it and unwrap the unread replies instead.
+        size_t newsize = (rxBufferSize == 0) ? CMD_BUFFER_SIZE : rxBufferSize * 2;
+        PacketResponseNG *tmp = calloc(newsize, sizeof(PacketResponseNG));
+        if (tmp == NULL) {
+            PrintAndLogEx(FAILED, "WARNING: Command buffer full, dropping reply 0x%04x", packet->cmd);
+            pthread_mutex_unlock(&rxBufferMutex);
+            return;
+        }
+
+        size_t n = 0;
+        for (size_t i = cmd_tail; i != cmd_head; i = (i + 1) % rxBufferSize) {
+            memcpy(&tmp[n++], &rxBuffer[i], sizeof(PacketResponseNG));
+        }
+        free(rxBuffer);
+        rxBuffer = tmp;
+        rxBufferSize = newsize;
+        cmd_tail = 0;
+        cmd_head = n;
     }
     //Store the command at the 'head' location
     PacketResponseNG *destination = &rxBuffer[cmd_head];
     memcpy(destination, packet, sizeof(PacketResponseNG));
 
     //increment head and wrap
-    cmd_head = (cmd_head + 1) % CMD_BUFFER_SIZE;
+    cmd_head = (cmd_head + 1) % rxBufferSize;
+
+    // wake the waiter only for replies it can act on
+    if (rx_waiting && (rx_wait_cmd == CMD_UNKNOWN || packet->cmd == rx_wait_cmd || packet->cmd == CMD_WTX)) {
+        pthread_cond_signal(&rxBufferSig);
+    }
     pthread_mutex_unlock(&rxBufferMutex);
 }
 /**
@@ -252,12 +283,46 @@ static int getReply(PacketResponseNG *packet) {
     memcpy(packet, &rxBuffer[cmd_tail], sizeof(PacketResponseNG));
 
     //Increment tail - this is a circular buffer, so modulo buffer size
-    cmd_tail = (cmd_tail + 1) % CMD_BUFFER_SIZE;
+    cmd_tail = (cmd_tail + 1) % rxBufferSize;
 
     pthread_mutex_unlock(&rxBufferMutex);
     return 1;
 }
 
+/**
+ * @brief waitReply gets the next command from the internal circular buffer,  if it is empty
+ * sleeps until storeReply signals a reply for cmd (or any reply for CMD_UNKNOWN) or ms elapsed.
+ * Replies for other commands are still returned in order, they just don't wake us up early.
+ * @param packet location to write command
+ * @param cmd command the caller is waiting for
+ * @param ms maximum time to wait in milliseconds
+ * @return 1 if response was returned, 0 if nothing has been received
+ */
+static int waitReply(PacketResponseNG *packet, uint32_t cmd, uint32_t ms) {
+    pthread_mutex_lock(&rxBufferMutex);
+
+    if (cmd_head == cmd_tail && ms) {
+        struct timeval now;
+        gettimeofday(&now, NULL);
+        uint64_t ns = ((uint64_t)now.tv_usec * 1000) + ((uint64_t)ms * 1000000);
+        struct timespec deadline = {
+            .tv_sec = now.tv_sec + (ns / 1000000000),
+            .tv_nsec = ns % 1000000000
+        };
+
+        rx_wait_cmd = cmd;
+        rx_waiting = true;
+        int res = 0;
+        while (cmd_head == cmd_tail && res == 0) {
+            res = pthread_cond_timedwait(&rxBufferSig, &rxBufferMutex, &deadline);
+        }
+        rx_waiting = false;
+    }
+    pthread_mutex_unlock(&rxBufferMutex);
+
+    return getReply(packet);
+}
+
 //-----------------------------------------------------------------------------
 // Entry point into our code: called whenever we received a packet over USB
 // that we weren't necessarily expecting, for example a debug print.
@@ -746,9 +811,10 @@ bool WaitForResponseTimeoutW(uint32_t cmd, PacketResponseNG *response, size_t ms
     __atomic_store_n(&timeout_start_time,  msclock(), __ATOMIC_SEQ_CST);
 
     // Wait until the command is received
+    uint32_t slice = RX_WAIT_SLICE_MS;
     while (true) {
 
-        while (getReply(response)) {
+        while (waitReply(response, cmd, slice)) {
             if (cmd == CMD_UNKNOWN || response->cmd == cmd) {
                 return true;
             }
@@ -761,17 +827,20 @@ bool WaitForResponseTimeoutW(uint32_t cmd, PacketResponseNG *response, size_t ms
         }
 
         uint64_t tmp_clk = __atomic_load_n(&timeout_start_time, __ATOMIC_SEQ_CST);
-        if ((ms_timeout != (size_t) - 1) && (msclock() - tmp_clk > ms_timeout))
+        uint64_t elapsed = msclock() - tmp_clk;
+        if ((ms_timeout != (size_t) - 1) && (elapsed > ms_timeout))
             break;
 
+        // don't sleep past the timeout
+        if (ms_timeout != (size_t) - 1)
+            slice = MIN(RX_WAIT_SLICE_MS, ms_timeout - elapsed + 1);
+
         if (msclock() - tmp_clk > 3000 && show_warning) {
             // 3 seconds elapsed (but this doesn't mean the timeout was exceeded)
 //            PrintAndLogEx(INFO, "Waiting for a response from the Proxmark3...");
             PrintAndLogEx(INFO, "You can cancel this operation by pressing the pm3 button");
             show_warning = false;
         }
-        // just to avoid CPU busy loop:
-        msleep(10);
     }
     return false;
 }
@@ -841,6 +910,160 @@ bool GetFromDevice(DeviceMemType_t memtype, uint8_t *dest, uint32_t bytes, uint3
     return false;
 }
 
+// Pipelined download segments.
+// The device answers download requests one after another, so queuing the next
+// request before the current one is finished keeps the link busy instead of
+// idling one round trip per segment.  Keep the queue short, the device only
+// buffers a few incoming commands while it is sending.
+#define DL_SEGMENT_SIZE         (16 * PM3_CMD_DATA_SIZE)
+#define DL_SEGMENTS_IN_FLIGHT   2
+
+/**
+* Pipelined data transfer from Proxmark to client. Works like GetFromDevice()
+* but splits the transfer in segments, keeps several segment requests queued on
+* the device and hands every chunk to callback as soon as it is received.
+* Memory types without segment support are downloaded in one go and handed
+* over as a single chunk.
+* @brief GetFromDeviceStream
+* @param memtype Type of memory to download from proxmark
+* @param dest Destination address for transfer
+* @param bytes number of bytes to be transferred
+* @param start_index offset into Proxmark3 BigBuf[]
+* @param response struct to copy last command (CMD_ACK) into
+* @param ms_timeout timeout in milliseconds, restarted on every received packet
+* @param show_warning display message after 3 seconds
+* @param callback called for every received chunk, can be NULL
+* @param ctx passed to callback
+* @return true if all data was transferred, otherwise false
+*/
+bool GetFromDeviceStream(DeviceMemType_t memtype, uint8_t *dest, uint32_t bytes, uint32_t start_index, PacketResponseNG *response, size_t ms_timeout, bool show_warning, download_cb_t callback, void *ctx) {
+
+    if (dest == NULL) return false;
+    if (bytes == 0) return true;
+
+    PacketResponseNG resp;
+    if (response == NULL)
+        response = &resp;
+
+    uint32_t snd_cmd, rec_cmd;
+    switch (memtype) {
+        case BIG_BUF: {
+            snd_cmd = CMD_DOWNLOAD_BIGBUF;
+            rec_cmd = CMD_DOWNLOADED_BIGBUF;
+            break;
+        }
+        case BIG_BUF_EML: {
+            snd_cmd = CMD_DOWNLOAD_EML_BIGBUF;
+            rec_cmd = CMD_DOWNLOADED_EML_BIGBUF;
+            break;
+        }
+        case SPIFFS:
+        case FLASH_MEM:
+        case SIM_MEM:
+        case FPGA_MEM: {
+            if (GetFromDevice(memtype, dest, bytes, start_index, NULL, 0, response, ms_timeout, show_warning) == false)
+                return false;
+            if (callback != NULL)
+                return callback(dest, 0, bytes, response, ctx);
+            return true;
+        }
+        default:
+            return false;
+    }
+
+    // clear
+    clearCommandBuffer();
+
+    uint32_t segments = (bytes + DL_SEGMENT_SIZE - 1) / DL_SEGMENT_SIZE;
+    uint32_t sent = 0;          // segments requested
+    uint32_t done = 0;          // segments acknowledged
+    uint32_t seg_completed = 0; // bytes received of the oldest outstanding segment
+    bool have_ack = false;
+    bool aborted = false;
+
+    while (sent < segments && sent - done < DL_SEGMENTS_IN_FLIGHT) {
+        uint32_t seg_len = MIN(bytes - sent * DL_SEGMENT_SIZE, DL_SEGMENT_SIZE);
+        SendCommandMIX(snd_cmd, start_index + sent * DL_SEGMENT_SIZE, seg_len, 0, NULL, 0);
+        sent++;
+    }
+
+    __atomic_store_n(&timeout_start_time,  msclock(), __ATOMIC_SEQ_CST);
+
+    // Add delay depending on the communication channel & speed
+    if (ms_timeout != (size_t) - 1)
+        ms_timeout += communication_delay();
+
+    while (done < sent) {
+
+        if (waitReply(&resp, CMD_UNKNOWN, RX_WAIT_SLICE_MS)) {
+
+            // replies always belong to the oldest outstanding segment
+            uint32_t seg_start = done * DL_SEGMENT_SIZE;
+            uint32_t seg_len = MIN(bytes - seg_start, DL_SEGMENT_SIZE);
+
+            if (resp.cmd == CMD_ACK) {
+                memcpy(response, &resp, sizeof(PacketResponseNG));
+                have_ack = true;
+                done++;
+                seg_completed = 0;
+
+                if (aborted == false && sent < segments) {
+                    uint32_t next_len = MIN(bytes - sent * DL_SEGMENT_SIZE, DL_SEGMENT_SIZE);
+                    SendCommandMIX(snd_cmd, start_index + sent * DL_SEGMENT_SIZE, next_len, 0, NULL, 0);
+                    sent++;
+                }
+                continue;
+            }
+
+            // arg0 = offset in segment
+            // arg1 = length bytes in this chunk
+            if (resp.cmd == rec_cmd) {
+
+                uint32_t offset = resp.oldarg[0];
+                uint32_t copy_bytes = MIN(seg_len - seg_completed, resp.oldarg[1]);
+                copy_bytes = MIN(copy_bytes, PM3_CMD_DATA_SIZE);
+
+                if (offset + copy_bytes > seg_len) {
+                    PrintAndLogEx(FAILED, "ERROR: Out of bounds when downloading from device,  offset %u | len %u | total len %u > buf_size %u", seg_start + offset, copy_bytes, seg_start + offset + copy_bytes, bytes);
+                    break;
+                }
+
+                // keep draining the queued segments after an abort, but stop copying
+                if (aborted)
+                    continue;
+
+                memcpy(dest + seg_start + offset, resp.data.asBytes, copy_bytes);
+                seg_completed += copy_bytes;
+
+                if (callback != NULL && callback(dest + seg_start + offset, seg_start + offset, copy_bytes, have_ack ? response : NULL, ctx) == false) {
+                    aborted = true;
+                }
+
+            } else if (resp.cmd == CMD_WTX && resp.length == sizeof(uint16_t)) {
+                uint16_t wtx = resp.data.asDwords[0] & 0xFFFF;
+                PrintAndLogEx(DEBUG, "Got Waiting Time eXtension request %i ms", wtx);
+                if (ms_timeout != (size_t) - 1)
+                    ms_timeout += wtx;
+            }
+        }
+
+        uint64_t tmp_clk = __atomic_load_n(&timeout_start_time, __ATOMIC_SEQ_CST);
+        if (msclock() - tmp_clk > ms_timeout) {
+            PrintAndLogEx(FAILED, "Timed out while trying to download data from device");
+            return false;
+        }
+
+        if (msclock() - tmp_clk > 3000 && show_warning) {
+            // 3 seconds elapsed (but this doesn't mean the timeout was exceeded)
+            PrintAndLogEx(INFO, "Waiting for a response from the Proxmark3...");
+            PrintAndLogEx(INFO, "You can cancel this operation by pressing the pm3 button");
+            show_warning = false;
+        }
+    }
+
+    return (done == segments) && (aborted == false);
+}
+
 static bool dl_it(uint8_t *dest, uint32_t bytes, PacketResponseNG *response, size_t ms_timeout, bool show_warning, uint32_t rec_cmd) {
 
     uint32_t bytes_completed = 0;
@@ -852,7 +1075,7 @@ static bool dl_it(uint8_t *dest, uint32_t bytes, PacketResponseNG *response, siz
 
     while (true) {
 
-        if (getReply(response)) {
+        if (waitReply(response, CMD_UNKNOWN, RX_WAIT_SLICE_MS)) {
 
             if (response->cmd == CMD_ACK)
                 return true;
@@ -95,6 +95,13 @@ bool WaitForResponse(uint32_t cmd, PacketResponseNG *response);
 //bool GetFromDevice(DeviceMemType_t memtype, uint8_t *dest, uint32_t bytes, uint32_t start_index, PacketResponseNG *response, size_t ms_timeout, bool show_warning);
 bool GetFromDevice(DeviceMemType_t memtype, uint8_t *dest, uint32_t bytes, uint32_t start_index, uint8_t *data, uint32_t datalen, PacketResponseNG *response, size_t ms_timeout, bool show_warning);
 
+// Called by GetFromDeviceStream() for every chunk, in order, as soon as it arrived.
+// The chunk is already copied to dest + offset, data points to it.
+// ack is the last CMD_ACK received so far, NULL until the first segment is completed.
+// Return false to abort the download.
+typedef bool (*download_cb_t)(const uint8_t *data, uint32_t offset, uint32_t len, const PacketResponseNG *ack, void *ctx);
+bool GetFromDeviceStream(DeviceMemType_t memtype, uint8_t *dest, uint32_t bytes, uint32_t start_index, PacketResponseNG *response, size_t ms_timeout, bool show_warning, download_cb_t callback, void *ctx);
+
 #ifdef __cplusplus
 }
 #endif
@@ -29,10 +29,16 @@
 #include "cmdhficlass.h"  // pagemap
 #include "protocols.h"    // iclass defines
 #include "cmdhftopaz.h"   // TOPAZ defines
+#include "crc64.h"
 
 #ifdef _WIN32
 #include "scandir.h"
 #include <direct.h>
+#include <windows.h>
+#else
+#include <sys/mman.h>
+#include <fcntl.h>
+#include <unistd.h>
 #endif
 
 #define PATH_MAX_LENGTH 200
@@ -271,9 +277,18 @@ char *newfilenamemcopy(const char *preferredName, const char *suffix) {
 }
 
 int saveFile(const char *preferredName, const char *suffix, const void *data, size_t datalen) {
+    return saveFileEx(preferredName, suffix, data, datalen, false);
+}
+
+int saveFileEx(const char *preferredName, const char *suffix, const void *data, size_t datalen, bool overwrite) {
 
     if (data == NULL) return PM3_EINVARG;
-    char *fileName = newfilenamemcopy(preferredName, suffix);
+    char *fileName = NULL;
+    if (overwrite)
+        fileName = filenamemcopy(preferredName, suffix);
+    else
+        fileName = newfilenamemcopy(preferredName, suffix);
+
     if (fileName == NULL) return PM3_EMALLOC;
 
     /* We should have a valid filename now, e.g. dumpdata-3.bin */
@@ -928,6 +943,99 @@ int loadFile_safeEx(const char *preferredName, const char *suffix, void **pdata,
     return PM3_SUCCESS;
 }
 
+int mapFile_safe(const char *preferredName, const char *suffix, void **pdata, size_t *datalen) {
+    return mapFile_safeEx(preferredName, suffix, pdata, datalen, true);
+}
+int mapFile_safeEx(const char *preferredName, const char *suffix, void **pdata, size_t *datalen, bool verbose) {
+
+    char *path;
+    int res = searchFile(&path, RESOURCES_SUBDIR, preferredName, suffix, verbose == false);
+    if (res != PM3_SUCCESS) {
+        return PM3_EFILE;
+    }
+
+    res = mapFilePath(path, pdata, datalen);
+    if (res == PM3_SUCCESS && verbose) {
+        PrintAndLogEx(SUCCESS, "mapped " _YELLOW_("%zu") " bytes from binary file " _YELLOW_("%s"), *datalen, preferredName);
+    }
+    free(path);
+    return res;
+}
+
+int mapFilePath(const char *path, void **pdata, size_t *datalen) {
+
+    *pdata = NULL;
+    *datalen = 0;
+
+#ifdef _WIN32
+    HANDLE hfile = CreateFileA(path, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+    if (hfile == INVALID_HANDLE_VALUE) {
+        PrintAndLogEx(WARNING, "file not found or locked. '" _YELLOW_("%s")"'", path);
+        return PM3_EFILE;
+    }
+
+    LARGE_INTEGER fsize;
+    if (GetFileSizeEx(hfile, &fsize) == 0 || fsize.QuadPart <= 0 || (uint64_t)fsize.QuadPart > SIZE_MAX) {
+        PrintAndLogEx(FAILED, "error, when getting filesize");
+        CloseHandle(hfile);
+        return PM3_EFILE;
+    }
+
+    HANDLE hmap = CreateFileMappingA(hfile, NULL, PAGE_READONLY, 0, 0, NULL);
+    CloseHandle(hfile);
+    if (hmap == NULL) {
+        PrintAndLogEx(FAILED, "error, cannot map file");
+        return PM3_EFILE;
+    }
+
+    // the view keeps the mapping object alive
+    void *p = MapViewOfFile(hmap, FILE_MAP_READ, 0, 0, 0);
+    CloseHandle(hmap);
+    if (p == NULL) {
+        PrintAndLogEx(FAILED, "error, cannot map file");
+        return PM3_EFILE;
+    }
+    *datalen = (size_t)fsize.QuadPart;
+#else
+    int fd = open(path, O_RDONLY);
+    if (fd < 0) {
+        PrintAndLogEx(WARNING, "file not found or locked. '" _YELLOW_("%s")"'", path);
+        return PM3_EFILE;
+    }
+
+    struct stat st;
+    if (fstat(fd, &st) != 0 || st.st_size <= 0) {
+        PrintAndLogEx(FAILED, "error, when getting filesize");
+        close(fd);
+        return PM3_EFILE;
+    }
+
+    // MAP_SHARED, clean pages are shared between processes mapping the same file
+    void *p = mmap(NULL, st.st_size, PROT_READ, MAP_SHARED, fd, 0);
+    close(fd);
+    if (p == MAP_FAILED) {
+        PrintAndLogEx(FAILED, "error, cannot map file");
+        return PM3_EFILE;
+    }
+    *datalen = st.st_size;
+#endif
+
+    *pdata = p;
+    return PM3_SUCCESS;
+}
+
+void unmapFile(void *data, size_t datalen) {
+    if (data == NULL) {
+        return;
+    }
+#ifdef _WIN32
+    (void)datalen;
+    UnmapViewOfFile(data);
+#else
+    munmap(data, datalen);
+#endif
+}
+
 int loadFileEML(const char *preferredName, void *data, size_t *datalen) {
 
     if (data == NULL) return PM3_EINVARG;
@@ -1475,14 +1583,23 @@ out:
     return retval;
 }
 
-int loadFileDICTIONARY_safe(const char *preferredName, void **pdata, uint8_t keylen, uint32_t *keycnt) {
-
-    int retval = PM3_SUCCESS;
-
-    char *path;
-    if (searchFile(&path, DICTIONARIES_SUBDIR, preferredName, ".dic", false) != PM3_SUCCESS)
-        return PM3_EFILE;
-
+// Compiled dictionaries,  CACHE_SUBDIR/<name>-<keylen>-<path hash>.dicc
+// header followed by keycnt keys of keylen bytes
+#define DICT_CACHE_MAGIC   0x44334d50 // "PM3D"
+#define DICT_CACHE_VERSION 1
+
+typedef struct {
+    uint32_t magic;
+    uint16_t version;
+    uint8_t keylen;
+    uint8_t reserved;
+    uint32_t keycnt;
+    uint64_t src_size;
+    int64_t src_mtime;
+    uint64_t src_crc;   // crc64 of the textfile
+} PACKED dict_cache_header_t;
+
+static uint8_t dict_keylen(uint8_t keylen) {
     // t5577 == 4bytes
     // mifare == 6 bytes
     // mf plus == 16 bytes
@@ -1492,53 +1609,38 @@ int loadFileDICTIONARY_safe(const char *preferredName, void **pdata, uint8_t key
     if (keylen != 4 && keylen != 6 && keylen != 8 && keylen != 16 && keylen != 24) {
         keylen = 6;
     }
+    return keylen;
+}
 
-    size_t mem_size;
-    size_t block_size = 10 * keylen;
-
-    // double up since its chars
-    keylen <<= 1;
-
-    char line[255];
-
-    // allocate some space for the dictionary
-    *pdata = calloc(block_size, sizeof(uint8_t));
-    if (*pdata == NULL) {
-        free(path);
-        return PM3_EFILE;
-    }
-    mem_size = block_size;
+// parse the textfile,  line by line like loadFileDICTIONARYEx does
+static int dict_parse(const char *text, size_t textlen, uint8_t keylen, uint8_t **pkeys, uint32_t *keycnt) {
 
-    FILE *f = fopen(path, "r");
-    if (!f) {
-        PrintAndLogEx(WARNING, "file not found or locked. '" _YELLOW_("%s")"'", path);
-        retval = PM3_EFILE;
-        goto out;
+    size_t hexlen = keylen << 1;
+    size_t mem_size = 1024 * keylen;
+    uint8_t *keys = calloc(mem_size, sizeof(uint8_t));
+    if (keys == NULL) {
+        return PM3_EMALLOC;
     }
 
-    // read file
-    while (fgets(line, sizeof(line), f)) {
-
-        // check if we have enough space (if not allocate more)
-        if ((*keycnt * (keylen >> 1)) >= mem_size) {
-
-            mem_size += block_size;
-            *pdata = realloc(*pdata, mem_size);
+    uint32_t cnt = 0;
+    char line[255];
+    size_t pos = 0;
+    while (pos < textlen) {
 
-            if (*pdata == NULL) {
-                retval = PM3_EFILE;
-                fclose(f);
-                goto out;
-            } else {
-                memset((uint8_t *)*pdata + (mem_size - block_size), 0, block_size);
+        size_t n = 0;
+        while (pos < textlen && n < sizeof(line) - 1) {
+            line[n++] = text[pos++];
+            if (line[n - 1] == '\n') {
+                break;
             }
         }
+        line[n] = 0;
 
         // add null terminator
-        line[keylen] = 0;
+        line[hexlen] = 0;
 
         // smaller keys than expected is skipped
-        if (strlen(line) < keylen)
+        if (strlen(line) < hexlen)
             continue;
 
         // The line start with # is comment, skip
@@ -1548,20 +1650,302 @@ int loadFileDICTIONARY_safe(const char *preferredName, void **pdata, uint8_t key
         if (!CheckStringIsHEXValue(line))
             continue;
 
-        uint64_t key = strtoull(line, NULL, 16);
+        if ((cnt + 1) * (size_t)keylen > mem_size) {
+            mem_size <<= 1;
+            uint8_t *tmp = realloc(keys, mem_size);
+            if (tmp == NULL) {
+                free(keys);
+                return PM3_EMALLOC;
+            }
+            keys = tmp;
+        }
 
-        num_to_bytes(key, keylen >> 1, (uint8_t *)*pdata + (*keycnt * (keylen >> 1)));
+        if (hex_to_bytes(line, keys + cnt * keylen, keylen) != keylen)
+            continue;
 
-        (*keycnt)++;
+        cnt++;
+    }
 
-        memset(line, 0, sizeof(line));
+    *pkeys = keys;
+    *keycnt = cnt;
+    return PM3_SUCCESS;
+}
+
+uint32_t dedupDICTIONARY(uint8_t *keys, uint32_t keycnt, uint8_t keylen) {
+
+    size_t tsize = 1;
+    while (tsize < (size_t)keycnt * 2) {
+        tsize <<= 1;
+    }
+
+    // open addressing,  slot holds index + 1 of a kept key
+    uint32_t *table = calloc(tsize, sizeof(uint32_t));
+    if (table == NULL) {
+        return keycnt;
+    }
+
+    uint32_t kept = 0;
+    for (uint32_t i = 0; i < keycnt; i++) {
+        const uint8_t *key = keys + (size_t)i * keylen;
+
+        // fnv-1a
+        uint64_t h = 0xcbf29ce484222325ULL;
+        for (uint8_t j = 0; j < keylen; j++) {
+            h = (h ^ key[j]) * 0x100000001b3ULL;
+        }
+
+        size_t slot = h & (tsize - 1);
+        bool dup = false;
+        while (table[slot]) {
+            if (memcmp(keys + (size_t)(table[slot] - 1) * keylen, key, keylen) == 0) {
+                dup = true;
+                break;
+            }
+            slot = (slot + 1) & (tsize - 1);
+        }
+        if (dup) {
+            continue;
+        }
+
+        if (kept != i) {
+            memcpy(keys + (size_t)kept * keylen, key, keylen);
+        }
+        table[slot] = ++kept;
+    }
+    free(table);
+    return kept;
+}
+
+static bool dict_cache_usable(const void *map, size_t maplen, uint8_t keylen) {
+    if (maplen < sizeof(dict_cache_header_t)) {
+        return false;
+    }
+    const dict_cache_header_t *hdr = (const dict_cache_header_t *)map;
+    return hdr->magic == DICT_CACHE_MAGIC
+           && hdr->version == DICT_CACHE_VERSION
+           && hdr->keylen == keylen
+           && maplen == sizeof(dict_cache_header_t) + (size_t)hdr->keycnt * keylen;
+}
+
+int saveFileCache(const char *path, const void *header, size_t headerlen, const void *data, size_t datalen) {
+
+    size_t tmplen = strlen(path) + 5;
+    char *tmppath = calloc(tmplen, sizeof(char));
+    if (tmppath == NULL) {
+        return PM3_EMALLOC;
+    }
+    snprintf(tmppath, tmplen, "%s.tmp", path);
+
+    FILE *f = fopen(tmppath, "wb");
+    if (f == NULL) {
+        free(tmppath);
+        return PM3_EFILE;
+    }
+
+    bool ok = (headerlen == 0 || fwrite(header, headerlen, 1, f) == 1)
+              && (datalen == 0 || fwrite(data, datalen, 1, f) == 1);
+    ok = (fclose(f) == 0) && ok;
+
+    // write aside and move in place,  readers never see a half written file
+#ifdef _WIN32
+    if (ok) {
+        remove(path);
+    }
+#endif
+    if (ok == false || rename(tmppath, path) != 0) {
+        remove(tmppath);
+        free(tmppath);
+        return PM3_EFILE;
+    }
+    free(tmppath);
+    return PM3_SUCCESS;
+}
+
+// textfile was touched without changing,  remember the new time so the content isn't compared again
+static void dict_cache_touch(const char *cachepath, int64_t mtime) {
+    FILE *f = fopen(cachepath, "r+b");
+    if (f == NULL) {
+        return;
+    }
+    if (fseek(f, offsetof(dict_cache_header_t, src_mtime), SEEK_SET) == 0) {
+        fwrite(&mtime, sizeof(mtime), 1, f);
     }
     fclose(f);
-    PrintAndLogEx(SUCCESS, "loaded " _GREEN_("%2d") " keys from dictionary file " _YELLOW_("%s"), *keycnt, path);
+}
+
+// where the compiled form of the textfile at path goes,  NULL if there is no user directory
+static char *dict_cache_path(const char *path, uint8_t keylen) {
+
+    const char *name = strrchr(path, '/');
+    name = (name) ? name + 1 : path;
+
+    uint64_t h = 0;
+    crc64((const uint8_t *)path, strlen(path), &h);
+
+    char filename[FILE_PATH_SIZE];
+    snprintf(filename, sizeof(filename), "%.*s-%u-%016" PRIx64 ".dicc", (int)MIN(strlen(name), 64), name, keylen, h);
+
+    char *cachepath = NULL;
+    if (searchHomeFilePath(&cachepath, CACHE_SUBDIR, filename, true) != PM3_SUCCESS) {
+        return NULL;
+    }
+    return cachepath;
+}
+
+int mapFileDICTIONARY(const char *preferredName, uint8_t keylen, dictionary_t *dict, bool verbose) {
+
+    memset(dict, 0, sizeof(dictionary_t));
+    keylen = dict_keylen(keylen);
+
+    char *path;
+    if (searchFile(&path, DICTIONARIES_SUBDIR, preferredName, ".dic", false) != PM3_SUCCESS)
+        return PM3_EFILE;
+
+#ifdef _WIN32
+    struct _stat st;
+    int result = _stat(path, &st);
+#else
+    struct stat st;
+    int result = stat(path, &st);
+#endif
+    if (result != 0) {
+        PrintAndLogEx(WARNING, "file not found or locked. '" _YELLOW_("%s")"'", path);
+        free(path);
+        return PM3_EFILE;
+    }
+
+    dict->keylen = keylen;
+
+    char *cachepath = dict_cache_path(path, keylen);
+
+    // textfile map,  only needed when the compiled form is stale
+    void *text = NULL;
+    size_t textlen = 0;
+    uint64_t text_crc = 0;
+    bool text_loaded = false;
+
+    if (cachepath && fileExists(cachepath)) {
+        void *map = NULL;
+        size_t maplen = 0;
+        if (mapFilePath(cachepath, &map, &maplen) == PM3_SUCCESS) {
+
+            const dict_cache_header_t *hdr = (const dict_cache_header_t *)map;
+            bool fresh = dict_cache_usable(map, maplen, keylen) && hdr->src_size == (uint64_t)st.st_size;
+
+            // touched but maybe not changed,  compare content
+            if (fresh && hdr->src_mtime != (int64_t)st.st_mtime) {
+                fresh = false;
+                if (st.st_size > 0 && mapFilePath(path, &text, &textlen) == PM3_SUCCESS) {
+                    crc64(text, textlen, &text_crc);
+                    text_loaded = true;
+                    fresh = (text_crc == hdr->src_crc);
+                }
+            }
+
+            if (fresh) {
+                if (text_loaded) {
+                    dict_cache_touch(cachepath, st.st_mtime);
+                }
+                dict->map = map;
+                dict->maplen = maplen;
+                dict->keys = (const uint8_t *)map + sizeof(dict_cache_header_t);
+                dict->keycnt = hdr->keycnt;
+                unmapFile(text, textlen);
+                goto out;
+            }
+            unmapFile(map, maplen);
+        }
+    }
+
+    // (re)compile
+    if (text_loaded == false && st.st_size > 0) {
+        if (mapFilePath(path, &text, &textlen) != PM3_SUCCESS) {
+            free(cachepath);
+            free(path);
+            return PM3_EFILE;
+        }
+        crc64(text, textlen, &text_crc);
+    }
+
+    uint8_t *keys = NULL;
+    uint32_t keycnt = 0;
+    int res = dict_parse(text, textlen, keylen, &keys, &keycnt);
+    unmapFile(text, textlen);
+    if (res != PM3_SUCCESS) {
+        PrintAndLogEx(WARNING, "Failed to allocate memory");
+        free(cachepath);
+        free(path);
+        return res;
+    }
+    keycnt = dedupDICTIONARY(keys, keycnt, keylen);
+
+    dict_cache_header_t hdr = {
+        .magic = DICT_CACHE_MAGIC,
+        .version = DICT_CACHE_VERSION,
+        .keylen = keylen,
+        .keycnt = keycnt,
+        .src_size = st.st_size,
+        .src_mtime = st.st_mtime,
+        .src_crc = text_crc,
+    };
+
+    if (cachepath && saveFileCache(cachepath, &hdr, sizeof(hdr), keys, (size_t)keycnt * keylen) == PM3_SUCCESS) {
+        PrintAndLogEx(DEBUG, "compiled dictionary " _YELLOW_("%s"), cachepath);
+        if (mapFilePath(cachepath, &dict->map, &dict->maplen) == PM3_SUCCESS && dict_cache_usable(dict->map, dict->maplen, keylen)) {
+            free(keys);
+            dict->keys = (const uint8_t *)dict->map + sizeof(dict_cache_header_t);
+            dict->keycnt = keycnt;
+            goto out;
+        }
+        unmapFile(dict->map, dict->maplen);
+        dict->map = NULL;
+        dict->maplen = 0;
+    }
+
+    // no cache,  keep the parsed keys
+    dict->keys = keys;
+    dict->keycnt = keycnt;
 
 out:
+    if (verbose)
+        PrintAndLogEx(SUCCESS, "loaded " _GREEN_("%2d") " keys from dictionary file " _YELLOW_("%s"), dict->keycnt, path);
+
+    free(cachepath);
     free(path);
-    return retval;
+    return PM3_SUCCESS;
+}
+
+void unmapFileDICTIONARY(dictionary_t *dict) {
+    if (dict->map) {
+        unmapFile(dict->map, dict->maplen);
+    } else {
+        free((void *)dict->keys);
+    }
+    memset(dict, 0, sizeof(dictionary_t));
+}
+
+int loadFileDICTIONARY_safe(const char *preferredName, void **pdata, uint8_t keylen, uint32_t *keycnt) {
+
+    *pdata = NULL;
+
+    dictionary_t dict;
+    int res = mapFileDICTIONARY(preferredName, keylen, &dict, true);
+    if (res != PM3_SUCCESS) {
+        return res;
+    }
+
+    // callers may grow the block,  so hand out a private copy
+    size_t size = (size_t)dict.keycnt * dict.keylen;
+    *pdata = calloc(MAX(size, dict.keylen), sizeof(uint8_t));
+    if (*pdata == NULL) {
+        unmapFileDICTIONARY(&dict);
+        return PM3_EMALLOC;
+    }
+    memcpy(*pdata, dict.keys, size);
+    *keycnt = dict.keycnt;
+
+    unmapFileDICTIONARY(&dict);
+    return PM3_SUCCESS;
 }
 
 mfu_df_e detect_mfu_dump_format(uint8_t **dump, size_t *dumplen, bool verbose) {
@@ -76,6 +76,7 @@ char *newfilenamemcopy(const char *preferredName, const char *suffix);
  * @return 0 for ok, 1 for failz
  */
 int saveFile(const char *preferredName, const char *suffix, const void *data, size_t datalen);
+int saveFileEx(const char *preferredName, const char *suffix, const void *data, size_t datalen, bool overwrite);
 
 /**
  * @brief Utility function to save data to a textfile (EML). This method takes a preferred name, but if that
@@ -165,6 +166,37 @@ int loadFile(const char *preferredName, const char *suffix, void *data, size_t m
 */
 int loadFile_safe(const char *preferredName, const char *suffix, void **pdata, size_t *datalen);
 int loadFile_safeEx(const char *preferredName, const char *suffix, void **pdata, size_t *datalen, bool verbose);
+/**
+ * @brief Utility function to memory map a binary file read-only. This method takes a preferred name.
+ * E.g. dumpdata-15.trace,  tries to search for it,  and maps it.
+ * Pages are read on access and shared between processes mapping the same file,
+ * so large files can be walked without loading them into memory.
+ * Release the mapping with unmapFile.
+ *
+ * @param preferredName
+ * @param suffix the file suffix. Including the ".".
+ * @param pdata pointer to the mapped read-only data
+ * @param datalen the number of bytes mapped
+ * @return PM3_SUCCESS for ok, PM3_E* for failz
+ */
+int mapFile_safe(const char *preferredName, const char *suffix, void **pdata, size_t *datalen);
+int mapFile_safeEx(const char *preferredName, const char *suffix, void **pdata, size_t *datalen, bool verbose);
+int mapFilePath(const char *path, void **pdata, size_t *datalen);
+void unmapFile(void *data, size_t datalen);
+
+/**
+ * @brief Utility function to write a header followed by data to a cache file.
+ * The file is written aside and moved in place,  so a reader mapping it never sees it half written.
+ *
+ * @param path full path,  see searchHomeFilePath with CACHE_SUBDIR
+ * @param header
+ * @param headerlen
+ * @param data
+ * @param datalen
+ * @return PM3_SUCCESS for ok, PM3_E* for failz
+ */
+int saveFileCache(const char *path, const void *header, size_t headerlen, const void *data, size_t datalen);
+
 /**
  * @brief  Utility function to load data from a textfile (EML). This method takes a preferred name.
  * E.g. dumpdata-15.txt
@@ -226,6 +258,7 @@ int loadFileDICTIONARYEx(const char *preferredName, void *data, size_t maxdatale
 /**
  * @brief  Utility function to load data safely from a DICTIONARY textfile. This method takes a preferred name.
  * E.g. mfc_default_keys.dic
+ * Goes through the compiled form,  see mapFileDICTIONARY.
  *
  * @param preferredName
  * @param pdata A pointer to a pointer  (for reverencing the loaded dictionary)
@@ -234,6 +267,43 @@ int loadFileDICTIONARYEx(const char *preferredName, void *data, size_t maxdatale
 */
 int loadFileDICTIONARY_safe(const char *preferredName, void **pdata, uint8_t keylen, uint32_t *keycnt);
 
+// A key dictionary in compiled form,  fixed width keys in file order with duplicates dropped.
+typedef struct {
+    const uint8_t *keys;
+    uint32_t keycnt;
+    uint8_t keylen;
+    void *map;          // mapping of the compiled file,  NULL when the keys live on the heap
+    size_t maplen;
+} dictionary_t;
+
+/**
+ * @brief  Utility function to map a DICTIONARY textfile in compiled form. This method takes a preferred name.
+ * E.g. mfc_default_keys.dic
+ * The compiled form is kept in the user cache directory and only rebuilt when the textfile changed,
+ * so big dictionaries are neither parsed again nor copied.
+ * Release it with unmapFileDICTIONARY.
+ *
+ * @param preferredName
+ * @param keylen  the number of bytes a key per row is
+ * @param dict the mapped dictionary
+ * @param verbose print messages if true
+ * @return PM3_SUCCESS for ok, PM3_E* for failz
+*/
+int mapFileDICTIONARY(const char *preferredName, uint8_t keylen, dictionary_t *dict, bool verbose);
+void unmapFileDICTIONARY(dictionary_t *dict);
+
+/**
+ * @brief  Utility function to drop repeated keys from a block of fixed width keys.
+ * The first occurrence of a key keeps its place.  Use it when keys of several dictionaries are merged,
+ * every single dictionary is already deduplicated when compiled.
+ *
+ * @param keys the keys,  compacted in place
+ * @param keycnt number of keys
+ * @param keylen  the number of bytes a key is
+ * @return number of keys left
+*/
+uint32_t dedupDICTIONARY(uint8_t *keys, uint32_t keycnt, uint8_t keylen);
+
 
 typedef enum {
     MFU_DF_UNKNOWN,
@@ -17,7 +17,10 @@
 //-----------------------------------------------------------------------------
 #include "graph.h"
 #include <stdlib.h>
+#include <stdio.h>
+#include <stdarg.h>
 #include <string.h>
+#include <pthread.h>
 #include "ui.h"
 #include "proxgui.h"
 #include "util.h"    //param_get32ex
@@ -25,13 +28,321 @@
 #include "cmddata.h" //for g_debugmode
 
 
-int g_GraphBuffer[MAX_GRAPH_TRACE_LEN];
-size_t g_GraphTraceLen;
+struct snapshot_page_s {
+    uint32_t refs;
+    size_t len;
+    uint8_t data[SNAPSHOT_PAGE_SIZE];
+};
 
-/* write a manchester bit to the graph
-TODO,  verfy that this doesn't overflow buffer  (iceman)
-*/
+static void page_put(snapshot_page_t *page) {
+    if (page && --page->refs == 0) {
+        free(page);
+    }
+}
+
+// Snapshot len bytes of buf into snap.  Pages equal to the same page of base are
+// shared instead of copied.  base may be snap itself.  On failure snap is left as is.
+bool buf_snapshot_take(buf_snapshot_t *snap, const buf_snapshot_t *base, const void *buf, size_t len) {
+    const uint8_t *src = (const uint8_t *)buf;
+    size_t npages = (len + SNAPSHOT_PAGE_SIZE - 1) / SNAPSHOT_PAGE_SIZE;
+
+    snapshot_page_t **pages = calloc(npages ? npages : 1, sizeof(snapshot_page_t *));
+    if (pages == NULL) {
+        return false;
+    }
+
+    for (size_t i = 0; i < npages; i++) {
+        size_t off = i * SNAPSHOT_PAGE_SIZE;
+        size_t n = MIN(len - off, SNAPSHOT_PAGE_SIZE);
+
+        snapshot_page_t *old = (base && i < base->npages) ? base->pages[i] : NULL;
+        if (old && old->len == n && memcmp(old->data, src + off, n) == 0) {
+            old->refs++;
+            pages[i] = old;
+            continue;
+        }
+
+        pages[i] = malloc(sizeof(snapshot_page_t));
+        if (pages[i] == NULL) {
+            for (size_t j = 0; j < i; j++) {
+                page_put(pages[j]);
+            }
+            free(pages);
+            return false;
+        }
+        pages[i]->refs = 1;
+        pages[i]->len = n;
+        memcpy(pages[i]->data, src + off, n);
+    }
+
+    buf_snapshot_release(snap);
+    snap->pages = pages;
+    snap->npages = npages;
+    snap->len = len;
+    return true;
+}
+
+// write the snapshot back,  only pages that differ get copied
+void buf_snapshot_restore(const buf_snapshot_t *snap, void *buf) {
+    uint8_t *dst = (uint8_t *)buf;
+    for (size_t i = 0; i < snap->npages; i++) {
+        const snapshot_page_t *page = snap->pages[i];
+        uint8_t *p = dst + (i * SNAPSHOT_PAGE_SIZE);
+        if (memcmp(p, page->data, page->len) != 0) {
+            memcpy(p, page->data, page->len);
+        }
+    }
+}
+
+bool buf_snapshot_equals(const buf_snapshot_t *snap, const void *buf, size_t len) {
+    if (snap->len != len) {
+        return false;
+    }
+
+    const uint8_t *src = (const uint8_t *)buf;
+    for (size_t i = 0; i < snap->npages; i++) {
+        const snapshot_page_t *page = snap->pages[i];
+        if (memcmp(src + (i * SNAPSHOT_PAGE_SIZE), page->data, page->len) != 0) {
+            return false;
+        }
+    }
+    return true;
+}
+
+void buf_snapshot_release(buf_snapshot_t *snap) {
+    for (size_t i = 0; i < snap->npages; i++) {
+        page_put(snap->pages[i]);
+    }
+    free(snap->pages);
+    snap->pages = NULL;
+    snap->npages = 0;
+    snap->len = 0;
+}
+
+static int gs_graph[MAX_GRAPH_TRACE_LEN];
+static uint8_t gs_demod[MAX_DEMOD_BUF_LEN];
+static demod_ctx_t gs_global_ctx = {
+    .graph = gs_graph,
+    .graph_cap = MAX_GRAPH_TRACE_LEN,
+    .demod = gs_demod,
+};
+
+__thread demod_ctx_t *g_demod_ctx = &gs_global_ctx;
+
+// the plot window paints the global graph from the GUI thread,  so moving or freeing
+// its buffer waits for the painting to finish.  Recursive,  GUI handlers save/restore too
+static pthread_mutex_t gs_graph_lock;
+static pthread_once_t gs_graph_lock_once = PTHREAD_ONCE_INIT;
+
+static void graph_lock_init(void) {
+    pthread_mutexattr_t attr;
+    pthread_mutexattr_init(&attr);
+    pthread_mutexattr_settype(&attr, PTHREAD_MUTEX_RECURSIVE);
+    pthread_mutex_init(&gs_graph_lock, &attr);
+    pthread_mutexattr_destroy(&attr);
+}
+
+void graph_lock(void) {
+    pthread_once(&gs_graph_lock_once, graph_lock_init);
+    pthread_mutex_lock(&gs_graph_lock);
+}
+
+void graph_unlock(void) {
+    pthread_mutex_unlock(&gs_graph_lock);
+}
+
+demod_ctx_t *demod_ctx_new(void) {
+    demod_ctx_t *ctx = calloc(1, sizeof(demod_ctx_t));
+    if (ctx == NULL) {
+        return NULL;
+    }
+
+    ctx->graph = calloc(MAX_GRAPH_TRACE_LEN, sizeof(int));
+    ctx->graph_cap = MAX_GRAPH_TRACE_LEN;
+    ctx->demod = calloc(MAX_DEMOD_BUF_LEN, sizeof(uint8_t));
+    if (ctx->graph == NULL || ctx->demod == NULL) {
+        demod_ctx_free(ctx);
+        return NULL;
+    }
+    return ctx;
+}
+
+// make room for len samples,  keeping the current ones.  New room is zeroed.
+static bool ctx_graph_reserve(demod_ctx_t *ctx, size_t len) {
+    if (len <= ctx->graph_cap) {
+        return true;
+    }
+
+    size_t cap = ctx->graph_cap;
+    while (cap < len) {
+        cap += cap / 2;
+    }
+
+    bool global = (ctx == &gs_global_ctx);
+    if (global) {
+        graph_lock();
+    }
+
+    int *graph;
+    if (ctx->graph == gs_graph) {
+        graph = malloc(cap * sizeof(int));
+        if (graph != NULL) {
+            memcpy(graph, gs_graph, sizeof(gs_graph));
+        }
+    } else {
+        graph = realloc(ctx->graph, cap * sizeof(int));
+    }
+
+    if (graph != NULL) {
+        memset(graph + ctx->graph_cap, 0, (cap - ctx->graph_cap) * sizeof(int));
+        ctx->graph = graph;
+        ctx->graph_cap = cap;
+    }
+
+    if (global) {
+        graph_unlock();
+    }
+
+    if (graph == NULL) {
+        PrintAndLogEx(WARNING, "Failed to allocate memory for %zu samples", len);
+        return false;
+    }
+    return true;
+}
+
+// hand back the room a long capture needed,  the graph must be empty
+static void ctx_graph_shrink(demod_ctx_t *ctx) {
+    if (ctx->graph_cap == MAX_GRAPH_TRACE_LEN) {
+        return;
+    }
+
+    if (ctx == &gs_global_ctx) {
+        graph_lock();
+        free(ctx->graph);
+        ctx->graph = gs_graph;
+        graph_unlock();
+    } else {
+        int *graph = realloc(ctx->graph, MAX_GRAPH_TRACE_LEN * sizeof(int));
+        if (graph == NULL) {
+            return;
+        }
+        ctx->graph = graph;
+    }
+    ctx->graph_cap = MAX_GRAPH_TRACE_LEN;
+}
+
+// grow the current graph buffer to hold at least len samples
+bool graph_reserve(size_t len) {
+    return ctx_graph_reserve(g_demod_ctx, len);
+}
+
+void demod_ctx_free(demod_ctx_t *ctx) {
+    if (ctx == NULL || ctx == &gs_global_ctx) {
+        return;
+    }
+    free(ctx->graph);
+    free(ctx->demod);
+    buf_snapshot_release(&ctx->saved_graph);
+    buf_snapshot_release(&ctx->saved_demod);
+    for (size_t i = 0; i < ctx->undo_count; i++) {
+        buf_snapshot_release(&ctx->undo[i]);
+    }
+    free(ctx);
+}
+
+// copy the current samples and demod buffer,  the save/restore shadows stay with dst
+bool demod_ctx_copy(demod_ctx_t *dst, const demod_ctx_t *src) {
+    if (ctx_graph_reserve(dst, src->graph_len) == false) {
+        return false;
+    }
+    memcpy(dst->graph, src->graph, src->graph_len * sizeof(int));
+    dst->graph_len = src->graph_len;
+    memcpy(dst->demod, src->demod, src->demod_len);
+    dst->demod_len = src->demod_len;
+    dst->demod_start = src->demod_start;
+    dst->demod_clock = src->demod_clock;
+    dst->tag_id[0] = '\0';
+    return true;
+}
+
+// only the global context drives the plot window
+bool demod_ctx_is_global(void) {
+    return g_demod_ctx == &gs_global_ctx;
+}
+
+// remember the tag id a demodulator decoded,  in its printed form
+void demod_set_tag_id(const char *fmt, ...) {
+    va_list args;
+    va_start(args, fmt);
+    vsnprintf(g_demod_ctx->tag_id, sizeof(g_demod_ctx->tag_id), fmt, args);
+    va_end(args);
+}
+
+// the newest snapshot of the graph,  to share pages with
+static const buf_snapshot_t *graph_snapshot_base(const demod_ctx_t *ctx) {
+    if (ctx->undo_count) {
+        return &ctx->undo[ctx->undo_count - 1];
+    }
+    return (ctx->graph_saved) ? &ctx->saved_graph : NULL;
+}
+
+// push the current graph as an undo level,  dropping the oldest when full
+void graph_undo_checkpoint(void) {
+    demod_ctx_t *ctx = g_demod_ctx;
+
+    buf_snapshot_t snap = {0};
+    if (buf_snapshot_take(&snap, graph_snapshot_base(ctx), ctx->graph, ctx->graph_len * sizeof(int)) == false) {
+        return;
+    }
+
+    if (ctx->undo_count == GRAPH_UNDO_DEPTH) {
+        buf_snapshot_release(&ctx->undo[0]);
+        memmove(&ctx->undo[0], &ctx->undo[1], (GRAPH_UNDO_DEPTH - 1) * sizeof(buf_snapshot_t));
+        ctx->undo_count--;
+    }
+    ctx->undo[ctx->undo_count++] = snap;
+}
+
+// drop the newest undo level again if the graph didn't change since
+void graph_undo_settle(void) {
+    demod_ctx_t *ctx = g_demod_ctx;
+    if (ctx->undo_count == 0) {
+        return;
+    }
+
+    buf_snapshot_t *top = &ctx->undo[ctx->undo_count - 1];
+    if (buf_snapshot_equals(top, ctx->graph, ctx->graph_len * sizeof(int))) {
+        buf_snapshot_release(top);
+        ctx->undo_count--;
+    }
+}
+
+// go back to the last graph that differs from the current one
+bool graph_undo(void) {
+    demod_ctx_t *ctx = g_demod_ctx;
+
+    graph_undo_settle();
+    if (ctx->undo_count == 0) {
+        return false;
+    }
+
+    buf_snapshot_t *top = &ctx->undo[ctx->undo_count - 1];
+    if (ctx_graph_reserve(ctx, top->len / sizeof(int)) == false) {
+        return false;
+    }
+    buf_snapshot_restore(top, ctx->graph);
+    ctx->graph_len = top->len / sizeof(int);
+    buf_snapshot_release(top);
+    ctx->undo_count--;
+    RepaintGraphWindow();
+    return true;
+}
+
+// write a manchester bit to the graph
 void AppendGraph(bool redraw, uint16_t clock, int bit) {
+    if (graph_reserve(g_GraphTraceLen + clock) == false)
+        return;
+
     uint8_t half = clock / 2;
     uint16_t i;
     //set first half the clock bit (all 1's or 0's for a 0 or 1 bit)
@@ -51,6 +362,7 @@ size_t ClearGraph(bool redraw) {
     size_t gtl = g_GraphTraceLen;
     memset(g_GraphBuffer, 0x00, g_GraphTraceLen);
     g_GraphTraceLen = 0;
+    ctx_graph_shrink(g_demod_ctx);
     g_GraphStart = 0;
     g_GraphStop = 0;
 
@@ -62,21 +374,26 @@ size_t ClearGraph(bool redraw) {
 }
 // option '1' to save g_GraphBuffer any other to restore
 void save_restoreGB(uint8_t saveOpt) {
-    static int SavedGB[MAX_GRAPH_TRACE_LEN];
-    static size_t SavedGBlen = 0;
-    static bool GB_Saved = false;
-    static int Savedg_GridOffsetAdj = 0;
+    demod_ctx_t *ctx = g_demod_ctx;
 
     if (saveOpt == GRAPH_SAVE) { //save
-        memcpy(SavedGB, g_GraphBuffer, sizeof(g_GraphBuffer));
-        SavedGBlen = g_GraphTraceLen;
-        GB_Saved = true;
-        Savedg_GridOffsetAdj = g_GridOffset;
-    } else if (GB_Saved) { //restore
-        memcpy(g_GraphBuffer, SavedGB, sizeof(g_GraphBuffer));
-        g_GraphTraceLen = SavedGBlen;
-        g_GridOffset = Savedg_GridOffsetAdj;
-        RepaintGraphWindow();
+        const buf_snapshot_t *base = (ctx->graph_saved) ? &ctx->saved_graph : graph_snapshot_base(ctx);
+        if (buf_snapshot_take(&ctx->saved_graph, base, ctx->graph, ctx->graph_len * sizeof(int)) == false) {
+            PrintAndLogEx(WARNING, "Failed to allocate memory");
+            return;
+        }
+        ctx->graph_saved = true;
+        ctx->saved_grid_offset = g_GridOffset;
+    } else if (ctx->graph_saved) { //restore
+        if (ctx_graph_reserve(ctx, ctx->saved_graph.len / sizeof(int)) == false) {
+            return;
+        }
+        buf_snapshot_restore(&ctx->saved_graph, ctx->graph);
+        ctx->graph_len = ctx->saved_graph.len / sizeof(int);
+        if (demod_ctx_is_global()) {
+            g_GridOffset = ctx->saved_grid_offset;
+            RepaintGraphWindow();
+        }
     }
 }
 
@@ -85,8 +402,8 @@ void setGraphBuf(const uint8_t *src, size_t size) {
 
     ClearGraph(false);
 
-    if (size > MAX_GRAPH_TRACE_LEN)
-        size = MAX_GRAPH_TRACE_LEN;
+    if (graph_reserve(size) == false)
+        return;
 
     for (size_t i = 0; i < size; ++i)
         g_GraphBuffer[i] = src[i] - 128;
@@ -95,12 +412,18 @@ void setGraphBuf(const uint8_t *src, size_t size) {
     RepaintGraphWindow();
 }
 
+// callers hand in MAX_GRAPH_TRACE_LEN sized buffers,  longer graphs are cut there
 size_t getFromGraphBuf(uint8_t *dest) {
+    return getFromGraphBufEx(dest, MAX_GRAPH_TRACE_LEN);
+}
+
+size_t getFromGraphBufEx(uint8_t *dest, size_t maxlen) {
     if (dest == NULL) return 0;
     if (g_GraphTraceLen == 0) return 0;
 
+    size_t len = MIN(g_GraphTraceLen, maxlen);
     size_t i;
-    for (i = 0; i < g_GraphTraceLen; ++i) {
+    for (i = 0; i < len; ++i) {
         //trim
         if (g_GraphBuffer[i] > 127) g_GraphBuffer[i] = 127;
         if (g_GraphBuffer[i] < -127) g_GraphBuffer[i] = -127;
@@ -148,7 +471,7 @@ void convertGraphFromBitstreamEx(int hi, int low) {
         return;
     }
 
-    size_t size = getFromGraphBuf(bits);
+    size_t size = getFromGraphBufEx(bits, g_GraphTraceLen);
     if (size == 0) {
         PrintAndLogEx(WARNING, "Failed to copy from graphbuffer");
         free(bits);
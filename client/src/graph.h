@@ -31,6 +31,7 @@ bool HasGraphData(void);
 void setGraphBuf(const uint8_t *src, size_t size);
 void save_restoreGB(uint8_t saveOpt);
 size_t getFromGraphBuf(uint8_t *dest);
+size_t getFromGraphBufEx(uint8_t *dest, size_t maxlen);
 void convertGraphFromBitstream(void);
 void convertGraphFromBitstreamEx(int hi, int low);
 bool isGraphBitstream(void);
@@ -42,12 +43,78 @@ int GetNrzClock(const char *str, bool verbose);
 int GetFskClock(const char *str, bool verbose);
 bool fskClocks(uint8_t *fc1, uint8_t *fc2, uint8_t *rf1, int *firstClockEdge);
 
+// Initial size of the graph buffer.  It grows past this for longer captures,
+// getFromGraphBuf() hands out at most this many samples.
 #define MAX_GRAPH_TRACE_LEN (40000 * 8)
 #define GRAPH_SAVE 1
 #define GRAPH_RESTORE 0
 
-extern int g_GraphBuffer[MAX_GRAPH_TRACE_LEN];
-extern size_t g_GraphTraceLen;
+// Snapshot of a buffer,  split in reference counted pages.
+// Consecutive snapshots share every page that did not change in between.
+#define SNAPSHOT_PAGE_SIZE  4096
+#define GRAPH_UNDO_DEPTH    16
+
+typedef struct snapshot_page_s snapshot_page_t;
+
+typedef struct {
+    snapshot_page_t **pages;
+    size_t npages;
+    size_t len;                 // bytes
+} buf_snapshot_t;
+
+bool buf_snapshot_take(buf_snapshot_t *snap, const buf_snapshot_t *base, const void *buf, size_t len);
+void buf_snapshot_restore(const buf_snapshot_t *snap, void *buf);
+bool buf_snapshot_equals(const buf_snapshot_t *snap, const void *buf, size_t len);
+void buf_snapshot_release(buf_snapshot_t *snap);
+
+#define DEMOD_TAG_ID_LEN    64
+
+// Sample and demodulation state the LF demodulators work on.
+// Every thread starts out on the global context,  lf search gives its
+// worker threads private ones so the demodulators can run side by side.
+typedef struct {
+    int *graph;                 // graph_cap samples,  never less than MAX_GRAPH_TRACE_LEN
+    size_t graph_len;
+    size_t graph_cap;
+    uint8_t *demod;             // MAX_DEMOD_BUF_LEN bits
+    size_t demod_len;
+    int32_t demod_start;
+    int demod_clock;
+    char tag_id[DEMOD_TAG_ID_LEN]; // id the last successful demod decoded,  lf batch reports it
+
+    // save_restoreGB() / save_restoreDB() shadows
+    buf_snapshot_t saved_graph;
+    bool graph_saved;
+    int saved_grid_offset;
+    buf_snapshot_t saved_demod;
+    bool demod_saved;
+    int32_t saved_demod_start;
+    int saved_demod_clock;
+
+    // graph undo levels,  newest last
+    buf_snapshot_t undo[GRAPH_UNDO_DEPTH];
+    size_t undo_count;
+} demod_ctx_t;
+
+extern __thread demod_ctx_t *g_demod_ctx;
+
+demod_ctx_t *demod_ctx_new(void);
+void demod_ctx_free(demod_ctx_t *ctx);
+bool demod_ctx_copy(demod_ctx_t *dst, const demod_ctx_t *src);
+bool demod_ctx_is_global(void);
+void demod_set_tag_id(const char *fmt, ...);
+
+bool graph_reserve(size_t len);
+// hold the global graph buffer in place while reading it from another thread
+void graph_lock(void);
+void graph_unlock(void);
+
+void graph_undo_checkpoint(void);
+void graph_undo_settle(void);
+bool graph_undo(void);
+
+#define g_GraphBuffer   (g_demod_ctx->graph)
+#define g_GraphTraceLen (g_demod_ctx->graph_len)
 
 #ifdef __cplusplus
 }
@@ -0,0 +1,218 @@
+//-----------------------------------------------------------------------------
+// Copyright (C) Proxmark3 contributors. See AUTHORS.md for details.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// See LICENSE.txt for the text of the license.
+//-----------------------------------------------------------------------------
+// WARNING
+//
+// THIS CODE IS CREATED FOR EXPERIMENTATION AND EDUCATIONAL USE ONLY.
+//
+// USAGE OF THIS CODE IN OTHER WAYS MAY INFRINGE UPON THE INTELLECTUAL
+// PROPERTY OF OTHER PARTIES, SUCH AS INSIDE SECURE AND HID GLOBAL,
+// AND MAY EXPOSE YOU TO AN INFRINGEMENT ACTION FROM THOSE PARTIES.
+//
+// THIS CODE SHOULD NEVER BE USED TO INFRINGE PATENTS OR INTELLECTUAL PROPERTY RIGHTS.
+//-----------------------------------------------------------------------------
+// Bitsliced elite key recovery kernel, see elite_bs.h
+//
+// elite_bs_core.h is compiled once per vector width by bitslice_instances.h.
+// elite_bs_engine() only hands out the ones this CPU runs.
+//-----------------------------------------------------------------------------
+#include "elite_bs.h"
+
+#include <string.h>
+
+// FIPS 46-3 tables, 1 based as printed there
+static const uint8_t des_ip[64] = {
+    58, 50, 42, 34, 26, 18, 10, 2, 60, 52, 44, 36, 28, 20, 12, 4,
+    62, 54, 46, 38, 30, 22, 14, 6, 64, 56, 48, 40, 32, 24, 16, 8,
+    57, 49, 41, 33, 25, 17, 9,  1, 59, 51, 43, 35, 27, 19, 11, 3,
+    61, 53, 45, 37, 29, 21, 13, 5, 63, 55, 47, 39, 31, 23, 15, 7
+};
+
+static const uint8_t des_e[48] = {
+    32, 1,  2,  3,  4,  5,  4,  5,  6,  7,  8,  9,
+    8,  9,  10, 11, 12, 13, 12, 13, 14, 15, 16, 17,
+    16, 17, 18, 19, 20, 21, 20, 21, 22, 23, 24, 25,
+    24, 25, 26, 27, 28, 29, 28, 29, 30, 31, 32, 1
+};
+
+static const uint8_t des_p[32] = {
+    16, 7,  20, 21, 29, 12, 28, 17, 1,  15, 23, 26, 5,  18, 31, 10,
+    2,  8,  24, 14, 32, 27, 3,  9,  19, 13, 30, 6,  22, 11, 4,  25
+};
+
+static const uint8_t des_pc1[56] = {
+    57, 49, 41, 33, 25, 17, 9,  1,  58, 50, 42, 34, 26, 18,
+    10, 2,  59, 51, 43, 35, 27, 19, 11, 3,  60, 52, 44, 36,
+    63, 55, 47, 39, 31, 23, 15, 7,  62, 54, 46, 38, 30, 22,
+    14, 6,  61, 53, 45, 37, 29, 21, 13, 5,  28, 20, 12, 4
+};
+
+static const uint8_t des_pc2[48] = {
+    14, 17, 11, 24, 1,  5,  3,  28, 15, 6,  21, 10,
+    23, 19, 12, 4,  26, 8,  16, 7,  27, 20, 13, 2,
+    41, 52, 31, 37, 47, 55, 30, 40, 51, 45, 33, 48,
+    44, 49, 39, 56, 34, 53, 46, 42, 50, 36, 29, 32
+};
+
+static const uint8_t des_shifts[16] = { 1, 1, 2, 2, 2, 2, 2, 2, 1, 2, 2, 2, 2, 2, 2, 1 };
+
+#define DES_S1 \
+    (14, 4, 13, 1, 2, 15, 11, 8, 3, 10, 6, 12, 5, 9, 0, 7), \
+    (0, 15, 7, 4, 14, 2, 13, 1, 10, 6, 12, 11, 9, 5, 3, 8), \
+    (4, 1, 14, 8, 13, 6, 2, 11, 15, 12, 9, 7, 3, 10, 5, 0), \
+    (15, 12, 8, 2, 4, 9, 1, 7, 5, 11, 3, 14, 10, 0, 6, 13)
+#define DES_S2 \
+    (15, 1, 8, 14, 6, 11, 3, 4, 9, 7, 2, 13, 12, 0, 5, 10), \
+    (3, 13, 4, 7, 15, 2, 8, 14, 12, 0, 1, 10, 6, 9, 11, 5), \
+    (0, 14, 7, 11, 10, 4, 13, 1, 5, 8, 12, 6, 9, 3, 2, 15), \
+    (13, 8, 10, 1, 3, 15, 4, 2, 11, 6, 7, 12, 0, 5, 14, 9)
+#define DES_S3 \
+    (10, 0, 9, 14, 6, 3, 15, 5, 1, 13, 12, 7, 11, 4, 2, 8), \
+    (13, 7, 0, 9, 3, 4, 6, 10, 2, 8, 5, 14, 12, 11, 15, 1), \
+    (13, 6, 4, 9, 8, 15, 3, 0, 11, 1, 2, 12, 5, 10, 14, 7), \
+    (1, 10, 13, 0, 6, 9, 8, 7, 4, 15, 14, 3, 11, 5, 2, 12)
+#define DES_S4 \
+    (7, 13, 14, 3, 0, 6, 9, 10, 1, 2, 8, 5, 11, 12, 4, 15), \
+    (13, 8, 11, 5, 6, 15, 0, 3, 4, 7, 2, 12, 1, 10, 14, 9), \
+    (10, 6, 9, 0, 12, 11, 7, 13, 15, 1, 3, 14, 5, 2, 8, 4), \
+    (3, 15, 0, 6, 10, 1, 13, 8, 9, 4, 5, 11, 12, 7, 2, 14)
+#define DES_S5 \
+    (2, 12, 4, 1, 7, 10, 11, 6, 8, 5, 3, 15, 13, 0, 14, 9), \
+    (14, 11, 2, 12, 4, 7, 13, 1, 5, 0, 15, 10, 3, 9, 8, 6), \
+    (4, 2, 1, 11, 10, 13, 7, 8, 15, 9, 12, 5, 6, 3, 0, 14), \
+    (11, 8, 12, 7, 1, 14, 2, 13, 6, 15, 0, 9, 10, 4, 5, 3)
+#define DES_S6 \
+    (12, 1, 10, 15, 9, 2, 6, 8, 0, 13, 3, 4, 14, 7, 5, 11), \
+    (10, 15, 4, 2, 7, 12, 9, 5, 6, 1, 13, 14, 0, 11, 3, 8), \
+    (9, 14, 15, 5, 2, 8, 12, 3, 7, 0, 4, 10, 1, 13, 11, 6), \
+    (4, 3, 2, 12, 9, 5, 15, 10, 11, 14, 1, 7, 6, 0, 8, 13)
+#define DES_S7 \
+    (4, 11, 2, 14, 15, 0, 8, 13, 3, 12, 9, 7, 5, 10, 6, 1), \
+    (13, 0, 11, 7, 4, 9, 1, 10, 14, 3, 5, 12, 2, 15, 8, 6), \
+    (1, 4, 11, 13, 12, 3, 7, 14, 10, 15, 6, 8, 0, 5, 9, 2), \
+    (6, 11, 13, 8, 1, 4, 10, 7, 9, 5, 0, 15, 14, 2, 3, 12)
+#define DES_S8 \
+    (13, 2, 8, 4, 6, 15, 11, 1, 10, 9, 3, 14, 5, 0, 12, 7), \
+    (1, 15, 13, 8, 10, 3, 7, 4, 12, 5, 6, 11, 0, 14, 9, 2), \
+    (7, 11, 4, 1, 9, 12, 14, 2, 0, 6, 10, 13, 15, 3, 5, 8), \
+    (2, 1, 14, 7, 4, 10, 8, 13, 15, 12, 9, 0, 3, 5, 6, 11)
+
+// hash0 permutation table, same as ikeys.c
+static const uint8_t hash0_pi[35] = {
+    0x0F, 0x17, 0x1B, 0x1D, 0x1E, 0x27, 0x2B, 0x2D,
+    0x2E, 0x33, 0x35, 0x39, 0x36, 0x3A, 0x3C, 0x47,
+    0x4B, 0x4D, 0x4E, 0x53, 0x55, 0x56, 0x59, 0x5A,
+    0x5C, 0x63, 0x65, 0x66, 0x69, 0x6A, 0x6C, 0x71,
+    0x72, 0x74, 0x78
+};
+
+void elite_bs_init(elite_bs_ctx_t *ctx, const loclass_dumpdata_t *item) {
+
+    for (int i = 0; i < 64; i++) {
+        uint8_t n = des_ip[i] - 1;
+        ctx->ip[i] = (item->csn[n >> 3] >> (7 - (n & 7))) & 1;
+        ctx->fp[n] = i;
+    }
+
+    // The key comes in iclass format. permutekey_rev puts bit i (msb first)
+    // of key_sel byte j at bit j of byte 7 - i, so standard key bit n is
+    // iclass bit ((n & 7) << 3) | (7 - (n >> 3)).
+    uint8_t cd[56];
+    for (int i = 0; i < 56; i++) {
+        uint8_t n = des_pc1[i] - 1;
+        cd[i] = ((n & 7) << 3) | (7 - (n >> 3));
+    }
+
+    uint8_t shift = 0;
+    for (int round = 0; round < 16; round++) {
+        shift += des_shifts[round];
+        for (int i = 0; i < 48; i++) {
+            uint8_t n = des_pc2[i] - 1;
+            if (n < 28) {
+                n = (n + shift) % 28;
+            } else {
+                n = 28 + ((n - 28 + shift) % 28);
+            }
+            ctx->ks[round][i] = cd[n];
+        }
+    }
+
+    // doMAC feeds every cc_nr byte lsb first
+    for (int i = 0; i < 96; i++) {
+        ctx->cc_nr[i] = (item->cc_nr[i >> 3] >> (i & 7)) & 1;
+    }
+    ctx->mac = (uint32_t)item->mac[0] | ((uint32_t)item->mac[1] << 8) |
+               ((uint32_t)item->mac[2] << 16) | ((uint32_t)item->mac[3] << 24);
+}
+
+static inline void transpose_step(uint64_t a[64], int j, uint64_t m) {
+    for (int b = 0; b < 64; b += j << 1) {
+        for (int k = b; k < b + j; k++) {
+            uint64_t t = (a[k] ^ (a[k + j] >> j)) & m;
+            a[k] ^= t;
+            a[k + j] ^= (t << j);
+        }
+    }
+}
+
+// a[i] bit 63 - j <-> a[j] bit 63 - i
+static void transpose64(uint64_t a[64]) {
+    transpose_step(a, 32, 0x00000000FFFFFFFFULL);
+    transpose_step(a, 16, 0x0000FFFF0000FFFFULL);
+    transpose_step(a, 8, 0x00FF00FF00FF00FFULL);
+    transpose_step(a, 4, 0x0F0F0F0F0F0F0F0FULL);
+    transpose_step(a, 2, 0x3333333333333333ULL);
+    transpose_step(a, 1, 0x5555555555555555ULL);
+}
+
+// lanes of word w below n
+static uint64_t lanes_mask(uint16_t n, int w) {
+    int cnt = n - (w << 6);
+    if (cnt >= 64) {
+        return ~0ULL;
+    }
+    return (cnt > 0) ? (~0ULL << (64 - cnt)) : 0;
+}
+
+// bitslices of word w of the keys, 64 of them stride words apart
+static void load_keys(const uint8_t *keys, uint16_t n, int w, uint64_t *dst, size_t stride) {
+    uint64_t a[64] = {0};
+    for (int i = 0; i < 64 && (w << 6) + i < n; i++) {
+        const uint8_t *k = keys + (((w << 6) + i) << 3);
+        a[i] = ((uint64_t)k[0] << 56) | ((uint64_t)k[1] << 48) | ((uint64_t)k[2] << 40) | ((uint64_t)k[3] << 32) |
+               ((uint64_t)k[4] << 24) | ((uint64_t)k[5] << 16) | ((uint64_t)k[6] << 8) | (uint64_t)k[7];
+    }
+    transpose64(a);
+    for (int i = 0; i < 64; i++) {
+        dst[i * stride] = a[i];
+    }
+}
+
+#define BITSLICE_KERNEL "loclass/elite_bs_core.h"
+#include "bitslice_instances.h"
+
+static const elite_bs_engine_t *const engines[BS_ARCH_COUNT] = { BITSLICE_TABLE(&engine) };
+
+const elite_bs_engine_t *elite_bs_engine(uint8_t n) {
+    for (int arch = BS_ARCH_COUNT - 1; arch >= 0; arch--) {
+        if (engines[arch] == NULL || bitslice_arch_supported(arch) == false) {
+            continue;
+        }
+        if (n-- == 0) {
+            return engines[arch];
+        }
+    }
+    return NULL;
+}
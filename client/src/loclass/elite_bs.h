@@ -0,0 +1,70 @@
+//-----------------------------------------------------------------------------
+// Copyright (C) Proxmark3 contributors. See AUTHORS.md for details.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// See LICENSE.txt for the text of the license.
+//-----------------------------------------------------------------------------
+// WARNING
+//
+// THIS CODE IS CREATED FOR EXPERIMENTATION AND EDUCATIONAL USE ONLY.
+//
+// USAGE OF THIS CODE IN OTHER WAYS MAY INFRINGE UPON THE INTELLECTUAL
+// PROPERTY OF OTHER PARTIES, SUCH AS INSIDE SECURE AND HID GLOBAL,
+// AND MAY EXPOSE YOU TO AN INFRINGEMENT ACTION FROM THOSE PARTIES.
+//
+// THIS CODE SHOULD NEVER BE USED TO INFRINGE PATENTS OR INTELLECTUAL PROPERTY RIGHTS.
+//-----------------------------------------------------------------------------
+// Bitsliced elite key recovery kernel.
+//
+// Tests a batch of candidate key_sel values against one loclass dump item,
+// the same permutekey_rev -> diversifyKey -> doMAC chain bf_thread used to run
+// one key at a time. All three steps run bitsliced, one candidate per bit of
+// a 64 to 512 bit wide vector.
+//
+// The vector width is picked at runtime from what the CPU supports.
+//-----------------------------------------------------------------------------
+
+#ifndef ELITE_BS_H
+#define ELITE_BS_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include "elite_crack.h"
+#include "bitslice.h"
+
+// widest batch of any engine
+#define ELITE_BS_MAX_LANES  BITSLICE_MAX_LANES
+
+// per dump item constants, see elite_bs_init
+typedef struct {
+    uint8_t ip[64];         // IP(csn), one bit per byte
+    uint8_t ks[16][48];     // DES round key bits, as bit index into the iclass format key_sel
+    uint8_t fp[64];         // final permutation, 0 based
+    uint8_t cc_nr[96];      // MAC input, one bit per byte in the order it is fed
+    uint32_t mac;           // expected MAC, first output bit in bit 0
+} elite_bs_ctx_t;
+
+typedef struct {
+    const char *name;       // instruction set, "avx512", "avx2", "sse2", "neon" or "scalar"
+    uint16_t lanes;         // keys per call
+    // Tests keys[0 .. n - 1], n <= lanes, 8 bytes each in iclass format (key_sel).
+    // Returns the index of the first key giving the expected MAC or -1.
+    int (*test)(const elite_bs_ctx_t *ctx, const uint8_t *keys, uint16_t n);
+} elite_bs_engine_t;
+
+void elite_bs_init(elite_bs_ctx_t *ctx, const loclass_dumpdata_t *item);
+
+// engines this CPU can run, widest (fastest) first. NULL past the last one
+const elite_bs_engine_t *elite_bs_engine(uint8_t n);
+
+#endif
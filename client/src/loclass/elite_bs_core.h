@@ -0,0 +1,419 @@
+//-----------------------------------------------------------------------------
+// Copyright (C) Proxmark3 contributors. See AUTHORS.md for details.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// See LICENSE.txt for the text of the license.
+//-----------------------------------------------------------------------------
+// Bitsliced DES, hash0 and iClass MAC, one instance per vector width.
+//
+// Compiled by bitslice_instances.h for elite_bs.c, see common/bitslice.h
+//
+// A bitslice holds one bit of BS_BITS independent candidates. Lane L of a
+// 64 bit word is bit 63 - L, as left by transpose64.
+//-----------------------------------------------------------------------------
+
+// S-box output bit o (3 = msb) of input (row, col) where m[col] is set. See BS_SBOX
+#define BS_SEL(o, c, v)     ((((v) >> (o)) & 1) ? m[c] : zero)
+#define BS_COLS(o, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15) ( \
+    BS_SEL(o, 0, v0) | BS_SEL(o, 1, v1) | BS_SEL(o, 2, v2) | BS_SEL(o, 3, v3) | \
+    BS_SEL(o, 4, v4) | BS_SEL(o, 5, v5) | BS_SEL(o, 6, v6) | BS_SEL(o, 7, v7) | \
+    BS_SEL(o, 8, v8) | BS_SEL(o, 9, v9) | BS_SEL(o, 10, v10) | BS_SEL(o, 11, v11) | \
+    BS_SEL(o, 12, v12) | BS_SEL(o, 13, v13) | BS_SEL(o, 14, v14) | BS_SEL(o, 15, v15))
+#define BS_COLS_(o, ...)    BS_COLS(o, __VA_ARGS__)
+#define BS_ROW(o, row)      BS_COLS_(o, BS_UNPACK row)
+#define BS_UNPACK(...)      __VA_ARGS__
+#define BS_OUT(o, r0, r1, r2, r3) \
+    ((row[0] & BS_ROW(o, r0)) | (row[1] & BS_ROW(o, r1)) | (row[2] & BS_ROW(o, r2)) | (row[3] & BS_ROW(o, r3)))
+
+// Straight from the S-box table: decode the row and column into one-hot masks,
+// every output bit is then the OR of the columns where the table has it set.
+// All the table lookups are constant and fold away at compile time.
+#define BS_SBOX(name, tab)  BS_SBOX_(name, tab)
+#define BS_SBOX_(name, r0, r1, r2, r3) \
+static inline BS_TARGET void BS_FN(name)(const bs_vec *in, bs_vec *out) { \
+    const bs_vec zero = {0}; \
+    bs_vec h[4] = { ~in[1] & ~in[2], ~in[1] & in[2], in[1] & ~in[2], in[1] & in[2] }; \
+    bs_vec l[4] = { ~in[3] & ~in[4], ~in[3] & in[4], in[3] & ~in[4], in[3] & in[4] }; \
+    bs_vec row[4] = { ~in[0] & ~in[5], ~in[0] & in[5], in[0] & ~in[5], in[0] & in[5] }; \
+    bs_vec m[16]; \
+    for (int i = 0; i < 4; i++) { \
+        for (int j = 0; j < 4; j++) { \
+            m[(i << 2) | j] = h[i] & l[j]; \
+        } \
+    } \
+    out[0] = BS_OUT(3, r0, r1, r2, r3); \
+    out[1] = BS_OUT(2, r0, r1, r2, r3); \
+    out[2] = BS_OUT(1, r0, r1, r2, r3); \
+    out[3] = BS_OUT(0, r0, r1, r2, r3); \
+}
+
+BS_SBOX(sbox1, DES_S1)
+BS_SBOX(sbox2, DES_S2)
+BS_SBOX(sbox3, DES_S3)
+BS_SBOX(sbox4, DES_S4)
+BS_SBOX(sbox5, DES_S5)
+BS_SBOX(sbox6, DES_S6)
+BS_SBOX(sbox7, DES_S7)
+BS_SBOX(sbox8, DES_S8)
+
+// DES encryption of the item csn under every lane's key
+static BS_TARGET void BS_FN(des)(const elite_bs_ctx_t *ctx, const bs_slice *key, bs_slice *out) {
+    const bs_vec zero = {0};
+    bs_vec lr[2][32];
+    bs_vec *l = lr[0], *r = lr[1];
+
+    for (int i = 0; i < 32; i++) {
+        l[i] = ctx->ip[i] ? ~zero : zero;
+        r[i] = ctx->ip[32 + i] ? ~zero : zero;
+    }
+
+    for (int round = 0; round < 16; round++) {
+        const uint8_t *ks = ctx->ks[round];
+        bs_vec in[48], f[32];
+
+        for (int i = 0; i < 48; i++) {
+            in[i] = r[des_e[i] - 1] ^ key[ks[i]].v;
+        }
+
+        BS_FN(sbox1)(in, f);
+        BS_FN(sbox2)(in + 6, f + 4);
+        BS_FN(sbox3)(in + 12, f + 8);
+        BS_FN(sbox4)(in + 18, f + 12);
+        BS_FN(sbox5)(in + 24, f + 16);
+        BS_FN(sbox6)(in + 30, f + 20);
+        BS_FN(sbox7)(in + 36, f + 24);
+        BS_FN(sbox8)(in + 42, f + 28);
+
+        for (int i = 0; i < 32; i++) {
+            l[i] ^= f[des_p[i] - 1];
+        }
+
+        bs_vec *t = l;
+        l = r;
+        r = t;
+    }
+
+    // the last round does not swap
+    for (int i = 0; i < 64; i++) {
+        uint8_t n = ctx->fp[i];
+        out[i].v = (n < 32) ? r[n] : l[n - 32];
+    }
+}
+
+// s = a + b mod 256, bit 0 first
+static inline BS_TARGET void BS_FN(add8)(const bs_vec *a, const bs_vec *b, bs_vec *s) {
+    bs_vec c = a[0] & b[0];
+    s[0] = a[0] ^ b[0];
+    for (int i = 1; i < 7; i++) {
+        bs_vec x = a[i] ^ b[i];
+        s[i] = x ^ c;
+        c = (a[i] & b[i]) | (c & x);
+    }
+    s[7] = a[7] ^ b[7] ^ c;
+}
+
+// v = v >= d ? v - d : v,  for the bits wide v
+static inline BS_TARGET void BS_FN(sub_below)(bs_vec *v, int bits, uint32_t d) {
+    const bs_vec zero = {0};
+    bs_vec s[8], br = zero;
+    for (int i = 0; i < bits; i++) {
+        if ((d >> i) & 1) {
+            s[i] = ~v[i] ^ br;
+            br = ~v[i] | br;
+        } else {
+            s[i] = v[i] ^ br;
+            br = ~v[i] & br;
+        }
+    }
+    // borrow out means v < d
+    for (int i = 0; i < bits; i++) {
+        v[i] = (v[i] & br) | (s[i] & ~br);
+    }
+}
+
+// v = v + n, for the bits wide v
+static inline BS_TARGET void BS_FN(add_const)(bs_vec *v, int bits, uint32_t n) {
+    const bs_vec zero = {0};
+    bs_vec c = zero;
+    for (int i = 0; i < bits; i++) {
+        if ((n >> i) & 1) {
+            bs_vec t = v[i] | c;
+            v[i] = ~(v[i] ^ c);
+            c = t;
+        } else {
+            bs_vec t = v[i] & c;
+            v[i] ^= c;
+            c = t;
+        }
+    }
+}
+
+// hash0 on the DES output, see ikeys.c. c comes msb first, the diversified key
+// goes out the same way, byte after byte
+static BS_TARGET void BS_FN(hash0)(const bs_slice *c, bs_slice *k) {
+    const bs_vec zero = {0};
+    bs_vec x[8], z[8][6];
+
+    // x, y and z values in swapZvalues order. x bit j is c bit 56 + j
+    for (int j = 0; j < 8; j++) {
+        x[j] = c[7 - j].v;
+    }
+    for (int i = 0; i < 8; i++) {
+        for (int j = 0; j < 6; j++) {
+            z[i][j] = c[63 - 6 * i - j].v;
+        }
+    }
+
+    // z'[n] = z[n] mod (63 - n) + n,  z'[n + 4] = z[n + 4] mod (64 - n) + n
+    // z is below twice the modulus, one conditional subtraction will do
+    for (int n = 0; n < 4; n++) {
+        BS_FN(sub_below)(z[n], 6, 63 - n);
+        BS_FN(add_const)(z[n], 6, n);
+        if (n) {
+            BS_FN(sub_below)(z[n + 4], 6, 64 - n);
+            BS_FN(add_const)(z[n + 4], 6, n);
+        }
+    }
+
+    // check(), ck(3, 2, ..) on both halves
+    for (int g = 0; g < 8; g += 4) {
+        for (int i = 3; i > 0; i--) {
+            for (int j = i - 1; j >= 0; j--) {
+                bs_vec ne = zero;
+                for (int b = 0; b < 6; b++) {
+                    ne |= z[g + i][b] ^ z[g + j][b];
+                }
+                for (int b = 0; b < 6; b++) {
+                    z[g + i][b] = ((j >> b) & 1) ? (z[g + i][b] | ~ne) : (z[g + i][b] & ne);
+                }
+            }
+        }
+    }
+
+    // p = pi[x mod 35], complemented for odd x
+    bs_vec xm[8], p[8], lo[8], hi[5];
+    for (int j = 0; j < 8; j++) {
+        xm[j] = x[j];
+    }
+    BS_FN(sub_below)(xm, 8, 140);
+    BS_FN(sub_below)(xm, 8, 70);
+    BS_FN(sub_below)(xm, 8, 35);
+
+    for (int v = 0; v < 8; v++) {
+        lo[v] = (((v >> 2) & 1) ? xm[2] : ~xm[2]) & (((v >> 1) & 1) ? xm[1] : ~xm[1]) & ((v & 1) ? xm[0] : ~xm[0]);
+    }
+    for (int v = 0; v < 5; v++) {
+        hi[v] = (((v >> 2) & 1) ? xm[5] : ~xm[5]) & (((v >> 1) & 1) ? xm[4] : ~xm[4]) & ((v & 1) ? xm[3] : ~xm[3]);
+    }
+    for (int j = 0; j < 8; j++) {
+        p[j] = zero;
+    }
+    for (int v = 0; v < 35; v++) {
+        bs_vec is = hi[v >> 3] & lo[v & 7];
+        for (int j = 0; j < 8; j++) {
+            if ((hash0_pi[v] >> j) & 1) {
+                p[j] |= is;
+            }
+        }
+    }
+    for (int j = 0; j < 8; j++) {
+        p[j] ^= x[0];
+    }
+
+    // permute(): bit i of p picks z[l] + 1 or z[r], l counting the ones of p below i
+    // and r = 4 + the zeroes. cnt[l] is set where l ones have been seen
+    bs_vec zinc[4][6], cnt[5];
+    for (int i = 0; i < 4; i++) {
+        for (int b = 0; b < 6; b++) {
+            zinc[i][b] = z[i][b];
+        }
+        BS_FN(add_const)(zinc[i], 6, 1);
+    }
+    cnt[0] = ~zero;
+    for (int l = 1; l < 5; l++) {
+        cnt[l] = zero;
+    }
+
+    for (int i = 0; i < 8; i++) {
+        bs_vec zt[6];
+        for (int b = 0; b < 6; b++) {
+            bs_vec one = zero, nul = zero;
+            for (int l = 0; l <= i && l < 4; l++) {
+                one |= cnt[l] & zinc[l][b];
+            }
+            for (int l = (i > 3) ? i - 3 : 0; l <= i && l < 5; l++) {
+                nul |= cnt[l] & z[4 + i - l][b];
+            }
+            zt[b] = (p[i] & one) | (~p[i] & nul);
+        }
+
+        for (int l = 4; l > 0; l--) {
+            cnt[l] = (cnt[l] & ~p[i]) | (cnt[l - 1] & p[i]);
+        }
+        cnt[0] &= ~p[i];
+
+        // k[i] = y(i) ? (1 | ~zt << 1 | p(i)) + 1 : zt << 1 | ~p(i)
+        bs_vec y = c[15 - i].v;
+        bs_vec v[8], inc[8];
+        v[0] = p[i];
+        for (int b = 0; b < 6; b++) {
+            v[b + 1] = ~zt[b];
+        }
+        v[7] = ~zero;
+        bs_vec carry = v[0];
+        inc[0] = ~v[0];
+        for (int b = 1; b < 8; b++) {
+            inc[b] = v[b] ^ carry;
+            carry &= v[b];
+        }
+
+        k[(i << 3) | 7].v = (y & inc[0]) | (~y & ~p[i]);
+        for (int b = 0; b < 6; b++) {
+            k[(i << 3) | (6 - b)].v = (y & inc[b + 1]) | (~y & zt[b]);
+        }
+        k[i << 3].v = y & inc[7];
+    }
+}
+
+// iClass MAC of the item cc_nr under every lane's diversified key, as in cipher.c
+// with the registers one bitslice per bit, bit 0 first. Lanes cleared in live are
+// skipped. Returns the first lane giving the expected MAC or -1
+static BS_TARGET int BS_FN(mac)(const elite_bs_ctx_t *ctx, const bs_slice *div, const bs_slice *live) {
+    const bs_vec zero = {0};
+    bs_vec k[8][8];
+    bs_vec l[8], r[8], b[8], t[16];
+
+    // k[byte][bit], the slices come msb first
+    for (int i = 0; i < 8; i++) {
+        for (int j = 0; j < 8; j++) {
+            k[i][j] = div[(i << 3) | (7 - j)].v;
+        }
+    }
+
+    // init
+    bs_vec x[8], c[8];
+    for (int j = 0; j < 8; j++) {
+        x[j] = ((0x4C >> j) & 1) ? ~k[0][j] : k[0][j];
+        c[j] = ((0xEC >> j) & 1) ? ~zero : zero;
+    }
+    BS_FN(add8)(x, c, l);
+    for (int j = 0; j < 8; j++) {
+        c[j] = ((0x21 >> j) & 1) ? ~zero : zero;
+        b[j] = ((0x4C >> j) & 1) ? ~zero : zero;
+    }
+    BS_FN(add8)(x, c, r);
+    for (int j = 0; j < 16; j++) {
+        t[j] = ((0xE012 >> j) & 1) ? ~zero : zero;
+    }
+
+    bs_vec miss = ~live->v;
+
+    // 96 bits of cc_nr in, then 32 bits of MAC out while clocking zeroes
+    for (int n = 0; n < 96 + 32; n++) {
+
+        if (n >= 96) {
+            miss |= ((ctx->mac >> (n - 96)) & 1) ? ~r[2] : r[2];
+
+            bs_slice m = { .v = miss };
+            uint64_t all = ~0ULL;
+            for (int w = 0; w < BS_WORDS; w++) {
+                all &= m.w[w];
+            }
+            if (all == ~0ULL) {
+                return -1;
+            }
+            if (n == 96 + 31) {
+                break;
+            }
+        }
+
+        const bs_vec y = (n < 96 && ctx->cc_nr[n]) ? ~zero : zero;
+
+        // T(t), B(b) and select(T(t), y, r), see cipher.c. r0 is the msb, r[7]
+        bs_vec tt = t[15] ^ t[14] ^ t[10] ^ t[8] ^ t[5] ^ t[4] ^ t[1] ^ t[0];
+        bs_vec bb = b[6] ^ b[5] ^ b[4] ^ b[0];
+        bs_vec z0 = (r[7] & r[5]) ^ (r[6] & ~r[4]) ^ (r[5] | r[3]);
+        bs_vec z1 = (r[7] | r[5]) ^ (r[2] | r[0]) ^ r[6] ^ r[1] ^ tt ^ y;
+        bs_vec z2 = (r[4] & ~r[2]) ^ (r[3] & r[1]) ^ r[0] ^ tt;
+
+        bs_vec t15 = tt ^ r[7] ^ r[3];
+        for (int j = 0; j < 15; j++) {
+            t[j] = t[j + 1];
+        }
+        t[15] = t15;
+
+        bs_vec b7 = bb ^ r[0];
+        for (int j = 0; j < 7; j++) {
+            b[j] = b[j + 1];
+        }
+        b[7] = b7;
+
+        // k[select] ^ b'
+        bs_vec d[8];
+        bs_vec hi[2] = { ~z0, z0 };
+        bs_vec mid[4] = { hi[0] & ~z1, hi[0] & z1, hi[1] & ~z1, hi[1] & z1 };
+        for (int i = 0; i < 4; i++) {
+            d[i << 1] = mid[i] & ~z2;
+            d[(i << 1) | 1] = mid[i] & z2;
+        }
+
+        bs_vec u[8];
+        for (int j = 0; j < 8; j++) {
+            bs_vec v = d[0] & k[0][j];
+            for (int i = 1; i < 8; i++) {
+                v |= d[i] & k[i][j];
+            }
+            u[j] = v ^ b[j];
+        }
+
+        // l' = u + l + r,  r' = u + l
+        bs_vec s[8];
+        BS_FN(add8)(u, l, s);
+        BS_FN(add8)(s, r, l);
+        for (int j = 0; j < 8; j++) {
+            r[j] = s[j];
+        }
+    }
+
+    bs_slice m = { .v = miss };
+    for (int w = 0; w < BS_WORDS; w++) {
+        if (~m.w[w]) {
+            return (w << 6) + __builtin_clzll(~m.w[w]);
+        }
+    }
+    return -1;
+}
+
+static BS_TARGET int BS_FN(test)(const elite_bs_ctx_t *ctx, const uint8_t *keys, uint16_t n) {
+    bs_slice sl[64], ct[64], live;
+
+    for (int w = 0; w < BS_WORDS; w++) {
+        live.w[w] = lanes_mask(n, w);
+        load_keys(keys, n, w, (uint64_t *)sl + w, BS_WORDS);
+    }
+
+    // sl is reused for the diversified keys
+    BS_FN(des)(ctx, sl, ct);
+    BS_FN(hash0)(ct, sl);
+    return BS_FN(mac)(ctx, sl, &live);
+}
+
+static const elite_bs_engine_t BS_FN(engine) = { BS_NAME, BS_BITS, BS_FN(test) };
+
+#undef BS_SEL
+#undef BS_COLS
+#undef BS_COLS_
+#undef BS_ROW
+#undef BS_UNPACK
+#undef BS_OUT
+#undef BS_SBOX
+#undef BS_SBOX_
@@ -41,6 +41,7 @@
 #include "cipher.h"
 #include "ikeys.h"
 #include "elite_crack.h"
+#include "elite_bs.h"
 #include "fileutils.h"
 #include "mbedtls/des.h"
 #include "util_posix.h"
@@ -172,21 +173,19 @@ static void rk(uint8_t *key, uint8_t n, uint8_t *outp_key) {
     }
 }
 
-static mbedtls_des_context ctx_enc;
-static mbedtls_des_context ctx_dec;
-
-static void desdecrypt_iclass(uint8_t *iclass_key, uint8_t *input, uint8_t *output) {
+// the caller owns the des context,  so key diversification can run on several threads at once
+static void desdecrypt_iclass(mbedtls_des_context *ctx, uint8_t *iclass_key, uint8_t *input, uint8_t *output) {
     uint8_t key_std_format[8] = {0};
     permutekey_rev(iclass_key, key_std_format);
-    mbedtls_des_setkey_dec(&ctx_dec, key_std_format);
-    mbedtls_des_crypt_ecb(&ctx_dec, input, output);
+    mbedtls_des_setkey_dec(ctx, key_std_format);
+    mbedtls_des_crypt_ecb(ctx, input, output);
 }
 
-static void desencrypt_iclass(uint8_t *iclass_key, uint8_t *input, uint8_t *output) {
+static void desencrypt_iclass(mbedtls_des_context *ctx, uint8_t *iclass_key, uint8_t *input, uint8_t *output) {
     uint8_t key_std_format[8] = {0};
     permutekey_rev(iclass_key, key_std_format);
-    mbedtls_des_setkey_enc(&ctx_enc, key_std_format);
-    mbedtls_des_crypt_ecb(&ctx_enc, input, output);
+    mbedtls_des_setkey_enc(ctx, key_std_format);
+    mbedtls_des_crypt_ecb(ctx, input, output);
 }
 
 /**
@@ -223,8 +222,13 @@ void hash2(uint8_t *key64, uint8_t *outp_keytable) {
     key64_negated[6] = ~key64[6];
     key64_negated[7] = ~key64[7];
 
+    mbedtls_des_context ctx_enc;
+    mbedtls_des_context ctx_dec;
+    mbedtls_des_init(&ctx_enc);
+    mbedtls_des_init(&ctx_dec);
+
     // Once again, key is on iclass-format
-    desencrypt_iclass(key64, key64_negated, z[0]);
+    desencrypt_iclass(&ctx_enc, key64, key64_negated, z[0]);
 
     if (g_debugMode > 0) {
         PrintAndLogEx(DEBUG, "High security custom key (Kcus):");
@@ -235,7 +239,7 @@ void hash2(uint8_t *key64, uint8_t *outp_keytable) {
 
     // y[0]=DES_dec(z[0],~key)
     // Once again, key is on iclass-format
-    desdecrypt_iclass(z[0], key64_negated, y[0]);
+    desdecrypt_iclass(&ctx_dec, z[0], key64_negated, y[0]);
 //    PrintAndLogEx(INFO, "y0  %s",  sprint_hex(y[0],8));
 
     for (uint8_t i = 1; i < 8; i++) {
@@ -243,10 +247,13 @@ void hash2(uint8_t *key64, uint8_t *outp_keytable) {
         rk(key64, i, temp_output);
         //y [i] = DES enc (rk(K cus , i), y [i−1] )
 
-        desdecrypt_iclass(temp_output, z[i - 1], z[i]);
-        desencrypt_iclass(temp_output, y[i - 1], y[i]);
+        desdecrypt_iclass(&ctx_dec, temp_output, z[i - 1], z[i]);
+        desencrypt_iclass(&ctx_enc, temp_output, y[i - 1], y[i]);
     }
 
+    mbedtls_des_free(&ctx_enc);
+    mbedtls_des_free(&ctx_dec);
+
     if (outp_keytable != NULL) {
         for (uint8_t i = 0 ; i < 8 ; i++) {
             memcpy(outp_keytable + i * 16, y[i], 8);
@@ -294,7 +301,7 @@ typedef struct {
     uint8_t bytes_to_recover[3];
     uint8_t key_index[8];
     uint16_t keytable[128];
-    loclass_dumpdata_t item;
+    elite_bs_ctx_t ctx;
 } loclass_thread_arg_t;
 
 typedef struct {
@@ -309,84 +316,75 @@ static void *bf_thread(void *thread_arg) {
     loclass_thread_arg_t *targ = (loclass_thread_arg_t *)thread_arg;
     const uint32_t endmask = targ->endmask;
     const uint8_t numbytes_to_recover = targ->numbytes_to_recover;
-    uint32_t brute = targ->thread_idx;
+    const elite_bs_engine_t *bs = elite_bs_engine(0);
+    const uint16_t lanes = bs->lanes;
+
+    // every thread takes batches of lanes brute values, interleaved with the others
+    uint32_t brute = targ->thread_idx * lanes;
 
-    uint8_t csn[8];
-    uint8_t cc_nr[12];
-    uint8_t mac[4];
     uint8_t key_index[8];
     uint8_t bytes_to_recover[3];
     uint16_t keytable[128];
+    uint8_t keys[ELITE_BS_MAX_LANES * 8];
 
-    memcpy(csn, targ->item.csn, sizeof(csn));
-    memcpy(cc_nr, targ->item.cc_nr, sizeof(cc_nr));
-    memcpy(mac, targ->item.mac, sizeof(mac));
     memcpy(key_index, targ->key_index, sizeof(key_index));
     memcpy(bytes_to_recover, targ->bytes_to_recover, sizeof(bytes_to_recover));
     memcpy(keytable, targ->keytable, sizeof(keytable));
 
-    while (!(brute & endmask)) {
+    while (brute < endmask) {
 
         int found = __atomic_load_n(&loclass_found, __ATOMIC_SEQ_CST);
 
         if (found != 0xFF) return NULL;
 
-        //Update the keytable with the brute-values
-        for (uint8_t i = 0; i < numbytes_to_recover; i++) {
-            keytable[bytes_to_recover[i]] &= 0xFF00;
-            keytable[bytes_to_recover[i]] |= (brute >> (i * 8) & 0xFF);
-        }
-
-        uint8_t key_sel[8] = {0};
+        uint16_t n = 0;
+        for (; n < lanes && brute + n < endmask; n++) {
 
-        // Piece together the key
-        key_sel[0] = keytable[key_index[0]] & 0xFF;
-        key_sel[1] = keytable[key_index[1]] & 0xFF;
-        key_sel[2] = keytable[key_index[2]] & 0xFF;
-        key_sel[3] = keytable[key_index[3]] & 0xFF;
-        key_sel[4] = keytable[key_index[4]] & 0xFF;
-        key_sel[5] = keytable[key_index[5]] & 0xFF;
-        key_sel[6] = keytable[key_index[6]] & 0xFF;
-        key_sel[7] = keytable[key_index[7]] & 0xFF;
-
-        // Permute from iclass format to standard format
-
-        uint8_t key_sel_p[8] = {0};
-        permutekey_rev(key_sel, key_sel_p);
+            //Update the keytable with the brute-values
+            for (uint8_t i = 0; i < numbytes_to_recover; i++) {
+                keytable[bytes_to_recover[i]] &= 0xFF00;
+                keytable[bytes_to_recover[i]] |= ((brute + n) >> (i * 8) & 0xFF);
+            }
 
-        // Diversify
-        uint8_t div_key[8] = {0};
-        diversifyKey(csn, key_sel_p, div_key);
+            // Piece together the key
+            uint8_t *key_sel = keys + (n * 8);
+            for (uint8_t i = 0; i < 8; i++) {
+                key_sel[i] = keytable[key_index[i]] & 0xFF;
+            }
+        }
 
-        // Calc mac
-        uint8_t calculated_MAC[4] = {0};
-        doMAC(cc_nr, div_key, calculated_MAC);
+        // Permute to standard format, diversify and calc mac for the whole batch
+        int hit = bs->test(&targ->ctx, keys, n);
 
         // success
-        if (memcmp(calculated_MAC, mac, 4) == 0) {
+        if (hit >= 0) {
 
             loclass_thread_ret_t *r = (loclass_thread_ret_t *)malloc(sizeof(loclass_thread_ret_t));
 
-            for (uint8_t i = 0 ; i < numbytes_to_recover; i++) {
-                r->values[i] = keytable[bytes_to_recover[i]] & 0xFF;
+            for (uint8_t i = 0 ; i < numbytes_to_recover && i < sizeof(r->values); i++) {
+                r->values[i] = ((brute + hit) >> (i * 8)) & 0xFF;
             }
             __atomic_store_n(&loclass_found, targ->thread_idx, __ATOMIC_SEQ_CST);
             pthread_exit((void *)r);
         }
 
-        brute += loclass_tc;
+        // the stride need not divide the print interval, report when brute passes a multiple of it
+        uint32_t prev = brute;
+        brute += loclass_tc * lanes;
 
 #define _CLR_ "\x1b[0K"
 
-        if (numbytes_to_recover == 3) {
-            if ((brute > 0) && ((brute & 0xFFFF) == 0)) {
+        if (brute >= endmask) {
+            break;
+        } else if (numbytes_to_recover == 3) {
+            if ((brute >> 16) != (prev >> 16)) {
                 PrintAndLogEx(INPLACE, "[ %02x %02x %02x ] %8u / %u", bytes_to_recover[0], bytes_to_recover[1], bytes_to_recover[2], brute, 0xFFFFFF);
             }
         } else if (numbytes_to_recover == 2) {
-            if ((brute > 0) && ((brute & 0x3F) == 0))
+            if ((brute >> 6) != (prev >> 6))
                 PrintAndLogEx(INPLACE, "[ %02x %02x ] %5u / %u" _CLR_, bytes_to_recover[0], bytes_to_recover[1], brute, 0xFFFF);
         } else {
-            if ((brute > 0) && ((brute & 0x1F) == 0))
+            if ((brute >> 5) != (prev >> 5))
                 PrintAndLogEx(INPLACE, "[ %02x ] %3u / %u" _CLR_, bytes_to_recover[0], brute, 0xFF);
         }
     }
@@ -450,7 +448,7 @@ int bruteforceItem(loclass_dumpdata_t item, uint16_t keytable[]) {
         args[i].numbytes_to_recover = numbytes_to_recover;
         args[i].endmask = 1 << 8 * numbytes_to_recover;
 
-        memcpy((void *)&args[i].item, (void *)&item, sizeof(loclass_dumpdata_t));
+        elite_bs_init(&args[i].ctx, &item);
         memcpy(args[i].bytes_to_recover, bytes_to_recover, sizeof(args[i].bytes_to_recover));
         memcpy(args[i].key_index, key_index, sizeof(args[i].key_index));
         memcpy(args[i].keytable, keytable, sizeof(args[i].keytable));
@@ -728,7 +726,7 @@ int bruteforceDump(uint8_t dump[], size_t dumpsize, uint16_t keytable[]) {
     }
 
     loclass_tc = num_CPUs();
-    PrintAndLogEx(INFO, "bruteforce using " _YELLOW_("%zu") " threads", loclass_tc);
+    PrintAndLogEx(INFO, "bruteforce using " _YELLOW_("%zu") " threads, " _YELLOW_("%s") " ( %u keys per call )", loclass_tc, elite_bs_engine(0)->name, elite_bs_engine(0)->lanes);
 
     int res = 0;
 
@@ -868,6 +866,106 @@ static int _testHash1(void) {
     return PM3_SUCCESS;
 }
 
+// one dump item from a random key_sel, the way the reader computes the MAC
+static void _bs_make_item(uint32_t *seed, loclass_dumpdata_t *item, uint8_t key_sel[8]) {
+    uint8_t *p = (uint8_t *)item;
+    for (size_t i = 0; i < sizeof(loclass_dumpdata_t); i++) {
+        *seed = *seed * 1103515245 + 12345;
+        p[i] = (*seed >> 16) & 0xFF;
+    }
+
+    uint8_t key_sel_p[8] = {0};
+    uint8_t div_key[8] = {0};
+    permutekey_rev(key_sel, key_sel_p);
+    diversifyKey(item->csn, key_sel_p, div_key);
+    doMAC(item->cc_nr, div_key, item->mac);
+}
+
+static int _testBitslice(void) {
+    uint32_t seed = 0x5B7C62C4;
+    uint8_t keys[ELITE_BS_MAX_LANES * 8];
+    for (size_t i = 0; i < sizeof(keys); i++) {
+        seed = seed * 1103515245 + 12345;
+        keys[i] = (seed >> 16) & 0xFF;
+    }
+
+    loclass_dumpdata_t item;
+    elite_bs_ctx_t ctx;
+    int res = PM3_SUCCESS;
+
+    // every engine has to find the right key where it is put, and nothing past n
+    for (uint8_t e = 0; elite_bs_engine(e) != NULL; e++) {
+        const elite_bs_engine_t *bs = elite_bs_engine(e);
+        bool ok = true;
+
+        for (uint16_t t = 0; t < 32; t++) {
+            uint16_t n = (t & 1) ? bs->lanes : 1 + (t * 37) % bs->lanes;
+            int expected = (t * 101) % n;
+            if (t % 8 == 7 && n < bs->lanes) {
+                _bs_make_item(&seed, &item, keys + n * 8);
+                expected = -1;
+            } else {
+                _bs_make_item(&seed, &item, keys + expected * 8);
+            }
+            elite_bs_init(&ctx, &item);
+
+            if (bs->test(&ctx, keys, n) != expected) {
+                ok = false;
+            }
+        }
+
+        PrintAndLogEx(ok ? SUCCESS : FAILED, "    %-6s %3u keys per call ( %s )", bs->name, bs->lanes, ok ? _GREEN_("ok") : _RED_("fail"));
+        if (ok == false) {
+            res = PM3_ESOFT;
+        }
+    }
+
+    if (res != PM3_SUCCESS) {
+        return res;
+    }
+
+    // the same chain, one key at a time, bf_thread did it before
+    PrintAndLogEx(INFO, "Benchmarking key recovery...");
+    _bs_make_item(&seed, &item, keys);
+    elite_bs_ctx_t ctxs;
+    elite_bs_init(&ctxs, &item);
+
+    uint64_t cnt = 0;
+    uint64_t t1 = msclock();
+    uint64_t t2 = t1;
+    while (t2 - t1 < 250) {
+        for (uint16_t i = 0; i < 256; i++) {
+            uint8_t key_sel_p[8] = {0};
+            uint8_t div_key[8] = {0};
+            uint8_t calculated_MAC[4] = {0};
+            permutekey_rev(keys + (i * 8), key_sel_p);
+            diversifyKey(item.csn, key_sel_p, div_key);
+            doMAC(item.cc_nr, div_key, calculated_MAC);
+        }
+        cnt += 256;
+        t2 = msclock();
+    }
+    double ref = cnt * 1000.0 / (t2 - t1);
+    PrintAndLogEx(SUCCESS, "    %-6s %10.0f keys/s", "ref", ref);
+
+    for (uint8_t e = 0; elite_bs_engine(e) != NULL; e++) {
+        const elite_bs_engine_t *bs = elite_bs_engine(e);
+        cnt = 0;
+        t1 = msclock();
+        t2 = t1;
+        while (t2 - t1 < 250) {
+            for (uint16_t i = 0; i < 64; i++) {
+                bs->test(&ctxs, keys, bs->lanes);
+            }
+            cnt += 64 * bs->lanes;
+            t2 = msclock();
+        }
+        double rate = cnt * 1000.0 / (t2 - t1);
+        PrintAndLogEx(SUCCESS, "    %-6s %10.0f keys/s  x%.0f", bs->name, rate, rate / ref);
+    }
+    return PM3_SUCCESS;
+}
+
 int testElite(bool slowtests) {
     PrintAndLogEx(INFO, "Testing iClass Elite functionality");
     PrintAndLogEx(INFO, "Testing hash2...");
@@ -904,6 +1002,13 @@ int testElite(bool slowtests) {
     res += _test_iclass_key_permutation();
     PrintAndLogEx((res == PM3_SUCCESS) ? SUCCESS : WARNING, "    key diversification ( %s )", (res == PM3_SUCCESS) ? _GREEN_("ok") : _RED_("fail"));
 
+    PrintAndLogEx(INFO, "Testing bitsliced key recovery...");
+    // hash0 debug output would drown the benchmark
+    uint8_t dbg = g_debugMode;
+    g_debugMode = 0;
+    res += _testBitslice();
+    g_debugMode = dbg;
+
     if (slowtests)
         res += _testBruteforce();
 
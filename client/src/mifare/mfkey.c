@@ -19,6 +19,8 @@
 #include "mfkey.h"
 
 #include "crapto1/crapto1.h"
+#include "crapto1/crypto1_bs.h"
+#include "util.h"               // num_CPUs
 
 // MIFARE
 int inline compare_uint64(const void *a, const void *b) {
@@ -96,33 +98,84 @@ uint32_t nonce2key(uint32_t uid, uint32_t nt, uint32_t nr, uint32_t ar, uint64_t
     return i;
 }
 
-// recover key from 2 different reader responses on same tag challenge
-bool mfkey32(nonces_t *data, uint64_t *outputkey) {
-    struct Crypto1State *s, *t;
-    uint64_t outkey = 0;
-    uint64_t key = 0;     // recovered key
-    bool isSuccess = false;
-    uint8_t counter = 0;
+// multi-threaded recoveries, the tables are freed again before returning
+struct Crypto1State *mfkey_recovery32(uint32_t ks2, uint32_t in) {
+    struct Crypto1Recovery *recovery = lfsr_recovery_create(num_CPUs());
+    if (recovery == NULL)
+        return lfsr_recovery32(ks2, in);
 
-    uint32_t p640 = prng_successor(data->nonce, 64);
+    struct Crypto1State *s = lfsr_recovery32_ex(recovery, ks2, in);
+    lfsr_recovery_destroy(recovery);
+    return s;
+}
+
+struct Crypto1State *mfkey_recovery64(uint32_t ks2, uint32_t ks3) {
+    struct Crypto1Recovery *recovery = lfsr_recovery_create(num_CPUs());
+    if (recovery == NULL)
+        return lfsr_recovery64(ks2, ks3);
+
+    struct Crypto1State *s = lfsr_recovery64_ex(recovery, ks2, ks3);
+    lfsr_recovery_destroy(recovery);
+    return s;
+}
 
-    s = lfsr_recovery32(data->ar ^ p640, 0);
-
-    for (t = s; t->odd | t->even; ++t) {
-        lfsr_rollback_word(t, 0, 0);
-        lfsr_rollback_word(t, data->nr, 1);
-        lfsr_rollback_word(t, data->cuid ^ data->nonce, 0);
-        crypto1_get_lfsr(t, &key);
-        crypto1_word(t, data->cuid ^ data->nonce, 0);
-        crypto1_word(t, data->nr2, 1);
-        if (data->ar2 == (crypto1_word(t, 0, 0) ^ p640)) {
-            outkey = key;
-            counter++;
-            if (counter == 20) break;
+// roll a recovered state back to the key and queue it for batched verification.
+// returns true when a full batch of CRYPTO1_BS_WIDTH keys is queued
+static bool mfkey32_queue_key(struct Crypto1State *t, nonces_t *data, uint64_t *keys, size_t *n) {
+    lfsr_rollback_word(t, 0, 0);
+    lfsr_rollback_word(t, data->nr, 1);
+    lfsr_rollback_word(t, data->cuid ^ data->nonce, 0);
+    crypto1_get_lfsr(t, &keys[(*n)++]);
+    return *n == CRYPTO1_BS_WIDTH;
+}
+
+// run a batch of candidate keys through the second authentication and count the ones
+// producing the second reader response. Stops counting at 20 like the scalar loop did.
+static void mfkey32_check_batch(const uint64_t *keys, size_t n, uint32_t nonce, nonces_t *data, uint32_t ks2, uint64_t *outkey, int *counter) {
+    struct Crypto1BsState bs;
+    uint64_t match[CRYPTO1_BS_WORDS];
+
+    crypto1_bs_init(&bs, keys, n);
+    crypto1_bs_word(&bs, data->cuid ^ nonce, 0, NULL);
+    crypto1_bs_word(&bs, data->nr2, 1, NULL);
+    if (crypto1_bs_word_match(&bs, 0, 0, ks2, match) == 0)
+        return;
+
+    for (size_t i = 0; i < n && *counter < 20; i++) {
+        if (BIT(match[i >> 6], i & 0x3f)) {
+            *outkey = keys[i];
+            (*counter)++;
         }
     }
-    isSuccess = (counter == 1);
+}
+
+// verify all states recovered from the first reader response against the second one
+static bool mfkey32_verify(struct Crypto1State *s, nonces_t *data, uint32_t nonce2, uint32_t p64, uint64_t *outputkey) {
+    uint64_t keys[CRYPTO1_BS_WIDTH];
+    uint64_t outkey = 0;
+    size_t n = 0;
+    int counter = 0;
+
+    for (struct Crypto1State *t = s; (t->odd | t->even) && counter < 20; ++t) {
+        if (mfkey32_queue_key(t, data, keys, &n)) {
+            mfkey32_check_batch(keys, n, nonce2, data, data->ar2 ^ p64, &outkey, &counter);
+            n = 0;
+        }
+    }
+    if (n && counter < 20)
+        mfkey32_check_batch(keys, n, nonce2, data, data->ar2 ^ p64, &outkey, &counter);
+
+    bool isSuccess = (counter == 1);
     *outputkey = (isSuccess) ? outkey : 0;
+    return isSuccess;
+}
+
+// recover key from 2 different reader responses on same tag challenge
+bool mfkey32(nonces_t *data, uint64_t *outputkey) {
+    uint32_t p640 = prng_successor(data->nonce, 64);
+
+    struct Crypto1State *s = mfkey_recovery32(data->ar ^ p640, 0);
+    bool isSuccess = mfkey32_verify(s, data, data->nonce, p640, outputkey);
     crypto1_destroy(s);
     return isSuccess;
 }
@@ -130,32 +183,11 @@ bool mfkey32(nonces_t *data, uint64_t *outputkey) {
 // recover key from 2 reader responses on 2 different tag challenges
 // skip "several found keys".  Only return true if ONE key is found
 bool mfkey32_moebius(nonces_t *data, uint64_t *outputkey) {
-    struct Crypto1State *s, *t;
-    uint64_t outkey  = 0;
-    uint64_t key     = 0; // recovered key
-    bool isSuccess = false;
-    int counter = 0;
     uint32_t p640 = prng_successor(data->nonce, 64);
     uint32_t p641 = prng_successor(data->nonce2, 64);
 
-    s = lfsr_recovery32(data->ar ^ p640, 0);
-
-    for (t = s; t->odd | t->even; ++t) {
-        lfsr_rollback_word(t, 0, 0);
-        lfsr_rollback_word(t, data->nr, 1);
-        lfsr_rollback_word(t, data->cuid ^ data->nonce, 0);
-        crypto1_get_lfsr(t, &key);
-
-        crypto1_word(t, data->cuid ^ data->nonce2, 0);
-        crypto1_word(t, data->nr2, 1);
-        if (data->ar2 == (crypto1_word(t, 0, 0) ^ p641)) {
-            outkey = key;
-            ++counter;
-            if (counter == 20) break;
-        }
-    }
-    isSuccess  = (counter == 1);
-    *outputkey = (isSuccess) ? outkey : 0;
+    struct Crypto1State *s = mfkey_recovery32(data->ar ^ p640, 0);
+    bool isSuccess = mfkey32_verify(s, data, data->nonce2, p641, outputkey);
     crypto1_destroy(s);
     return isSuccess;
 }
@@ -170,7 +202,7 @@ int mfkey64(nonces_t *data, uint64_t *outputkey) {
     // Extract the keystream from the messages
     ks2 = data->ar ^ prng_successor(data->nonce, 64);
     ks3 = data->at ^ prng_successor(data->nonce, 96);
-    revstate = lfsr_recovery64(ks2, ks3);
+    revstate = mfkey_recovery64(ks2, ks3);
     lfsr_rollback_word(revstate, 0, 0);
     lfsr_rollback_word(revstate, 0, 0);
     lfsr_rollback_word(revstate, data->nr, 1);
@@ -24,6 +24,9 @@
 #include "mifare.h"
 
 uint32_t nonce2key(uint32_t uid, uint32_t nt, uint32_t nr, uint32_t ar, uint64_t par_info, uint64_t ks_info, uint64_t **keys);
+// multi-threaded lfsr_recovery32/64, same results
+struct Crypto1State *mfkey_recovery32(uint32_t ks2, uint32_t in);
+struct Crypto1State *mfkey_recovery64(uint32_t ks2, uint32_t ks3);
 bool mfkey32(nonces_t *data, uint64_t *outputkey);
 bool mfkey32_moebius(nonces_t *data, uint64_t *outputkey);
 int mfkey64(nonces_t *data, uint64_t *outputkey);
@@ -388,6 +388,11 @@ inline static int Compare16Bits(const void *a, const void *b) {
     return -1;
 }
 
+// the two nested worker threads split the recovery threads between them
+static uint32_t nested_recovery_threads(uint32_t lists) {
+    return MAX(1, MIN(num_CPUs(), LFSR_RECOVERY_MAX_THREADS) / lists);
+}
+
 // wrapper function for multi-threaded lfsr_recovery32
 static void
 #ifdef __has_attribute
@@ -398,7 +403,14 @@ __attribute__((force_align_arg_pointer))
 *nested_worker_thread(void *arg) {
     struct Crypto1State *p1;
     StateList_t *statelist = arg;
-    statelist->head.slhead = lfsr_recovery32(statelist->ks1, statelist->nt_enc ^ statelist->uid);
+    // the recovery tables only live for this run
+    struct Crypto1Recovery *recovery = lfsr_recovery_create(statelist->num_threads);
+    if (recovery) {
+        statelist->head.slhead = lfsr_recovery32_ex(recovery, statelist->ks1, statelist->nt_enc ^ statelist->uid);
+        lfsr_recovery_destroy(recovery);
+    } else {
+        statelist->head.slhead = lfsr_recovery32(statelist->ks1, statelist->nt_enc ^ statelist->uid);
+    }
 
     for (p1 = statelist->head.slhead; p1->odd | p1->even; p1++) {};
 
@@ -462,6 +474,7 @@ int mfnested(uint8_t blockNo, uint8_t keyType, uint8_t *key, uint8_t trgBlockNo,
         statelists[i].blockNo = package->block;
         statelists[i].keyType = package->keytype;
         statelists[i].uid = uid;
+        statelists[i].num_threads = nested_recovery_threads(2);
     }
 
     memcpy(&statelists[0].nt_enc,  package->nt_a, sizeof(package->nt_a));
@@ -627,6 +640,7 @@ int mfStaticNested(uint8_t blockNo, uint8_t keyType, uint8_t *key, uint8_t trgBl
         statelists[i].blockNo = package->block;
         statelists[i].keyType = package->keytype;
         statelists[i].uid = uid;
+        statelists[i].num_threads = nested_recovery_threads(2);
     }
 
     memcpy(&statelists[0].nt_enc, package->nt_a, sizeof(package->nt_a));
@@ -700,6 +714,7 @@ int mfStaticNested(uint8_t blockNo, uint8_t keyType, uint8_t *key, uint8_t trgBl
         statelists[0].blockNo = package->block;
         statelists[0].keyType = package->keytype;
         statelists[0].uid = uid;
+        statelists[0].num_threads = nested_recovery_threads(1);
 
         memcpy(&statelists[0].nt_enc, package->nt, sizeof(package->nt));
         memcpy(&statelists[0].ks1, package->ks, sizeof(package->ks));
@@ -1203,7 +1218,7 @@ int tryDecryptWord(uint32_t nt, uint32_t ar_enc, uint32_t at_enc, uint8_t *data,
     struct Crypto1State *s;
     uint32_t ks2 = ar_enc ^ prng_successor(nt, 64);
     uint32_t ks3 = at_enc ^ prng_successor(nt, 96);
-    s = lfsr_recovery64(ks2, ks3);
+    s = mfkey_recovery64(ks2, ks3);
     mf_crypto1_decrypt(s, data, len, false);
     PrintAndLogEx(SUCCESS, "decrypted data... " _YELLOW_("%s"), sprint_hex(data, len));
     PrintAndLogEx(NORMAL, "");
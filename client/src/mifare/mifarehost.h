@@ -51,6 +51,7 @@ typedef struct {
     uint32_t keyType;
     uint32_t nt_enc;
     uint32_t ks1;
+    uint32_t num_threads;   // lfsr_recovery32 threads
 } StateList_t;
 
 typedef struct {
@@ -84,6 +84,7 @@ const static vocabulory_t vocabulory[] = {
     { 1, "data dirthreshold" },
     { 1, "data decimate" },
     { 1, "data undecimate" },
+    { 1, "data undo" },
     { 1, "data hide" },
     { 1, "data hpf" },
     { 1, "data iir" },
@@ -457,6 +458,7 @@ const static vocabulory_t vocabulory[] = {
     { 0, "hw tune" },
     { 1, "hw version" },
     { 1, "lf help" },
+    { 1, "lf batch" },
     { 0, "lf config" },
     { 0, "lf cmdread" },
     { 0, "lf read" },
@@ -72,8 +72,18 @@ int minElement(vector<D> const &v){
     return min;
 }
 
-static int s_Buff[MAX_GRAPH_TRACE_LEN];
+// keeps the command thread from moving the graph buffer while the GUI thread uses it
+class GraphLock {
+  public:
+    GraphLock() { graph_lock(); }
+    ~GraphLock() { graph_unlock(); }
+};
+
+// overlay samples,  follows the graph buffer in length
+static std::vector<int> s_Buff;
 static bool gs_useOverlays = false;
+// bumped by RepaintGraphWindow(), the buffers may have changed anywhere
+static uint32_t gs_graphGeneration = 1;
 static int gs_absVMax = 0;
 static uint32_t startMax; // Maximum offset in the graph (right side of graph)
 static uint32_t PageWidth; // How many samples are currently visible on this 'page' / graph
@@ -173,6 +183,7 @@ void ProxGuiQT::_RepaintGraphWindow(void) {
     if (!plotapp || !plotwidget)
         return;
 
+    gs_graphGeneration++;
     plotwidget->update();
 }
 
@@ -405,39 +416,50 @@ void SliderWidget::moveEvent(QMoveEvent *event) {
 
 //--------------------
 void ProxWidget::applyOperation() {
+    GraphLock lock;
     //printf("ApplyOperation()");
     save_restoreGB(GRAPH_SAVE);
-    memcpy(g_GraphBuffer, s_Buff, sizeof(int) * g_GraphTraceLen);
+    if (s_Buff.size() < g_GraphTraceLen) return;
+    memcpy(g_GraphBuffer, s_Buff.data(), sizeof(int) * g_GraphTraceLen);
     RepaintGraphWindow();
 }
 void ProxWidget::stickOperation() {
+    GraphLock lock;
     save_restoreGB(GRAPH_RESTORE);
     //printf("stickOperation()");
 }
 void ProxWidget::vchange_autocorr(int v) {
-    int ans = AutoCorrelate(g_GraphBuffer, s_Buff, g_GraphTraceLen, v, true, false);
+    GraphLock lock;
+    s_Buff.resize(g_GraphTraceLen);
+    int ans = AutoCorrelate(g_GraphBuffer, s_Buff.data(), g_GraphTraceLen, v, true, false);
     if (g_debugMode) printf("vchange_autocorr(w:%d): %d\n", v, ans);
     gs_useOverlays = true;
     RepaintGraphWindow();
 }
 void ProxWidget::vchange_askedge(int v) {
+    GraphLock lock;
+    s_Buff.resize(g_GraphTraceLen);
     //extern int AskEdgeDetect(const int *in, int *out, int len, int threshold);
-    int ans = AskEdgeDetect(g_GraphBuffer, s_Buff, g_GraphTraceLen, v);
+    int ans = AskEdgeDetect(g_GraphBuffer, s_Buff.data(), g_GraphTraceLen, v);
     if (g_debugMode) printf("vchange_askedge(w:%d)%d\n", v, ans);
     gs_useOverlays = true;
     RepaintGraphWindow();
 }
 void ProxWidget::vchange_dthr_up(int v) {
+    GraphLock lock;
+    s_Buff.resize(g_GraphTraceLen);
     int down = opsController->horizontalSlider_dirthr_down->value();
-    directionalThreshold(g_GraphBuffer, s_Buff, g_GraphTraceLen, v, down);
+    directionalThreshold(g_GraphBuffer, s_Buff.data(), g_GraphTraceLen, v, down);
     //printf("vchange_dthr_up(%d)", v);
     gs_useOverlays = true;
     RepaintGraphWindow();
 }
 void ProxWidget::vchange_dthr_down(int v) {
+    GraphLock lock;
+    s_Buff.resize(g_GraphTraceLen);
     //printf("vchange_dthr_down(%d)", v);
     int up = opsController->horizontalSlider_dirthr_up->value();
-    directionalThreshold(g_GraphBuffer, s_Buff, g_GraphTraceLen, v, up);
+    directionalThreshold(g_GraphBuffer, s_Buff.data(), g_GraphTraceLen, v, up);
     gs_useOverlays = true;
     RepaintGraphWindow();
 }
@@ -555,6 +577,131 @@ void ProxWidget::resizeEvent(QResizeEvent *event) {
     g_session.window_changed = true;
 }
 
+//----------- Level of detail
+
+void GraphLod::invalidate(size_t start, size_t end) {
+    if (dirtyStart >= dirtyEnd) {
+        dirtyStart = start;
+        dirtyEnd = end;
+    } else {
+        dirtyStart = std::min(dirtyStart, start);
+        dirtyEnd = std::max(dirtyEnd, end);
+    }
+}
+
+// make the pyramid match buf, only dirty blocks are rebuilt unless the buffer,
+// its length or the generation changed
+void GraphLod::sync(const int *buf, size_t n, uint32_t gen) {
+    if (buf != buffer || n != len || gen != generation) {
+        buffer = buf;
+        len = n;
+        generation = gen;
+
+        size_t count = 0;
+        for (size_t blocks = (n + LOD_BLOCK - 1) >> LOD_BLOCK_SHIFT; blocks; blocks = (blocks + 1) / 2) {
+            if (levels.size() <= count)
+                levels.emplace_back();
+            levels[count++].resize(blocks);
+            if (blocks == 1)
+                break;
+        }
+        levels.resize(count);
+
+        dirtyStart = 0;
+        dirtyEnd = n;
+    }
+
+    if (dirtyStart < dirtyEnd)
+        rebuild();
+}
+
+void GraphLod::rebuild(void) {
+    size_t end = std::min(dirtyEnd, len);
+    if (levels.empty() || dirtyStart >= end) {
+        dirtyStart = dirtyEnd = 0;
+        return;
+    }
+
+    // level 0 straight from the samples
+    size_t lo = dirtyStart >> LOD_BLOCK_SHIFT;
+    size_t hi = ((end - 1) >> LOD_BLOCK_SHIFT) + 1;
+    for (size_t b = lo; b < hi; b++) {
+        Block blk = { INT_MAX, INT_MIN, 0 };
+        size_t stop = std::min((b + 1) << LOD_BLOCK_SHIFT, len);
+        for (size_t i = b << LOD_BLOCK_SHIFT; i < stop; i++) {
+            int v = buffer[i];
+            if (v < blk.vmin) blk.vmin = v;
+            if (v > blk.vmax) blk.vmax = v;
+            blk.sum += v;
+        }
+        levels[0][b] = blk;
+    }
+
+    // then the parents of what changed
+    for (size_t k = 1; k < levels.size(); k++) {
+        const std::vector<Block> &child = levels[k - 1];
+        lo >>= 1;
+        hi = (hi + 1) >> 1;
+        for (size_t b = lo; b < hi; b++) {
+            Block blk = child[2 * b];
+            if (2 * b + 1 < child.size()) {
+                const Block &c = child[2 * b + 1];
+                blk.vmin = std::min(blk.vmin, c.vmin);
+                blk.vmax = std::max(blk.vmax, c.vmax);
+                blk.sum += c.sum;
+            }
+            levels[k][b] = blk;
+        }
+    }
+    dirtyStart = dirtyEnd = 0;
+}
+
+// min, max and sum of the samples [start, end)
+void GraphLod::query(size_t start, size_t end, int *vmin, int *vmax, int64_t *sum) const {
+    int lo = INT_MAX, hi = INT_MIN;
+    int64_t total = 0;
+
+    end = std::min(end, len);
+
+    // unaligned head and tail sample by sample
+    while (start < end && (start & (LOD_BLOCK - 1))) {
+        int v = buffer[start++];
+        lo = std::min(lo, v);
+        hi = std::max(hi, v);
+        total += v;
+    }
+    while (end > start && (end & (LOD_BLOCK - 1))) {
+        int v = buffer[--end];
+        lo = std::min(lo, v);
+        hi = std::max(hi, v);
+        total += v;
+    }
+
+    // whole blocks, climbing up while the range allows
+    size_t a = start >> LOD_BLOCK_SHIFT;
+    size_t b = end >> LOD_BLOCK_SHIFT;
+    for (size_t k = 0; a < b && k < levels.size(); k++) {
+        if (a & 1) {
+            const Block &blk = levels[k][a++];
+            lo = std::min(lo, blk.vmin);
+            hi = std::max(hi, blk.vmax);
+            total += blk.sum;
+        }
+        if (b & 1) {
+            const Block &blk = levels[k][--b];
+            lo = std::min(lo, blk.vmin);
+            hi = std::max(hi, blk.vmax);
+            total += blk.sum;
+        }
+        a >>= 1;
+        b >>= 1;
+    }
+
+    *vmin = lo;
+    *vmax = hi;
+    *sum = total;
+}
+
 //----------- Plotting
 
 int Plot::xCoordOf(int i, QRect r) {
@@ -572,6 +719,16 @@ int Plot::valueOf_yCoord(int y, QRect r, int maxVal) {
     return (y - z) * maxVal / z;
 }
 
+// first sample from g_GraphStart on which lands on or right of the plot edge
+uint32_t Plot::visibleEnd(size_t len, QRect r) {
+    uint32_t i = g_GraphStart + (uint32_t)((r.right() - r.left()) / g_GraphPixelsPerPoint);
+    while (i > g_GraphStart && xCoordOf(i - 1, r) >= r.right())
+        i--;
+    while (i < len && xCoordOf(i, r) < r.right())
+        i++;
+    return std::min((size_t)i, len);
+}
+
 static const QColor BLACK     = QColor(0, 0, 0);
 static const QColor GRAY60    = QColor(60, 60, 60);
 static const QColor GRAY100   = QColor(100, 100, 100);
@@ -598,7 +755,7 @@ QColor Plot::getColor(int graphNum) {
     }
 }
 
-void Plot::setMaxAndStart(int *buffer, size_t len, QRect plotRect) {
+void Plot::setMaxAndStart(int *buffer, size_t len, QRect plotRect, int graphNum) {
     if (len == 0) return;
     startMax = 0;
     if (plotRect.right() >= plotRect.left() + 40) {
@@ -610,14 +767,10 @@ void Plot::setMaxAndStart(int *buffer, size_t len, QRect plotRect) {
         g_GraphStart = startMax;
     }
     if (g_GraphStart > len) return;
-    int vMin = INT_MAX, vMax = INT_MIN;
-    uint32_t sample_index = g_GraphStart ;
-    for (; sample_index < len && xCoordOf(sample_index, plotRect) < plotRect.right() ; sample_index++) {
-
-        int v = buffer[sample_index];
-        if (v < vMin) vMin = v;
-        if (v > vMax) vMax = v;
-    }
+    int vMin, vMax;
+    int64_t vSum;
+    lod[graphNum].sync(buffer, len, gs_graphGeneration);
+    lod[graphNum].query(g_GraphStart, visibleEnd(len, plotRect), &vMin, &vMax, &vSum);
 
     gs_absVMax = 0;
     if (fabs((double) vMin) > gs_absVMax) gs_absVMax = (int)fabs((double) vMin);
@@ -692,23 +845,46 @@ void Plot::PlotGraph(int *buffer, size_t len, QRect plotRect, QRect annotationRe
     int x = xCoordOf(g_GraphStart, plotRect);
     int y = yCoordOf(buffer[g_GraphStart], plotRect, gs_absVMax);
     penPath.moveTo(x, y);
-    for (i = g_GraphStart; i < len && xCoordOf(i, plotRect) < plotRect.right(); i++) {
+    if (g_GraphPixelsPerPoint >= 1) {
+        for (i = g_GraphStart; i < len && xCoordOf(i, plotRect) < plotRect.right(); i++) {
 
-        x = xCoordOf(i, plotRect);
-        v = buffer[i];
+            x = xCoordOf(i, plotRect);
+            v = buffer[i];
 
-        y = yCoordOf(v, plotRect, gs_absVMax);
+            y = yCoordOf(v, plotRect, gs_absVMax);
 
-        penPath.lineTo(x, y);
+            penPath.lineTo(x, y);
 
-        if (g_GraphPixelsPerPoint > 10) {
-            QRect f(QPoint(x - 3, y - 3), QPoint(x + 3, y + 3));
-            painter->fillRect(f, GREEN);
+            if (g_GraphPixelsPerPoint > 10) {
+                QRect f(QPoint(x - 3, y - 3), QPoint(x + 3, y + 3));
+                painter->fillRect(f, GREEN);
+            }
+            // catch stats
+            if (v < vMin) vMin = v;
+            if (v > vMax) vMax = v;
+            vMean += v;
         }
+    } else {
+        // more samples than pixels, draw one min/max span per pixel column
+        lod[graphNum].sync(buffer, len, gs_graphGeneration);
+        uint32_t end = visibleEnd(len, plotRect);
+        uint32_t s0 = g_GraphStart;
+        for (int col = 1; s0 < end; col++) {
+            uint32_t s1 = g_GraphStart + (uint32_t)ceil(col / g_GraphPixelsPerPoint);
+            s1 = std::min(std::max(s1, s0 + 1), end);
+
+            int cMin, cMax;
+            int64_t cSum;
+            lod[graphNum].query(s0, s1, &cMin, &cMax, &cSum);
+
+            x = xCoordOf(s0, plotRect);
+            penPath.lineTo(x, yCoordOf(cMax, plotRect, gs_absVMax));
+            penPath.lineTo(x, yCoordOf(cMin, plotRect, gs_absVMax));
+            s0 = s1;
+        }
+        i = end;
         // catch stats
-        if (v < vMin) vMin = v;
-        if (v > vMax) vMax = v;
-        vMean += v;
+        lod[graphNum].query(g_GraphStart, end, &vMin, &vMax, &vMean);
     }
     g_GraphStop = i;
     vMean /= (g_GraphStop - g_GraphStart);
@@ -796,6 +972,7 @@ void Plot::plotGridLines(QPainter *painter, QRect r) {
 #define WIDTH_AXES 80
 
 void Plot::paintEvent(QPaintEvent *event) {
+    GraphLock lock;
     QPainter painter(this);
     QBrush brush(GREEN);
     QPen pen(GREEN);
@@ -821,7 +998,7 @@ void Plot::paintEvent(QPaintEvent *event) {
     painter.fillRect(plotRect, BLACK);
 
     //init graph variables
-    setMaxAndStart(g_GraphBuffer, g_GraphTraceLen, plotRect);
+    setMaxAndStart(g_GraphBuffer, g_GraphTraceLen, plotRect, 0);
 
     // center line
     int zeroHeight = plotRect.top() + (plotRect.bottom() - plotRect.top()) / 2;
@@ -838,9 +1015,10 @@ void Plot::paintEvent(QPaintEvent *event) {
         PlotDemod(g_DemodBuffer, g_DemodBufferLen, plotRect, infoRect, &painter, 2, g_DemodStartIdx);
     }
     if (gs_useOverlays) {
+        size_t overlayLen = std::min(s_Buff.size(), g_GraphTraceLen);
         //init graph variables
-        setMaxAndStart(s_Buff, g_GraphTraceLen, plotRect);
-        PlotGraph(s_Buff, g_GraphTraceLen, plotRect, infoRect, &painter, 1);
+        setMaxAndStart(s_Buff.data(), overlayLen, plotRect, 1);
+        PlotGraph(s_Buff.data(), overlayLen, plotRect, infoRect, &painter, 1);
     }
     // End graph drawing
 
@@ -1004,6 +1182,7 @@ void Plot::Trim(void) {
     for (uint32_t i = lref; i < rref; ++i)
         g_GraphBuffer[i - lref] = g_GraphBuffer[i];
     g_GraphTraceLen = rref - lref;
+    lod[0].invalidate(0, g_GraphTraceLen);
     g_GraphStart = 0;
 }
 
@@ -1068,6 +1247,7 @@ void Plot::mouseMoveEvent(QMouseEvent *event) {
 }
 
 void Plot::keyPressEvent(QKeyEvent *event) {
+    GraphLock lock;
     uint32_t offset; // Left/right movement offset (in sample size)
     const double zoom_offset = 1.148698354997035; // 2**(1/5)
     if (event->modifiers() & Qt::ShiftModifier) {
@@ -1102,6 +1282,8 @@ void Plot::keyPressEvent(QKeyEvent *event) {
                 x_start = CursorBPos;
                 x_stop = CursorAPos;
             }
+            if (x_stop - x_start > MAX_GRAPH_TRACE_LEN)
+                x_stop = x_start + MAX_GRAPH_TRACE_LEN;
             for (int i = x_start; i < x_stop; i++){
                 cut_buff[cut_buff_idx] = g_GraphBuffer[i];
                 cut_buff_idx++;
@@ -1109,14 +1291,15 @@ void Plot::keyPressEvent(QKeyEvent *event) {
             break;
         case Qt::Key_V:
             strtidx = 0;
-            for(uint32_t i = CursorBPos; i < CursorBPos + cut_buff_idx; i++){
+            for(uint32_t i = CursorBPos; i < CursorBPos + cut_buff_idx && i < g_GraphTraceLen; i++){
                 g_GraphBuffer[i] = cut_buff[strtidx];
                 strtidx++;
             }
-            RepaintGraphWindow();
+            lod[0].invalidate(CursorBPos, CursorBPos + cut_buff_idx);
             break;
         case Qt::Key_9:
             copy_n(orig_buff, MAX_GRAPH_TRACE_LEN, g_GraphBuffer);
+            lod[0].invalidate(0, MAX_GRAPH_TRACE_LEN);
             saved_demod = false;
             g_DemodBufferLen = 0;
             break;
@@ -1287,6 +1470,7 @@ void Plot::keyPressEvent(QKeyEvent *event) {
             for (int i = silence_start; i < silence_stop; i++){
                 g_GraphBuffer[i] = 0;
             }
+            lod[0].invalidate(silence_start, silence_stop);
             break;
         case Qt::Key_2:
             if (CursorAPos > CursorBPos){
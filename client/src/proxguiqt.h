@@ -21,6 +21,7 @@
 
 #include <stdint.h>
 #include <string.h>
+#include <vector>
 
 #include <QApplication>
 #include <QPushButton>
@@ -34,6 +35,37 @@
 
 class ProxWidget;
 
+/**
+ * @brief Level of detail pyramid over a sample buffer.
+ * Level 0 holds min/max/sum of every LOD_BLOCK samples, each next level
+ * combines two blocks of the one below. Any sample range is answered from
+ * O(log n) blocks, so a zoomed out plot costs one query per pixel column.
+ */
+#define LOD_BLOCK_SHIFT 4
+#define LOD_BLOCK       (1 << LOD_BLOCK_SHIFT)
+
+class GraphLod {
+  private:
+    struct Block {
+        int vmin;
+        int vmax;
+        int64_t sum;
+    };
+    std::vector<std::vector<Block>> levels;
+    const int *buffer;
+    size_t len;
+    uint32_t generation;
+    size_t dirtyStart;  // samples to rebuild on next sync, none if dirtyStart >= dirtyEnd
+    size_t dirtyEnd;
+    void rebuild(void);
+
+  public:
+    GraphLod() : buffer(NULL), len(0), generation(0), dirtyStart(0), dirtyEnd(0) {}
+    void invalidate(size_t start, size_t end);
+    void sync(const int *buf, size_t n, uint32_t gen);
+    void query(size_t start, size_t end, int *vmin, int *vmax, int64_t *sum) const;
+};
+
 /**
  * @brief The actual plot, black area were we paint the graph
  */
@@ -43,13 +75,15 @@ class Plot: public QWidget {
     double g_GraphPixelsPerPoint; // How many visual pixels are between each sample point (x axis)
     uint32_t CursorAPos;
     uint32_t CursorBPos;
+    GraphLod lod[2];    // graph and overlay
     void PlotGraph(int *buffer, size_t len, QRect plotRect, QRect annotationRect, QPainter *painter, int graphNum);
     void PlotDemod(uint8_t *buffer, size_t len, QRect plotRect, QRect annotationRect, QPainter *painter, int graphNum, uint32_t plotOffset);
     void plotGridLines(QPainter *painter, QRect r);
     int xCoordOf(int i, QRect r);
     int yCoordOf(int v, QRect r, int maxVal);
     int valueOf_yCoord(int y, QRect r, int maxVal);
-    void setMaxAndStart(int *buffer, size_t len, QRect plotRect);
+    uint32_t visibleEnd(size_t len, QRect r);
+    void setMaxAndStart(int *buffer, size_t len, QRect plotRect, int graphNum);
     QColor getColor(int graphNum);
 
   public:
@@ -55,6 +55,7 @@ uint32_t g_CursorCPos = 0, g_CursorDPos = 0, g_GraphStop = 0;
 uint32_t g_GraphStart = 0; // Starting point/offset for the left side of the graph
 double g_GraphPixelsPerPoint = 1.f; // How many visual pixels are between each sample point (x axis)
 static bool flushAfterWrite = false;
+static __thread bool printMuted = false;
 double g_GridOffset = 0;
 bool g_GridLocked = false;
 
@@ -189,6 +190,9 @@ static uint8_t PrintAndLogEx_spinidx = 0;
 
 void PrintAndLogEx(logLevel_t level, const char *fmt, ...) {
 
+    if (printMuted)
+        return;
+
     // skip debug messages if client debugging is turned off i.e. 'DATA SETDEBUG -0'
     if (g_debugMode == 0 && level == DEBUG)
         return;
@@ -419,6 +423,11 @@ bool GetFlushAfterWrite(void) {
     return flushAfterWrite;
 }
 
+// silence PrintAndLogEx for the calling thread only
+void SetPrintMuted(bool value) {
+    printMuted = value;
+}
+
 void memcpy_filter_rlmarkers(void *dest, const void *src, size_t n) {
     uint8_t *rdest = (uint8_t *)dest;
     uint8_t *rsrc = (uint8_t *)src;
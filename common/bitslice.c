@@ -0,0 +1,81 @@
+//-----------------------------------------------------------------------------
+// Copyright (C) Proxmark3 contributors. See AUTHORS.md for details.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// See LICENSE.txt for the text of the license.
+//-----------------------------------------------------------------------------
+// Runtime selection of the bitslice instruction set, see bitslice.h
+//-----------------------------------------------------------------------------
+#include "bitslice.h"
+
+#include <string.h>
+
+static const struct {
+    const char *name;
+    uint16_t lanes;
+} bs_archs[BS_ARCH_COUNT] = {
+    [BS_SCALAR] = { "scalar", 64 },
+    [BS_SSE2]   = { "sse2",   128 },
+    [BS_NEON]   = { "neon",   128 },
+    [BS_AVX2]   = { "avx2",   256 },
+    [BS_AVX512] = { "avx512", 512 },
+};
+
+const char *bitslice_arch_name(bs_arch_t arch) {
+    return (arch < BS_ARCH_COUNT) ? bs_archs[arch].name : "none";
+}
+
+uint16_t bitslice_arch_lanes(bs_arch_t arch) {
+    return (arch < BS_ARCH_COUNT) ? bs_archs[arch].lanes : 0;
+}
+
+bool bitslice_arch_supported(bs_arch_t arch) {
+    if (arch == BS_SCALAR) {
+        return true;
+    }
+#if defined(BITSLICE_X86)
+    __builtin_cpu_init();
+    if (arch == BS_SSE2) {
+        return __builtin_cpu_supports("sse2");
+    }
+    if (arch == BS_AVX2) {
+        return __builtin_cpu_supports("avx2");
+    }
+    if (arch == BS_AVX512) {
+        return __builtin_cpu_supports("avx512f");
+    }
+#elif defined(BITSLICE_NEON)
+    // part of every aarch64 CPU
+    if (arch == BS_NEON) {
+        return true;
+    }
+#endif
+    return false;
+}
+
+bs_arch_t bitslice_arch_best(void) {
+    for (int arch = BS_ARCH_COUNT - 1; arch > BS_SCALAR; arch--) {
+        if (bitslice_arch_supported(arch)) {
+            return arch;
+        }
+    }
+    return BS_SCALAR;
+}
+
+bs_arch_t bitslice_arch_from_name(const char *name) {
+    for (int arch = 0; arch < BS_ARCH_COUNT; arch++) {
+        if (strcmp(name, bs_archs[arch].name) == 0) {
+            return bitslice_arch_supported(arch) ? (bs_arch_t)arch : BS_ARCH_COUNT;
+        }
+    }
+    return BS_ARCH_COUNT;
+}
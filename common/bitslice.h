@@ -0,0 +1,77 @@
+//-----------------------------------------------------------------------------
+// Copyright (C) Proxmark3 contributors. See AUTHORS.md for details.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// See LICENSE.txt for the text of the license.
+//-----------------------------------------------------------------------------
+// Bitsliced kernels for every vector instruction set, picked at runtime.
+//
+// A kernel is written once as a template header against the vector types of
+// bitslice_vec.h, and bitslice_instances.h compiles it for every instruction
+// set the target can have:
+//
+//   #define BITSLICE_KERNEL "my_kernel_core.h"
+//   #include "bitslice_instances.h"
+//
+//   static const my_fn_t my_fns[BS_ARCH_COUNT] = { BITSLICE_TABLE(my_fn) };
+//   ...
+//   my_fns[bitslice_arch_best()](...);
+//
+// The instruction set of each instance is enabled with a function attribute,
+// so the build needs no -m flags and the binary still runs on older CPUs.
+//-----------------------------------------------------------------------------
+
+#ifndef BITSLICE_H__
+#define BITSLICE_H__
+
+#include <stdint.h>
+#include <stdbool.h>
+
+// widest vector of any instruction set
+#define BITSLICE_MAX_LANES  512
+
+// slowest first
+typedef enum {
+    BS_SCALAR = 0,  // 64 bit integers, always there
+    BS_SSE2,
+    BS_NEON,
+    BS_AVX2,
+    BS_AVX512,
+    BS_ARCH_COUNT
+} bs_arch_t;
+
+#if (defined(__x86_64__) || defined(__i386__)) && !defined(NOSIMD_BUILD)
+# define BITSLICE_X86
+# define BITSLICE_TABLE(fn) [BS_SCALAR] = fn##_scalar, [BS_SSE2] = fn##_sse2, [BS_AVX2] = fn##_avx2, [BS_AVX512] = fn##_avx512
+#elif defined(__aarch64__) && !defined(NOSIMD_BUILD)
+# define BITSLICE_NEON
+# define BITSLICE_TABLE(fn) [BS_SCALAR] = fn##_scalar, [BS_NEON] = fn##_neon
+#else
+# define BITSLICE_TABLE(fn) [BS_SCALAR] = fn##_scalar
+#endif
+
+// "scalar", "sse2", "neon", "avx2" or "avx512"
+const char *bitslice_arch_name(bs_arch_t arch);
+
+// lanes of one vector,  0 for BS_ARCH_COUNT
+uint16_t bitslice_arch_lanes(bs_arch_t arch);
+
+// compiled in and the CPU runs it
+bool bitslice_arch_supported(bs_arch_t arch);
+
+// widest supported instruction set
+bs_arch_t bitslice_arch_best(void);
+
+// supported instruction set by name,  BS_ARCH_COUNT if there is none
+bs_arch_t bitslice_arch_from_name(const char *name);
+
+#endif
@@ -0,0 +1,101 @@
+//-----------------------------------------------------------------------------
+// Copyright (C) Proxmark3 contributors. See AUTHORS.md for details.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// See LICENSE.txt for the text of the license.
+//-----------------------------------------------------------------------------
+// Compiles the kernel template BITSLICE_KERNEL once per instruction set of
+// bitslice.h. Each time the vector types of bitslice_vec.h are there, and
+//   BS_ARCH     bs_arch_t of the instance
+//   BS_BITS     lanes per vector
+//   BS_NAME     instruction set name
+//   BS_TARGET   function attribute enabling the instruction set, or nothing
+//   BS_FN(x)    x with the instruction set suffix appended
+// The kernel names everything it defines with BS_FN, see BITSLICE_TABLE.
+//-----------------------------------------------------------------------------
+
+#include "bitslice.h"
+
+#ifndef BITSLICE_KERNEL
+# error "define BITSLICE_KERNEL to the kernel template before including bitslice_instances.h"
+#endif
+
+#if defined(BITSLICE_X86)
+
+#define BS_ARCH     BS_AVX512
+#define BS_BITS     512
+#define BS_NAME     "avx512"
+#define BS_TARGET   __attribute__((target("avx512f")))
+#define BS_FN(x)    x##_avx512
+#include "bitslice_vec.h"
+#include BITSLICE_KERNEL
+#undef BS_ARCH
+#undef BS_BITS
+#undef BS_NAME
+#undef BS_TARGET
+#undef BS_FN
+
+#define BS_ARCH     BS_AVX2
+#define BS_BITS     256
+#define BS_NAME     "avx2"
+#define BS_TARGET   __attribute__((target("avx2")))
+#define BS_FN(x)    x##_avx2
+#include "bitslice_vec.h"
+#include BITSLICE_KERNEL
+#undef BS_ARCH
+#undef BS_BITS
+#undef BS_NAME
+#undef BS_TARGET
+#undef BS_FN
+
+#define BS_ARCH     BS_SSE2
+#define BS_BITS     128
+#define BS_NAME     "sse2"
+#define BS_TARGET   __attribute__((target("sse2")))
+#define BS_FN(x)    x##_sse2
+#include "bitslice_vec.h"
+#include BITSLICE_KERNEL
+#undef BS_ARCH
+#undef BS_BITS
+#undef BS_NAME
+#undef BS_TARGET
+#undef BS_FN
+
+#elif defined(BITSLICE_NEON)
+
+#define BS_ARCH     BS_NEON
+#define BS_BITS     128
+#define BS_NAME     "neon"
+#define BS_TARGET
+#define BS_FN(x)    x##_neon
+#include "bitslice_vec.h"
+#include BITSLICE_KERNEL
+#undef BS_ARCH
+#undef BS_BITS
+#undef BS_NAME
+#undef BS_TARGET
+#undef BS_FN
+
+#endif
+
+#define BS_ARCH     BS_SCALAR
+#define BS_BITS     64
+#define BS_NAME     "scalar"
+#define BS_TARGET
+#define BS_FN(x)    x##_scalar
+#include "bitslice_vec.h"
+#include BITSLICE_KERNEL
+#undef BS_ARCH
+#undef BS_BITS
+#undef BS_NAME
+#undef BS_TARGET
+#undef BS_FN
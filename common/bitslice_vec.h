@@ -0,0 +1,66 @@
+//-----------------------------------------------------------------------------
+// Copyright (C) Proxmark3 contributors. See AUTHORS.md for details.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// See LICENSE.txt for the text of the license.
+//-----------------------------------------------------------------------------
+// Vector types of one bitslice instance.
+//
+// Included by bitslice_instances.h once per instruction set, with BS_BITS,
+// BS_TARGET and BS_FN(x) defined, so no include guard.
+//
+// A bitslice holds one bit of BS_BITS lanes. Lane L is bit L % 64 of word
+// L / 64, unless a kernel documents its own order.
+//-----------------------------------------------------------------------------
+
+#undef BS_WORDS
+#undef bs_vec
+#undef bs_slice
+#undef bs_any
+#undef bs_fill
+#undef bs_lane
+
+#define BS_WORDS    (BS_BITS / 64)
+
+typedef uint64_t BS_FN(bs_vec_t) __attribute__((vector_size(BS_BITS / 8)));
+
+typedef union {
+    BS_FN(bs_vec_t) v;
+    uint64_t w[BS_WORDS];
+    uint8_t b[BS_BITS / 8];
+} BS_FN(bs_slice_t);
+
+#define bs_vec      BS_FN(bs_vec_t)
+#define bs_slice    BS_FN(bs_slice_t)
+#define bs_any      BS_FN(bs_any)
+#define bs_fill     BS_FN(bs_fill)
+#define bs_lane     BS_FN(bs_lane)
+
+// any lane set
+static inline BS_TARGET bool bs_any(bs_vec v) {
+    bs_slice s = { .v = v };
+    uint64_t acc = 0;
+    for (int i = 0; i < BS_WORDS; i++) {
+        acc |= s.w[i];
+    }
+    return acc != 0;
+}
+
+// all lanes 0 or all lanes 1
+static inline BS_TARGET bs_vec bs_fill(bool bit) {
+    const bs_vec zero = {0};
+    return (bit) ? ~zero : zero;
+}
+
+static inline BS_TARGET bool bs_lane(const bs_slice *s, uint32_t lane) {
+    return (s->w[lane >> 6] >> (lane & 0x3f)) & 1;
+}
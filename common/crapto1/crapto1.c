@@ -19,8 +19,13 @@
 #include "bucketsort.h"
 
 #include <stdlib.h>
+#include <string.h>
 #include "parity.h"
 
+#if !defined(__arm__) || defined(__linux__) || defined(_WIN32) || defined(__APPLE__)
+#include <pthread.h>
+#endif
+
 #if !defined LOWMEM && defined __GNUC__
 static uint8_t filterlut[1 << 20];
 static void __attribute__((constructor)) fill_lut(void) {
@@ -77,6 +82,27 @@ static inline void extend_table_simple(uint32_t *tbl, uint32_t **end, int bit) {
         }
     }
 }
+/** recover_extend
+ * extend both tables with the next (up to) 4 bits of keystream.
+ * returns false when one of the tables runs empty
+ */
+static inline bool recover_extend(uint32_t *o_head, uint32_t **o_tail, uint32_t *oks,
+                                  uint32_t *e_head, uint32_t **e_tail, uint32_t *eks, int *rem, uint32_t *in) {
+    for (uint32_t i = 0; i < 4 && (*rem)--; i++) {
+        *oks >>= 1;
+        *eks >>= 1;
+        *in >>= 2;
+        extend_table(o_head, o_tail, *oks & 1, LF_POLY_EVEN << 1 | 1, LF_POLY_ODD << 1, 0);
+        if (o_head > *o_tail)
+            return false;
+
+        extend_table(e_head, e_tail, *eks & 1, LF_POLY_ODD, LF_POLY_EVEN << 1 | 1, *in & 3);
+        if (e_head > *e_tail)
+            return false;
+    }
+    return true;
+}
+
 /** recover
  * recursively narrow down the search space, 4 bits of keystream at a time
  */
@@ -98,18 +124,8 @@ recover(uint32_t *o_head, uint32_t *o_tail, uint32_t oks,
         return sl;
     }
 
-    for (uint32_t i = 0; i < 4 && rem--; i++) {
-        oks >>= 1;
-        eks >>= 1;
-        in >>= 2;
-        extend_table(o_head, &o_tail, oks & 1, LF_POLY_EVEN << 1 | 1, LF_POLY_ODD << 1, 0);
-        if (o_head > o_tail)
-            return sl;
-
-        extend_table(e_head, &e_tail, eks & 1, LF_POLY_ODD, LF_POLY_EVEN << 1 | 1, in & 3);
-        if (e_head > e_tail)
-            return sl;
-    }
+    if (recover_extend(o_head, &o_tail, &oks, e_head, &e_tail, &eks, &rem, &in) == false)
+        return sl;
 
     bucket_sort_intersect(e_head, e_tail, o_head, o_tail, &bucket_info, bucket);
 
@@ -124,6 +140,293 @@ recover(uint32_t *o_head, uint32_t *o_tail, uint32_t oks,
 
 
 #if !defined(__arm__) || defined(__linux__) || defined(_WIN32) || defined(__APPLE__) // bare metal ARM Proxmark lacks malloc()/free()
+
+// lfsr_recovery32 hands the top level buckets to the workers, lfsr_recovery64 chunks of the 2^20 odd states.
+// every work unit writes its states to the worker's own list, the lists are then concatenated in unit order
+// so the result is the same as with a single thread.
+#define RECOVERY_MAX_UNITS     256
+#define RECOVERY_STATES        (1 << 18)
+#define RECOVERY64_CHUNK_SIZE  ((1 << 20) / RECOVERY_MAX_UNITS)
+
+struct Crypto1Recovery;
+
+typedef struct {
+    struct Crypto1Recovery *ctx;
+    struct Crypto1State *out;       // RECOVERY_STATES + 1 states
+    size_t used;
+    uint32_t *table;                // lfsr_recovery64 table
+    uint32_t *odd;                  // private copy of the lfsr_recovery32 top level bucket,
+    uint32_t *even;                 // recover() grows the lists in place
+    bool has_bucket;
+    bucket_array_t bucket;          // lfsr_recovery32 bucket sort below the top level
+} recovery_worker_t;
+
+typedef struct {
+    uint32_t worker;
+    size_t start;
+    size_t end;
+} recovery_unit_t;
+
+typedef void recovery_unit_fn_t(struct Crypto1Recovery *ctx, recovery_worker_t *w, uint32_t unit);
+
+struct Crypto1Recovery {
+    uint32_t num_threads;
+    recovery_worker_t *workers;
+
+    // current job
+    recovery_unit_fn_t *run_unit;
+    uint32_t num_units;
+    uint32_t next_unit;
+    recovery_unit_t units[RECOVERY_MAX_UNITS];
+
+    // lfsr_recovery32: top level tables and buckets, shared read only by the workers
+    uint32_t *odd;
+    uint32_t *even;
+    bool has_bucket;
+    bucket_array_t bucket;
+    bucket_info_t bucket_info;
+    uint32_t oks;
+    uint32_t eks;
+    uint32_t in;
+    int rem;
+
+    // lfsr_recovery64: keystream bits
+    uint8_t oks64[32];
+    uint8_t eks64[32];
+};
+
+static void free_bucket(bucket_array_t bucket) {
+    for (uint32_t i = 0; i < 2; i++) {
+        for (uint32_t j = 0; j <= 0xff; j++) {
+            free(bucket[i][j].head);
+            bucket[i][j].head = NULL;
+        }
+    }
+}
+
+// allocate memory for out of place bucket_sort
+static bool alloc_bucket(bucket_array_t bucket) {
+    for (uint32_t i = 0; i < 2; i++) {
+        for (uint32_t j = 0; j <= 0xff; j++) {
+            bucket[i][j].head = malloc(sizeof(uint32_t) << 14);
+            if (!bucket[i][j].head) {
+                free_bucket(bucket);
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+/** lfsr_recovery_create
+ * create a context for lfsr_recovery32_ex/lfsr_recovery64_ex using num_threads threads,
+ * at most LFSR_RECOVERY_MAX_THREADS.
+ * the tables are allocated on first use and kept until lfsr_recovery_destroy, every worker
+ * holds about 50 MB of them, so destroy the context once the command is done with it.
+ * the threads are started by each recovery and joined before it returns.
+ * a context must not be used by more than one recovery at a time
+ */
+struct Crypto1Recovery *lfsr_recovery_create(uint32_t num_threads) {
+    struct Crypto1Recovery *ctx = calloc(1, sizeof(*ctx));
+    if (!ctx)
+        return NULL;
+
+    ctx->num_threads = (num_threads) ? num_threads : 1;
+    if (ctx->num_threads > LFSR_RECOVERY_MAX_THREADS)
+        ctx->num_threads = LFSR_RECOVERY_MAX_THREADS;
+    ctx->workers = calloc(ctx->num_threads, sizeof(recovery_worker_t));
+    if (!ctx->workers) {
+        free(ctx);
+        return NULL;
+    }
+
+    for (uint32_t i = 0; i < ctx->num_threads; i++) {
+        recovery_worker_t *w = &ctx->workers[i];
+        w->ctx = ctx;
+        w->out = malloc(sizeof(struct Crypto1State) * (RECOVERY_STATES + 1));
+        if (!w->out) {
+            lfsr_recovery_destroy(ctx);
+            return NULL;
+        }
+    }
+    return ctx;
+}
+
+void lfsr_recovery_destroy(struct Crypto1Recovery *ctx) {
+    if (!ctx)
+        return;
+
+    for (uint32_t i = 0; i < ctx->num_threads; i++) {
+        recovery_worker_t *w = &ctx->workers[i];
+        free(w->out);
+        free(w->table);
+        free(w->odd);
+        free(w->even);
+        if (w->has_bucket)
+            free_bucket(w->bucket);
+    }
+    if (ctx->has_bucket)
+        free_bucket(ctx->bucket);
+    free(ctx->odd);
+    free(ctx->even);
+    free(ctx->workers);
+    free(ctx);
+}
+
+static void *
+#ifdef __has_attribute
+#if __has_attribute(force_align_arg_pointer)
+__attribute__((force_align_arg_pointer))
+#endif
+#endif
+recovery_thread(void *arg) {
+    recovery_worker_t *w = arg;
+    struct Crypto1Recovery *ctx = w->ctx;
+    uint32_t unit;
+
+    while ((unit = __atomic_fetch_add(&ctx->next_unit, 1, __ATOMIC_RELAXED)) < ctx->num_units) {
+        ctx->units[unit].worker = w - ctx->workers;
+        ctx->units[unit].start = w->used;
+        ctx->run_unit(ctx, w, unit);
+        ctx->units[unit].end = w->used;
+    }
+    return NULL;
+}
+
+// run num_units work units on the worker threads and collect their states into one new list
+static struct Crypto1State *recovery_run(struct Crypto1Recovery *ctx, uint32_t num_units, recovery_unit_fn_t *run_unit) {
+    ctx->run_unit = run_unit;
+    ctx->num_units = num_units;
+    ctx->next_unit = 0;
+
+    uint32_t num_threads = (ctx->num_threads < num_units) ? ctx->num_threads : num_units;
+    pthread_t thread_id[num_threads ? num_threads : 1];
+    bool started[num_threads ? num_threads : 1];
+
+    for (uint32_t i = 0; i < ctx->num_threads; i++)
+        ctx->workers[i].used = 0;
+
+    // a thread that fails to start just leaves its share to the others
+    for (uint32_t i = 1; i < num_threads; i++)
+        started[i] = (pthread_create(&thread_id[i], NULL, recovery_thread, &ctx->workers[i]) == 0);
+
+    if (num_threads)
+        recovery_thread(&ctx->workers[0]);
+
+    for (uint32_t i = 1; i < num_threads; i++)
+        if (started[i])
+            pthread_join(thread_id[i], NULL);
+
+    size_t total = 0;
+    for (uint32_t i = 0; i < num_units; i++)
+        total += ctx->units[i].end - ctx->units[i].start;
+
+    struct Crypto1State *statelist = malloc(sizeof(struct Crypto1State) * (total + 1));
+    if (!statelist)
+        return NULL;
+
+    struct Crypto1State *sl = statelist;
+    for (uint32_t i = 0; i < num_units; i++) {
+        recovery_unit_t *u = &ctx->units[i];
+        memcpy(sl, ctx->workers[u->worker].out + u->start, sizeof(struct Crypto1State) * (u->end - u->start));
+        sl += u->end - u->start;
+    }
+    sl->odd = sl->even = 0;
+    return statelist;
+}
+
+static void recovery32_unit(struct Crypto1Recovery *ctx, recovery_worker_t *w, uint32_t unit) {
+    // same order as recover(): last bucket first
+    uint32_t i = ctx->bucket_info.numbuckets - 1 - unit;
+
+    // the lists of the top level buckets are adjacent and recover() extends them in place,
+    // so work on a copy that has room to grow
+    size_t o_len = ctx->bucket_info.bucket_info[1][i].tail + 1 - ctx->bucket_info.bucket_info[1][i].head;
+    size_t e_len = ctx->bucket_info.bucket_info[0][i].tail + 1 - ctx->bucket_info.bucket_info[0][i].head;
+    memcpy(w->odd, ctx->bucket_info.bucket_info[1][i].head, o_len * sizeof(uint32_t));
+    memcpy(w->even, ctx->bucket_info.bucket_info[0][i].head, e_len * sizeof(uint32_t));
+
+    struct Crypto1State *sl = recover(w->odd, w->odd + o_len - 1, ctx->oks,
+                                      w->even, w->even + e_len - 1, ctx->eks,
+                                      ctx->rem, w->out + w->used, ctx->in, w->bucket);
+    w->used = sl - w->out;
+}
+
+/** lfsr_recovery32_ex
+ * same as lfsr_recovery32, spread over the threads of a recovery context
+ */
+struct Crypto1State *lfsr_recovery32_ex(struct Crypto1Recovery *ctx, uint32_t ks2, uint32_t in) {
+    uint32_t *odd_head, *odd_tail, oks = 0;
+    uint32_t *even_head, *even_tail, eks = 0;
+    int i;
+
+    if (!ctx->odd)
+        ctx->odd = malloc(sizeof(uint32_t) << 21);
+    if (!ctx->even)
+        ctx->even = malloc(sizeof(uint32_t) << 21);
+    if (!ctx->odd || !ctx->even)
+        return NULL;
+
+    if (!ctx->has_bucket && !(ctx->has_bucket = alloc_bucket(ctx->bucket)))
+        return NULL;
+
+    for (uint32_t t = 0; t < ctx->num_threads; t++) {
+        recovery_worker_t *w = &ctx->workers[t];
+        if (!w->odd)
+            w->odd = malloc(sizeof(uint32_t) << 21);
+        if (!w->even)
+            w->even = malloc(sizeof(uint32_t) << 21);
+        if (!w->odd || !w->even)
+            return NULL;
+        if (!w->has_bucket && !(w->has_bucket = alloc_bucket(w->bucket)))
+            return NULL;
+    }
+
+    // split the keystream into an odd and even part
+    for (i = 31; i >= 0; i -= 2)
+        oks = oks << 1 | BEBIT(ks2, i);
+    for (i = 30; i >= 0; i -= 2)
+        eks = eks << 1 | BEBIT(ks2, i);
+
+    odd_head = odd_tail = ctx->odd;
+    even_head = even_tail = ctx->even;
+    odd_tail--;
+    even_tail--;
+
+    // initialize statelists: add all possible states which would result into the rightmost 2 bits of the keystream
+    for (i = 1 << 20; i >= 0; --i) {
+        if (filter(i) == (oks & 1))
+            *++odd_tail = i;
+        if (filter(i) == (eks & 1))
+            *++even_tail = i;
+    }
+
+    // extend the statelists. Look at the next 8 Bits of the keystream (4 Bit each odd and even):
+    for (i = 0; i < 4; i++) {
+        extend_table_simple(odd_head,  &odd_tail, (oks >>= 1) & 1);
+        extend_table_simple(even_head, &even_tail, (eks >>= 1) & 1);
+    }
+
+    // the statelists now contain all states which could have generated the last 10 Bits of the keystream.
+    // 22 bits to go to recover 32 bits in total. From now on, we need to take the "in"
+    // parameter into account.
+    in = (in >> 16 & 0xff) | (in << 16) | (in & 0xff00); // Byte swapping
+    in <<= 1;
+
+    // first level of recover() here, the buckets it produces are recovered in parallel
+    int rem = 11;
+    if (recover_extend(odd_head, &odd_tail, &oks, even_head, &even_tail, &eks, &rem, &in) == false)
+        return recovery_run(ctx, 0, recovery32_unit);
+
+    bucket_sort_intersect(even_head, even_tail, odd_head, odd_tail, &ctx->bucket_info, ctx->bucket);
+
+    ctx->oks = oks;
+    ctx->eks = eks;
+    ctx->in = in;
+    ctx->rem = rem;
+    return recovery_run(ctx, ctx->bucket_info.numbuckets, recovery32_unit);
+}
+
 /** lfsr_recovery
  * recover the state of the lfsr given 32 bits of the keystream
  * additionally you can use the in parameter to specify the value
@@ -217,31 +520,16 @@ static const uint32_t T2[] = {  0x3C88B810, 0x5E445C08, 0x2982A580, 0x14C152C0,
                              };
 static const uint32_t C1[] = { 0x846B5, 0x4235A, 0x211AD};
 static const uint32_t C2[] = { 0x1A822E0, 0x21A822E0, 0x21A822E0};
-/** Reverse 64 bits of keystream into possible cipher states
- * Variation mentioned in the paper. Somewhat optimized version
- */
-struct Crypto1State *lfsr_recovery64(uint32_t ks2, uint32_t ks3) {
-    struct Crypto1State *statelist, *sl;
-    uint8_t oks[32], eks[32], hi[32];
-    uint32_t low = 0,  win = 0;
-    uint32_t *tail, table[1 << 16];
-    int i, j;
+// odd states from..to (downwards) of lfsr_recovery64
+static struct Crypto1State *recovery64_range(uint32_t from, uint32_t to, const uint8_t *oks, const uint8_t *eks,
+                                             uint32_t *table, struct Crypto1State *sl) {
+    uint8_t hi[32];
+    uint32_t *tail;
+    int j;
 
-    sl = statelist = calloc(1, sizeof(struct Crypto1State) << 4);
-    if (!sl)
-        return 0;
-    sl->odd = sl->even = 0;
-
-    for (i = 30; i >= 0; i -= 2) {
-        oks[i >> 1] = BEBIT(ks2, i);
-        oks[16 + (i >> 1)] = BEBIT(ks3, i);
-    }
-    for (i = 31; i >= 0; i -= 2) {
-        eks[i >> 1] = BEBIT(ks2, i);
-        eks[16 + (i >> 1)] = BEBIT(ks3, i);
-    }
+    for (int i = from; i >= (int)to; --i) {
+        uint32_t low = 0, win = 0;
 
-    for (i = 0xfffff; i >= 0; --i) {
         if (filter(i) != oks[0])
             continue;
 
@@ -284,6 +572,66 @@ continue2:
             ;
         }
     }
+    return sl;
+}
+
+static void recovery64_unit(struct Crypto1Recovery *ctx, recovery_worker_t *w, uint32_t unit) {
+    uint32_t from = 0xfffff - unit * RECOVERY64_CHUNK_SIZE;
+    struct Crypto1State *sl = recovery64_range(from, from - (RECOVERY64_CHUNK_SIZE - 1), ctx->oks64, ctx->eks64,
+                                               w->table, w->out + w->used);
+    w->used = sl - w->out;
+}
+
+/** lfsr_recovery64_ex
+ * same as lfsr_recovery64, spread over the threads of a recovery context
+ */
+struct Crypto1State *lfsr_recovery64_ex(struct Crypto1Recovery *ctx, uint32_t ks2, uint32_t ks3) {
+    int i;
+
+    for (uint32_t t = 0; t < ctx->num_threads; t++) {
+        recovery_worker_t *w = &ctx->workers[t];
+        if (!w->table)
+            w->table = malloc(sizeof(uint32_t) << 16);
+        if (!w->table)
+            return NULL;
+    }
+
+    for (i = 30; i >= 0; i -= 2) {
+        ctx->oks64[i >> 1] = BEBIT(ks2, i);
+        ctx->oks64[16 + (i >> 1)] = BEBIT(ks3, i);
+    }
+    for (i = 31; i >= 0; i -= 2) {
+        ctx->eks64[i >> 1] = BEBIT(ks2, i);
+        ctx->eks64[16 + (i >> 1)] = BEBIT(ks3, i);
+    }
+
+    return recovery_run(ctx, RECOVERY_MAX_UNITS, recovery64_unit);
+}
+
+/** Reverse 64 bits of keystream into possible cipher states
+ * Variation mentioned in the paper. Somewhat optimized version
+ */
+struct Crypto1State *lfsr_recovery64(uint32_t ks2, uint32_t ks3) {
+    struct Crypto1State *statelist, *sl;
+    uint8_t oks[32], eks[32];
+    uint32_t table[1 << 16];
+    int i;
+
+    sl = statelist = calloc(1, sizeof(struct Crypto1State) << 4);
+    if (!sl)
+        return 0;
+    sl->odd = sl->even = 0;
+
+    for (i = 30; i >= 0; i -= 2) {
+        oks[i >> 1] = BEBIT(ks2, i);
+        oks[16 + (i >> 1)] = BEBIT(ks3, i);
+    }
+    for (i = 31; i >= 0; i -= 2) {
+        eks[i >> 1] = BEBIT(ks2, i);
+        eks[16 + (i >> 1)] = BEBIT(ks3, i);
+    }
+
+    recovery64_range(0xfffff, 0, oks, eks, table, sl);
     return statelist;
 }
 #endif
@@ -37,6 +37,14 @@ uint32_t prng_successor(uint32_t x, uint32_t n);
 #if !defined(__arm__) || defined(__linux__) || defined(_WIN32) || defined(__APPLE__) // bare metal ARM Proxmark lacks malloc()/free()
 struct Crypto1State *lfsr_recovery32(uint32_t ks2, uint32_t in);
 struct Crypto1State *lfsr_recovery64(uint32_t ks2, uint32_t ks3);
+// multi-threaded versions of the above with the same results. The context keeps its tables
+// (about 50 MB per thread) between recoveries until it is destroyed
+#define LFSR_RECOVERY_MAX_THREADS 8
+struct Crypto1Recovery;
+struct Crypto1Recovery *lfsr_recovery_create(uint32_t num_threads);
+void lfsr_recovery_destroy(struct Crypto1Recovery *ctx);
+struct Crypto1State *lfsr_recovery32_ex(struct Crypto1Recovery *ctx, uint32_t ks2, uint32_t in);
+struct Crypto1State *lfsr_recovery64_ex(struct Crypto1Recovery *ctx, uint32_t ks2, uint32_t ks3);
 struct Crypto1State *
 lfsr_common_prefix(uint32_t pfx, uint32_t rr, uint8_t ks[8], uint8_t par[8][8], uint32_t no_par);
 #endif
@@ -0,0 +1,124 @@
+//-----------------------------------------------------------------------------
+// Copyright (C) Proxmark3 contributors. See AUTHORS.md for details.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// See LICENSE.txt for the text of the license.
+//-----------------------------------------------------------------------------
+// Bitsliced Crypto1, see crypto1_bs.h
+//-----------------------------------------------------------------------------
+#include "crypto1_bs.h"
+
+#include <string.h>
+#include "crapto1.h"
+
+// filter function (f20), same as in hardnested_bf_core.c
+// sourced from ``Wirelessly Pickpocketing a Mifare Classic Card'' by Flavio Garcia, Peter van Rossum, Roel Verdult and Ronny Wichers Schreur
+#define f20a(a,b,c,d) (((a|b)^(a&d))^(c&((a^b)|d)))
+#define f20b(a,b,c,d) (((a&b)|c)^((a^b)&(c|d)))
+#define f20c(a,b,c,d,e) ((a|((b|e)&(d^e)))^((a^(b&d))&((c^d)|(b&e))))
+
+static const crypto1_bs_t bs_zeroes = { .bytes64 = { 0 } };
+
+static inline crypto1_bs_value_t bs_broadcast(uint8_t bit) {
+    return bit ? ~bs_zeroes.value : bs_zeroes.value;
+}
+
+// clock all lanes once, returns the keystream bit of every lane
+static inline crypto1_bs_value_t crypto1_bs_bit(struct Crypto1BsState *s, crypto1_bs_value_t in, int is_encrypted) {
+    crypto1_bs_t *x = s->lfsr + s->pos;
+
+    crypto1_bs_value_t ks = f20c(f20a(x[9].value, x[11].value, x[13].value, x[15].value),
+                                 f20b(x[17].value, x[19].value, x[21].value, x[23].value),
+                                 f20b(x[25].value, x[27].value, x[29].value, x[31].value),
+                                 f20a(x[33].value, x[35].value, x[37].value, x[39].value),
+                                 f20b(x[41].value, x[43].value, x[45].value, x[47].value));
+
+    crypto1_bs_value_t fb = x[0].value ^ x[5].value ^ x[9].value ^ x[10].value ^ x[12].value ^ x[14].value ^
+                            x[15].value ^ x[17].value ^ x[19].value ^ x[24].value ^ x[25].value ^ x[27].value ^
+                            x[29].value ^ x[35].value ^ x[39].value ^ x[41].value ^ x[42].value ^ x[43].value;
+    fb ^= in;
+    if (is_encrypted)
+        fb ^= ks;
+    x[48].value = fb;
+
+    // window exhausted, move the live 48 bits back to the start
+    if (++s->pos == CRYPTO1_BS_HISTORY) {
+        memmove(s->lfsr, s->lfsr + CRYPTO1_BS_HISTORY, 48 * sizeof(crypto1_bs_t));
+        s->pos = 0;
+    }
+    return ks;
+}
+
+void crypto1_bs_init(struct Crypto1BsState *s, const uint64_t *keys, size_t n) {
+    if (n > CRYPTO1_BS_WIDTH)
+        n = CRYPTO1_BS_WIDTH;
+
+    memset(s->lfsr, 0, 48 * sizeof(crypto1_bs_t));
+    s->pos = 0;
+    s->lanes = n;
+
+    // lfsr bit 47 - i is key bit i ^ 7, see crypto1_init()
+    for (size_t lane = 0; lane < n; lane++) {
+        uint64_t key = keys[lane];
+        uint64_t mask = 1ULL << (lane & 0x3f);
+        for (int i = 0; i < 48; i++) {
+            if (BIT(key, i ^ 7))
+                s->lfsr[47 - i].bytes64[lane >> 6] |= mask;
+        }
+    }
+}
+
+void crypto1_bs_word(struct Crypto1BsState *s, uint32_t in, int is_encrypted, uint32_t *ks) {
+    if (ks)
+        memset(ks, 0, s->lanes * sizeof(uint32_t));
+
+    for (int i = 0; i < 32; i++) {
+        crypto1_bs_t out;
+        out.value = crypto1_bs_bit(s, bs_broadcast(BEBIT(in, i)), is_encrypted);
+        if (ks == NULL)
+            continue;
+
+        for (uint32_t lane = 0; lane < s->lanes; lane++)
+            ks[lane] |= (uint32_t)BIT(out.bytes64[lane >> 6], lane & 0x3f) << (24 ^ i);
+    }
+}
+
+void crypto1_bs_byte(struct Crypto1BsState *s, uint8_t in, int is_encrypted, uint8_t *ks) {
+    if (ks)
+        memset(ks, 0, s->lanes);
+
+    for (int i = 0; i < 8; i++) {
+        crypto1_bs_t out;
+        out.value = crypto1_bs_bit(s, bs_broadcast(BIT(in, i)), is_encrypted);
+        if (ks == NULL)
+            continue;
+
+        for (uint32_t lane = 0; lane < s->lanes; lane++)
+            ks[lane] |= BIT(out.bytes64[lane >> 6], lane & 0x3f) << i;
+    }
+}
+
+size_t crypto1_bs_word_match(struct Crypto1BsState *s, uint32_t in, int is_encrypted, uint32_t ks, uint64_t *match) {
+    crypto1_bs_t diff = bs_zeroes;
+    for (int i = 0; i < 32; i++) {
+        diff.value |= crypto1_bs_bit(s, bs_broadcast(BEBIT(in, i)), is_encrypted) ^ bs_broadcast(BIT(ks, 24 ^ i));
+    }
+
+    size_t found = 0;
+    for (uint32_t w = 0; w < CRYPTO1_BS_WORDS; w++) {
+        uint32_t used = (s->lanes > w * 64) ? s->lanes - w * 64 : 0;
+        uint64_t lanes_mask = (used >= 64) ? UINT64_MAX : ((1ULL << used) - 1);
+        match[w] = ~diff.bytes64[w] & lanes_mask;
+        found += __builtin_popcountll(match[w]);
+    }
+    return found;
+}
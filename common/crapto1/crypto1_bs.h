@@ -0,0 +1,68 @@
+//-----------------------------------------------------------------------------
+// Copyright (C) Proxmark3 contributors. See AUTHORS.md for details.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// See LICENSE.txt for the text of the license.
+//-----------------------------------------------------------------------------
+// Bitsliced Crypto1: runs CRYPTO1_BS_WIDTH independent cipher states at once,
+// one state per bit lane, for verifying batches of candidate keys on the host.
+// The lane count follows the SIMD level the including code is compiled for,
+// like the bitsliced brute forcer in client/deps/hardnested.
+//-----------------------------------------------------------------------------
+#ifndef CRYPTO1_BS_INCLUDED
+#define CRYPTO1_BS_INCLUDED
+
+#include <stdint.h>
+#include <stddef.h>
+
+#if defined(__AVX512F__)
+#define CRYPTO1_BS_WIDTH 512
+#elif defined(__AVX2__)
+#define CRYPTO1_BS_WIDTH 256
+#elif defined(__SSE2__)
+#define CRYPTO1_BS_WIDTH 128
+#elif defined(__ARM_NEON) && !defined(NOSIMD_BUILD)
+#define CRYPTO1_BS_WIDTH 128
+#else
+#define CRYPTO1_BS_WIDTH 64
+#endif
+
+// number of uint64_t words needed for a per lane bitmap
+#define CRYPTO1_BS_WORDS (CRYPTO1_BS_WIDTH / 64)
+
+// clocked bits kept before the lfsr window is moved back to the start
+#define CRYPTO1_BS_HISTORY 256
+
+typedef uint64_t __attribute__((aligned(CRYPTO1_BS_WIDTH / 8))) __attribute__((vector_size(CRYPTO1_BS_WIDTH / 8))) crypto1_bs_value_t;
+typedef union {
+    crypto1_bs_value_t value;
+    uint64_t bytes64[CRYPTO1_BS_WORDS];
+} crypto1_bs_t;
+
+// lfsr[pos + n] holds lfsr bit n (0 = oldest, 47 = newest) of every lane
+struct Crypto1BsState {
+    crypto1_bs_t lfsr[48 + CRYPTO1_BS_HISTORY];
+    uint32_t pos;
+    uint32_t lanes;
+};
+
+// load up to CRYPTO1_BS_WIDTH keys, unused lanes are loaded with key 0 and never match
+void crypto1_bs_init(struct Crypto1BsState *s, const uint64_t *keys, size_t n);
+// same as crypto1_word() / crypto1_byte() on every lane. Input is shared by all lanes.
+// keystream of lane i is stored at ks[i] when ks is not NULL
+void crypto1_bs_word(struct Crypto1BsState *s, uint32_t in, int is_encrypted, uint32_t *ks);
+void crypto1_bs_byte(struct Crypto1BsState *s, uint8_t in, int is_encrypted, uint8_t *ks);
+// clock one word and set bit i of match[] for every lane i whose keystream equals ks.
+// returns the number of matching lanes
+size_t crypto1_bs_word_match(struct Crypto1BsState *s, uint32_t in, int is_encrypted, uint32_t ks, uint64_t *match);
+
+#endif
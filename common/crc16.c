@@ -20,9 +20,16 @@
 #include <string.h>
 #include "commonutil.h"
 
+#ifndef ON_DEVICE
+// per thread, lf search runs demodulators using different crc's in parallel
+static __thread uint16_t crc_table[256];
+static __thread bool crc_table_init = false;
+static __thread CrcType_t current_crc_type = CRC_NONE;
+#else
 static uint16_t crc_table[256];
 static bool crc_table_init = false;
 static CrcType_t current_crc_type = CRC_NONE;
+#endif
 
 void init_table(CrcType_t crctype) {
 
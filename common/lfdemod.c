@@ -45,8 +45,9 @@
 
 #include "lfdemod.h"
 #include <string.h>  // for memset, memcmp and size_t
-#include <stdlib.h>  // qsort
+#include <stdlib.h>  // calloc
 #include "parity.h"  // for parity test
+#include "lfdemod_simd.h"
 #include "pm3_cmd.h" // error codes
 #include "commonutil.h"  // Arraylen
 
@@ -69,7 +70,12 @@ uint8_t g_debugMode = 0;
 # define prnt Dbprintf
 #endif
 
+#ifndef ON_DEVICE
+// per thread, lf search runs demodulators in parallel
+static __thread signal_t signalprop = { 255, -255, 0, 0, true };
+#else
 static signal_t signalprop = { 255, -255, 0, 0, true };
+#endif
 signal_t *getSignalProperties(void) {
     return &signalprop;
 }
@@ -93,11 +99,22 @@ static void printSignal(void) {
 }
 
 #ifndef ON_DEVICE
-static int cmp_uint8(const void *a, const void *b) {
-    if (*(const uint8_t *)a < * (const uint8_t *)b)
-        return -1;
-    else
-        return *(const uint8_t *)a > *(const uint8_t *)b;
+// value at index nth of the sorted samples,  read from their histogram
+static uint8_t hist_nth(const uint32_t *hist, uint32_t nth) {
+    uint32_t seen = 0;
+    for (int v = 0; v < 256; v++) {
+        seen += hist[v];
+        if (seen > nth)
+            return v;
+    }
+    return 255;
+}
+
+static void hist_samples(const uint8_t *samples, uint32_t size, uint32_t *hist) {
+    memset(hist, 0, 256 * sizeof(uint32_t));
+    for (uint32_t i = 0; i < size; i++) {
+        hist[samples[i]]++;
+    }
 }
 #endif
 
@@ -106,38 +123,29 @@ void computeSignalProperties(const uint8_t *samples, uint32_t size) {
 
     if (samples == NULL || size < SIGNAL_MIN_SAMPLES) return;
 
-    uint32_t sum = 0;
+    uint32_t sum, cnt;
     uint32_t offset_size = size - SIGNAL_IGNORE_FIRST_SAMPLES;
+    const uint8_t *s = samples + SIGNAL_IGNORE_FIRST_SAMPLES;
 
-#ifndef ON_DEVICE
-    uint8_t tmp[offset_size];
-    memcpy(tmp, samples + SIGNAL_IGNORE_FIRST_SAMPLES, sizeof(tmp));
-    qsort(tmp, sizeof(tmp), sizeof(uint8_t), cmp_uint8);
-
-    uint8_t low10 = 0.5 * (tmp[(int)(offset_size * 0.1)] + tmp[(int)((offset_size - 1) * 0.1)]);
-    uint8_t hi90 =  0.5 * (tmp[(int)(offset_size * 0.9)] + tmp[(int)((offset_size - 1) * 0.9)]);
-    uint32_t cnt = 0;
-    for (uint32_t i = SIGNAL_IGNORE_FIRST_SAMPLES; i < size; i++) {
+    uint8_t lo, hi;
+    lf_minmax(s, offset_size, &lo, &hi);
+    signalprop.low = lo;
+    signalprop.high = hi;
 
-        if (samples[i] < signalprop.low) signalprop.low = samples[i];
-        if (samples[i] > signalprop.high) signalprop.high = samples[i];
+#ifndef ON_DEVICE
+    uint32_t hist[256];
+    hist_samples(s, offset_size, hist);
 
-        if (samples[i] < low10 || samples[i] > hi90)
-            continue;
+    uint8_t low10 = 0.5 * (hist_nth(hist, offset_size * 0.1) + hist_nth(hist, (offset_size - 1) * 0.1));
+    uint8_t hi90 =  0.5 * (hist_nth(hist, offset_size * 0.9) + hist_nth(hist, (offset_size - 1) * 0.9));
 
-        sum += samples[i];
-        cnt++;
-    }
+    sum = lf_sum_range(s, offset_size, low10, hi90, &cnt);
     if (cnt > 0)
         signalprop.mean = sum / cnt;
     else
         signalprop.mean = 0;
 #else
-    for (uint32_t i =  SIGNAL_IGNORE_FIRST_SAMPLES; i < size; i++) {
-        if (samples[i] < signalprop.low) signalprop.low = samples[i];
-        if (samples[i] > signalprop.high) signalprop.high = samples[i];
-        sum += samples[i];
-    }
+    sum = lf_sum_range(s, offset_size, 0, 255, &cnt);
     signalprop.mean = sum / offset_size;
 #endif
 
@@ -155,45 +163,29 @@ void removeSignalOffset(uint8_t *samples, uint32_t size) {
     if (samples == NULL || size < SIGNAL_MIN_SAMPLES) return;
 
     int acc_off = 0;
+    uint32_t cnt;
     uint32_t offset_size = size - SIGNAL_IGNORE_FIRST_SAMPLES;
+    const uint8_t *s = samples + SIGNAL_IGNORE_FIRST_SAMPLES;
 
 #ifndef ON_DEVICE
+    uint32_t hist[256];
+    hist_samples(s, offset_size, hist);
 
-    uint8_t tmp[offset_size];
-    memcpy(tmp, samples + SIGNAL_IGNORE_FIRST_SAMPLES, sizeof(tmp));
-    qsort(tmp, sizeof(tmp), sizeof(uint8_t), cmp_uint8);
-
-    uint8_t low10 = 0.5 * (tmp[(int)(offset_size * 0.05)] + tmp[(int)((offset_size - 1) * 0.05)]);
-    uint8_t hi90 =  0.5 * (tmp[(int)(offset_size * 0.95)] + tmp[(int)((offset_size - 1) * 0.95)]);
-    int32_t cnt = 0;
-    for (uint32_t i = SIGNAL_IGNORE_FIRST_SAMPLES; i < size; i++) {
-
-        if (samples[i] < low10 || samples[i] > hi90)
-            continue;
+    uint8_t low10 = 0.5 * (hist_nth(hist, offset_size * 0.05) + hist_nth(hist, (offset_size - 1) * 0.05));
+    uint8_t hi90 =  0.5 * (hist_nth(hist, offset_size * 0.95) + hist_nth(hist, (offset_size - 1) * 0.95));
 
-        acc_off += samples[i] - 128;
-        cnt++;
-    }
+    acc_off = (int)lf_sum_range(s, offset_size, low10, hi90, &cnt) - 128 * (int)cnt;
     if (cnt > 0)
-        acc_off /= cnt;
+        acc_off /= (int)cnt;
     else
         acc_off = 0;
 #else
-    for (uint32_t i = SIGNAL_IGNORE_FIRST_SAMPLES; i < size; i++)
-        acc_off += samples[i] - 128;
-
+    acc_off = (int)lf_sum_range(s, offset_size, 0, 255, &cnt) - 128 * (int)offset_size;
     acc_off /= (int)offset_size;
 #endif
 
     // shift and saturate samples to center the mean
-    for (uint32_t i = 0; i < size; i++) {
-        if (acc_off > 0) {
-            samples[i] = (samples[i] >= acc_off) ? samples[i] - acc_off : 0;
-        }
-        if (acc_off < 0) {
-            samples[i] = (255 - samples[i] >=  -acc_off) ? samples[i] - acc_off : 255;
-        }
-    }
+    lf_shift(samples, size, -acc_off);
 }
 
 // get high and low values of a wave with passed in fuzz factor. also return noise test = 1 for passed or 0 for only noise
@@ -436,13 +428,11 @@ static int getClosestClock(int testclk) {
 }
 
 void getNextLow(const uint8_t *samples, size_t size, int low, size_t *i) {
-    while ((samples[*i] > low) && (*i < size))
-        *i += 1;
+    *i = lf_find_le(samples, *i, size, low);
 }
 
 void getNextHigh(const uint8_t *samples, size_t size, int high, size_t *i) {
-    while ((samples[*i] < high) && (*i < size))
-        *i += 1;
+    *i = lf_find_ge(samples, *i, size, high);
 }
 
 // load wave counters
@@ -680,6 +670,32 @@ int DetectStrongAskClock(uint8_t *dest, size_t size, int high, int low, int *clo
     return shortestWaveIdx;
 }
 
+// count the clock positions start + x * clk (x < count) without a peak within +- tol samples
+// peaks[] is optional, a precomputed lf_peak_mask() of dest
+static size_t countAskClockErrors(const uint8_t *dest, const uint8_t *peaks, size_t start, size_t count, uint16_t clk, uint8_t tol, int high, int low) {
+    size_t errCnt = 0;
+
+    if (peaks) {
+        for (size_t i = 0; i < count; ++i) {
+            size_t arrLoc = start + (i * clk);
+            if ((peaks[arrLoc] | peaks[arrLoc - tol] | peaks[arrLoc + tol]) == 0)
+                errCnt++;
+        }
+        return errCnt;
+    }
+
+    for (size_t i = 0; i < count; ++i) {
+        size_t arrLoc = start + (i * clk);
+        if (dest[arrLoc] >= high || dest[arrLoc] <= low) {
+        } else if (dest[arrLoc - tol] >= high || dest[arrLoc - tol] <= low) {
+        } else if (dest[arrLoc + tol] >= high || dest[arrLoc + tol] <= low) {
+        } else {  //error no peak detected
+            errCnt++;
+        }
+    }
+    return errCnt;
+}
+
 // not perfect especially with lower clocks or VERY good antennas (heavy wave clipping)
 // maybe somehow adjust peak trimming value based on samples to fix?
 // return start index of best starting position for that clock and return clock (by reference)
@@ -746,7 +762,18 @@ int DetectASKClock(uint8_t *dest, size_t size, int *clock, int maxErr) {
     size_t j = 0;
     uint16_t bestErr[] = {1000, 1000, 1000, 1000, 1000, 1000, 1000, 1000, 1000};
     uint8_t bestStart[] = {0, 0, 0, 0, 0, 0, 0, 0, 0};
-    size_t errCnt, arrLoc, loopEnd;
+    size_t errCnt, loopEnd;
+
+    // the peak test is repeated for every start position and clock,  do it once up front.
+    // one spare entry in front,  the tolerance window may look one sample before the start
+    uint8_t *peaks = NULL;
+#ifndef ON_DEVICE
+    uint8_t *peakbuf = calloc(size + 1, sizeof(uint8_t));
+    if (peakbuf) {
+        peaks = peakbuf + 1;
+        lf_peak_mask(dest, size, peak_hi, peak_low, peaks);
+    }
+#endif
 
     if (found_clk) {
         clkCnt = found_clk;
@@ -775,24 +802,18 @@ int DetectASKClock(uint8_t *dest, size_t size, int *clock, int maxErr) {
         getNextLow(dest, size, peak_low, &j);
 
         for (; j < loopCnt; j++) {
-            errCnt = 0;
             // now that we have the first one lined up test rest of wave array
             loopEnd = ((size - j - tol) / clk[clkCnt]) - 1;
-            for (i = 0; i < loopEnd; ++i) {
-                arrLoc = j + (i * clk[clkCnt]);
-                if (dest[arrLoc] >= peak_hi || dest[arrLoc] <= peak_low) {
-                } else if (dest[arrLoc - tol] >= peak_hi || dest[arrLoc - tol] <= peak_low) {
-                } else if (dest[arrLoc + tol] >= peak_hi || dest[arrLoc + tol] <= peak_low) {
-                } else {  //error no peak detected
-                    errCnt++;
-                }
-            }
+            errCnt = countAskClockErrors(dest, peaks, j, loopEnd, clk[clkCnt], tol, peak_hi, peak_low);
             // if we found no errors then we can stop here and a low clock (common clocks)
             //  this is correct one - return this clock
             // if (g_debugMode == 2) prnt("DEBUG ASK: clk %d, err %d, startpos %d, endpos %d", clk[clkCnt], errCnt, j, i);
             if (errCnt == 0 && clkCnt < 7) {
                 if (!found_clk)
                     *clock = clk[clkCnt];
+#ifndef ON_DEVICE
+                free(peakbuf);
+#endif
                 return j;
             }
             // if we found errors see if it is lowest so far and save it as best run
@@ -803,6 +824,10 @@ int DetectASKClock(uint8_t *dest, size_t size, int *clock, int maxErr) {
         }
     }
 
+#ifndef ON_DEVICE
+    free(peakbuf);
+#endif
+
     uint8_t k, best = 0;
 
     for (k = 1; k < num_clks; ++k) {
@@ -1021,12 +1046,15 @@ uint16_t countFC(const uint8_t *bits, size_t size, bool fskAdj) {
     if (size < 180) return 0;
 
     // prime i to first up transition
-    for (i = 160; i < size - 20; i++)
-        if (bits[i] > bits[i - 1] && bits[i] >= bits[i + 1])
-            break;
+    i = lf_find_peak(bits, 160, size - 20);
 
     for (; i < size - 20; i++) {
-        if (bits[i] > bits[i - 1] && bits[i] >= bits[i + 1]) {
+        // count samples up to the next up transition
+        size_t next = lf_find_peak(bits, i, size - 20);
+        fcCounter += next - i;
+        i = next;
+
+        if (i < size - 20) {
             // new up transition
             fcCounter++;
             if (fskAdj) {
@@ -1052,9 +1080,6 @@ uint16_t countFC(const uint8_t *bits, size_t size, bool fskAdj) {
                 fcLens[fcLensFnd++] = fcCounter;
             }
             fcCounter = 0;
-        } else {
-            // count sample
-            fcCounter++;
         }
     }
 
@@ -1845,6 +1870,10 @@ static size_t fsk_wave_demod(uint8_t *dest, size_t size, uint8_t fchigh, uint8_t
     last_transition = idx;
     idx++;
 
+    // threshold the rest in one go
+    if (idx < size - 20)
+        lf_threshold(dest + idx, size - 20 - idx, signalprop.mean);
+
     // Definition:  cycles between consecutive lo-hi transitions
     // Lets define some expected lengths. FSK1 is easier since it has bigger differences between.
     // FSK1 8/5
@@ -1877,11 +1906,10 @@ static size_t fsk_wave_demod(uint8_t *dest, size_t size, uint8_t fchigh, uint8_t
 
     for (; idx < size - 20; idx++) {
 
-        // threshold current value
-        dest[idx] = (dest[idx] < signalprop.mean) ? 0 : 1;
+        // skip to next 0->1 transition
+        idx = lf_find_rise(dest, idx, size - 20);
 
-        // Check for 0->1 transition
-        if (dest[idx - 1] < dest[idx]) {
+        if (idx < size - 20) {
             preLastSample = LastSample;
             LastSample = currSample;
             currSample = idx - last_transition;
@@ -0,0 +1,415 @@
+//-----------------------------------------------------------------------------
+// Copyright (C) Proxmark3 contributors. See AUTHORS.md for details.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// See LICENSE.txt for the text of the license.
+//-----------------------------------------------------------------------------
+// LF sample scanning primitives, see lfdemod_simd.h
+//-----------------------------------------------------------------------------
+#include "lfdemod_simd.h"
+
+#include <string.h>
+
+#if defined(__AVX2__)
+# include <immintrin.h>
+# define LF_SIMD "avx2"
+#elif defined(__SSE2__)
+# include <emmintrin.h>
+# define LF_SIMD "sse2"
+#elif defined(__ARM_NEON) && defined(__aarch64__) && !defined(NOSIMD_BUILD)
+# include <arm_neon.h>
+# define LF_SIMD "neon"
+#endif
+
+// **********************************************************************************************
+// plain C
+// **********************************************************************************************
+
+void lf_minmax_scalar(const uint8_t *samples, size_t n, uint8_t *low, uint8_t *high) {
+    uint8_t lo = 255, hi = 0;
+    for (size_t i = 0; i < n; i++) {
+        if (samples[i] < lo) lo = samples[i];
+        if (samples[i] > hi) hi = samples[i];
+    }
+    *low = lo;
+    *high = hi;
+}
+
+uint32_t lf_sum_range_scalar(const uint8_t *samples, size_t n, uint8_t low, uint8_t high, uint32_t *cnt) {
+    uint32_t sum = 0, c = 0;
+    for (size_t i = 0; i < n; i++) {
+        if (samples[i] < low || samples[i] > high)
+            continue;
+
+        sum += samples[i];
+        c++;
+    }
+    *cnt = c;
+    return sum;
+}
+
+void lf_shift_scalar(uint8_t *samples, size_t n, int offset) {
+    for (size_t i = 0; i < n; i++) {
+        int v = samples[i] + offset;
+        samples[i] = (v < 0) ? 0 : (v > 255) ? 255 : v;
+    }
+}
+
+void lf_threshold_scalar(uint8_t *samples, size_t n, int threshold) {
+    for (size_t i = 0; i < n; i++) {
+        samples[i] = (samples[i] < threshold) ? 0 : 1;
+    }
+}
+
+void lf_peak_mask_scalar(const uint8_t *samples, size_t n, int high, int low, uint8_t *mask) {
+    for (size_t i = 0; i < n; i++) {
+        mask[i] = (samples[i] >= high || samples[i] <= low);
+    }
+}
+
+size_t lf_find_le_scalar(const uint8_t *samples, size_t start, size_t n, int low) {
+    size_t i = start;
+    while (i < n && samples[i] > low)
+        i++;
+    return i;
+}
+
+size_t lf_find_ge_scalar(const uint8_t *samples, size_t start, size_t n, int high) {
+    size_t i = start;
+    while (i < n && samples[i] < high)
+        i++;
+    return i;
+}
+
+size_t lf_find_peak_scalar(const uint8_t *samples, size_t start, size_t n) {
+    size_t i = start;
+    while (i < n && (samples[i] > samples[i - 1] && samples[i] >= samples[i + 1]) == false)
+        i++;
+    return i;
+}
+
+size_t lf_find_rise_scalar(const uint8_t *samples, size_t start, size_t n) {
+    size_t i = start;
+    while (i < n && samples[i - 1] >= samples[i])
+        i++;
+    return i;
+}
+
+#ifndef LF_SIMD
+
+const char *lf_simd_name(void) {
+    return "scalar";
+}
+
+void lf_minmax(const uint8_t *samples, size_t n, uint8_t *low, uint8_t *high) {
+    lf_minmax_scalar(samples, n, low, high);
+}
+uint32_t lf_sum_range(const uint8_t *samples, size_t n, uint8_t low, uint8_t high, uint32_t *cnt) {
+    return lf_sum_range_scalar(samples, n, low, high, cnt);
+}
+void lf_shift(uint8_t *samples, size_t n, int offset) {
+    lf_shift_scalar(samples, n, offset);
+}
+void lf_threshold(uint8_t *samples, size_t n, int threshold) {
+    lf_threshold_scalar(samples, n, threshold);
+}
+void lf_peak_mask(const uint8_t *samples, size_t n, int high, int low, uint8_t *mask) {
+    lf_peak_mask_scalar(samples, n, high, low, mask);
+}
+size_t lf_find_le(const uint8_t *samples, size_t start, size_t n, int low) {
+    return lf_find_le_scalar(samples, start, n, low);
+}
+size_t lf_find_ge(const uint8_t *samples, size_t start, size_t n, int high) {
+    return lf_find_ge_scalar(samples, start, n, high);
+}
+size_t lf_find_peak(const uint8_t *samples, size_t start, size_t n) {
+    return lf_find_peak_scalar(samples, start, n);
+}
+size_t lf_find_rise(const uint8_t *samples, size_t start, size_t n) {
+    return lf_find_rise_scalar(samples, start, n);
+}
+
+#else
+
+// **********************************************************************************************
+// vector,  written once against the small set of operations below
+// **********************************************************************************************
+
+#if defined(__AVX2__)
+
+typedef __m256i lf_vec_t;
+typedef __m256i lf_acc_t;
+#define VW                  32
+#define V_LOAD(p)           _mm256_loadu_si256((const __m256i *)(p))
+#define V_STORE(p, v)       _mm256_storeu_si256((__m256i *)(p), (v))
+#define V_SET1(x)           _mm256_set1_epi8((char)(x))
+#define V_ZERO()            _mm256_setzero_si256()
+#define V_MIN(a, b)         _mm256_min_epu8((a), (b))
+#define V_MAX(a, b)         _mm256_max_epu8((a), (b))
+#define V_AND(a, b)         _mm256_and_si256((a), (b))
+#define V_OR(a, b)          _mm256_or_si256((a), (b))
+#define V_ANDNOT(a, b)      _mm256_andnot_si256((b), (a))
+#define V_ADDS(a, b)        _mm256_adds_epu8((a), (b))
+#define V_SUBS(a, b)        _mm256_subs_epu8((a), (b))
+#define V_GE(a, b)          _mm256_cmpeq_epi8(_mm256_max_epu8((a), (b)), (a))
+#define V_LE(a, b)          _mm256_cmpeq_epi8(_mm256_min_epu8((a), (b)), (a))
+#define V_GT(a, b)          _mm256_cmpgt_epi8(_mm256_xor_si256((a), _mm256_set1_epi8((char)0x80)), _mm256_xor_si256((b), _mm256_set1_epi8((char)0x80)))
+// one bit per lane
+#define V_MASK(m)           ((uint64_t)(uint32_t)_mm256_movemask_epi8(m))
+#define V_MASK_SHIFT        0
+#define V_ACC_ZERO()        _mm256_setzero_si256()
+#define V_ACC_ADD(acc, v)   _mm256_add_epi64((acc), _mm256_sad_epu8((v), _mm256_setzero_si256()))
+
+static inline uint32_t v_acc_total(lf_acc_t acc) {
+    uint64_t lanes[4];
+    _mm256_storeu_si256((__m256i *)lanes, acc);
+    return lanes[0] + lanes[1] + lanes[2] + lanes[3];
+}
+
+static inline void v_minmax_total(lf_vec_t lo, lf_vec_t hi, uint8_t *low, uint8_t *high) {
+    __m128i l = _mm_min_epu8(_mm256_castsi256_si128(lo), _mm256_extracti128_si256(lo, 1));
+    __m128i h = _mm_max_epu8(_mm256_castsi256_si128(hi), _mm256_extracti128_si256(hi, 1));
+    uint8_t ls[16], hs[16], dummy;
+    _mm_storeu_si128((__m128i *)ls, l);
+    _mm_storeu_si128((__m128i *)hs, h);
+    lf_minmax_scalar(ls, 16, low, &dummy);
+    lf_minmax_scalar(hs, 16, &dummy, high);
+}
+
+#elif defined(__SSE2__)
+
+typedef __m128i lf_vec_t;
+typedef __m128i lf_acc_t;
+#define VW                  16
+#define V_LOAD(p)           _mm_loadu_si128((const __m128i *)(p))
+#define V_STORE(p, v)       _mm_storeu_si128((__m128i *)(p), (v))
+#define V_SET1(x)           _mm_set1_epi8((char)(x))
+#define V_ZERO()            _mm_setzero_si128()
+#define V_MIN(a, b)         _mm_min_epu8((a), (b))
+#define V_MAX(a, b)         _mm_max_epu8((a), (b))
+#define V_AND(a, b)         _mm_and_si128((a), (b))
+#define V_OR(a, b)          _mm_or_si128((a), (b))
+#define V_ANDNOT(a, b)      _mm_andnot_si128((b), (a))
+#define V_ADDS(a, b)        _mm_adds_epu8((a), (b))
+#define V_SUBS(a, b)        _mm_subs_epu8((a), (b))
+#define V_GE(a, b)          _mm_cmpeq_epi8(_mm_max_epu8((a), (b)), (a))
+#define V_LE(a, b)          _mm_cmpeq_epi8(_mm_min_epu8((a), (b)), (a))
+#define V_GT(a, b)          _mm_cmpgt_epi8(_mm_xor_si128((a), _mm_set1_epi8((char)0x80)), _mm_xor_si128((b), _mm_set1_epi8((char)0x80)))
+#define V_MASK(m)           ((uint64_t)(uint32_t)_mm_movemask_epi8(m))
+#define V_MASK_SHIFT        0
+#define V_ACC_ZERO()        _mm_setzero_si128()
+#define V_ACC_ADD(acc, v)   _mm_add_epi64((acc), _mm_sad_epu8((v), _mm_setzero_si128()))
+
+static inline uint32_t v_acc_total(lf_acc_t acc) {
+    uint64_t lanes[2];
+    _mm_storeu_si128((__m128i *)lanes, acc);
+    return lanes[0] + lanes[1];
+}
+
+static inline void v_minmax_total(lf_vec_t lo, lf_vec_t hi, uint8_t *low, uint8_t *high) {
+    uint8_t ls[16], hs[16], dummy;
+    _mm_storeu_si128((__m128i *)ls, lo);
+    _mm_storeu_si128((__m128i *)hs, hi);
+    lf_minmax_scalar(ls, 16, low, &dummy);
+    lf_minmax_scalar(hs, 16, &dummy, high);
+}
+
+#else // neon
+
+typedef uint8x16_t lf_vec_t;
+typedef uint32x4_t lf_acc_t;
+#define VW                  16
+#define V_LOAD(p)           vld1q_u8(p)
+#define V_STORE(p, v)       vst1q_u8((p), (v))
+#define V_SET1(x)           vdupq_n_u8((uint8_t)(x))
+#define V_ZERO()            vdupq_n_u8(0)
+#define V_MIN(a, b)         vminq_u8((a), (b))
+#define V_MAX(a, b)         vmaxq_u8((a), (b))
+#define V_AND(a, b)         vandq_u8((a), (b))
+#define V_OR(a, b)          vorrq_u8((a), (b))
+#define V_ANDNOT(a, b)      vbicq_u8((a), (b))
+#define V_ADDS(a, b)        vqaddq_u8((a), (b))
+#define V_SUBS(a, b)        vqsubq_u8((a), (b))
+#define V_GE(a, b)          vcgeq_u8((a), (b))
+#define V_LE(a, b)          vcleq_u8((a), (b))
+#define V_GT(a, b)          vcgtq_u8((a), (b))
+// no movemask,  narrow to four bits per lane instead
+#define V_MASK(m)           vget_lane_u64(vreinterpret_u64_u8(vshrn_n_u16(vreinterpretq_u16_u8(m), 4)), 0)
+#define V_MASK_SHIFT        2
+#define V_ACC_ZERO()        vdupq_n_u32(0)
+#define V_ACC_ADD(acc, v)   vpadalq_u16((acc), vpaddlq_u8(v))
+
+static inline uint32_t v_acc_total(lf_acc_t acc) {
+    return vaddvq_u32(acc);
+}
+
+static inline void v_minmax_total(lf_vec_t lo, lf_vec_t hi, uint8_t *low, uint8_t *high) {
+    *low = vminvq_u8(lo);
+    *high = vmaxvq_u8(hi);
+}
+
+#endif
+
+// index of the first lane set in a compare result,  or VW
+static inline size_t v_first(lf_vec_t m) {
+    uint64_t bits = V_MASK(m);
+    if (bits == 0)
+        return VW;
+    return (size_t)__builtin_ctzll(bits) >> V_MASK_SHIFT;
+}
+
+const char *lf_simd_name(void) {
+    return LF_SIMD;
+}
+
+void lf_minmax(const uint8_t *samples, size_t n, uint8_t *low, uint8_t *high) {
+    if (n < VW) {
+        lf_minmax_scalar(samples, n, low, high);
+        return;
+    }
+
+    lf_vec_t lo = V_LOAD(samples), hi = lo;
+    size_t i = VW;
+    for (; i + VW <= n; i += VW) {
+        lf_vec_t v = V_LOAD(samples + i);
+        lo = V_MIN(lo, v);
+        hi = V_MAX(hi, v);
+    }
+    // overlapping last block
+    lf_vec_t v = V_LOAD(samples + n - VW);
+    v_minmax_total(V_MIN(lo, v), V_MAX(hi, v), low, high);
+}
+
+uint32_t lf_sum_range(const uint8_t *samples, size_t n, uint8_t low, uint8_t high, uint32_t *cnt) {
+    lf_vec_t lo = V_SET1(low), hi = V_SET1(high), one = V_SET1(1);
+    lf_acc_t sum = V_ACC_ZERO(), c = V_ACC_ZERO();
+
+    size_t i = 0;
+    for (; i + VW <= n; i += VW) {
+        lf_vec_t v = V_LOAD(samples + i);
+        lf_vec_t in = V_AND(V_GE(v, lo), V_LE(v, hi));
+        sum = V_ACC_ADD(sum, V_AND(v, in));
+        c = V_ACC_ADD(c, V_AND(one, in));
+    }
+
+    uint32_t tail_cnt;
+    uint32_t tail = lf_sum_range_scalar(samples + i, n - i, low, high, &tail_cnt);
+    *cnt = v_acc_total(c) + tail_cnt;
+    return v_acc_total(sum) + tail;
+}
+
+void lf_shift(uint8_t *samples, size_t n, int offset) {
+    if (offset == 0)
+        return;
+
+    uint8_t amount = (offset > 255 || offset < -255) ? 255 : (offset < 0) ? -offset : offset;
+    lf_vec_t a = V_SET1(amount);
+
+    size_t i = 0;
+    for (; i + VW <= n; i += VW) {
+        lf_vec_t v = V_LOAD(samples + i);
+        V_STORE(samples + i, (offset > 0) ? V_ADDS(v, a) : V_SUBS(v, a));
+    }
+    lf_shift_scalar(samples + i, n - i, offset);
+}
+
+void lf_threshold(uint8_t *samples, size_t n, int threshold) {
+    if (threshold <= 0 || threshold > 255) {
+        memset(samples, (threshold <= 0), n);
+        return;
+    }
+
+    lf_vec_t t = V_SET1(threshold), one = V_SET1(1);
+
+    size_t i = 0;
+    for (; i + VW <= n; i += VW) {
+        lf_vec_t v = V_LOAD(samples + i);
+        V_STORE(samples + i, V_AND(V_GE(v, t), one));
+    }
+    lf_threshold_scalar(samples + i, n - i, threshold);
+}
+
+void lf_peak_mask(const uint8_t *samples, size_t n, int high, int low, uint8_t *mask) {
+    // thresholds outside 0..255 turn into all or nothing
+    lf_vec_t hi = V_SET1((high < 0) ? 0 : (high > 255) ? 255 : high);
+    lf_vec_t lo = V_SET1((low < 0) ? 0 : (low > 255) ? 255 : low);
+    lf_vec_t hi_on = V_SET1((high > 255) ? 0 : 0xFF);
+    lf_vec_t lo_on = V_SET1((low < 0) ? 0 : 0xFF);
+    lf_vec_t one = V_SET1(1);
+
+    size_t i = 0;
+    for (; i + VW <= n; i += VW) {
+        lf_vec_t v = V_LOAD(samples + i);
+        lf_vec_t m = V_OR(V_AND(V_GE(v, hi), hi_on), V_AND(V_LE(v, lo), lo_on));
+        V_STORE(mask + i, V_AND(m, one));
+    }
+    lf_peak_mask_scalar(samples + i, n - i, high, low, mask + i);
+}
+
+size_t lf_find_le(const uint8_t *samples, size_t start, size_t n, int low) {
+    if (start >= n || low < 0)
+        return (start >= n) ? start : n;
+    if (low >= 255)
+        return start;
+
+    lf_vec_t lo = V_SET1(low);
+
+    size_t i = start;
+    for (; i + VW <= n; i += VW) {
+        size_t k = v_first(V_LE(V_LOAD(samples + i), lo));
+        if (k < VW)
+            return i + k;
+    }
+    return lf_find_le_scalar(samples, i, n, low);
+}
+
+size_t lf_find_ge(const uint8_t *samples, size_t start, size_t n, int high) {
+    if (start >= n || high > 255)
+        return (start >= n) ? start : n;
+    if (high <= 0)
+        return start;
+
+    lf_vec_t hi = V_SET1(high);
+
+    size_t i = start;
+    for (; i + VW <= n; i += VW) {
+        size_t k = v_first(V_GE(V_LOAD(samples + i), hi));
+        if (k < VW)
+            return i + k;
+    }
+    return lf_find_ge_scalar(samples, i, n, high);
+}
+
+size_t lf_find_peak(const uint8_t *samples, size_t start, size_t n) {
+    size_t i = start;
+    for (; i + VW <= n; i += VW) {
+        lf_vec_t prev = V_LOAD(samples + i - 1);
+        lf_vec_t cur = V_LOAD(samples + i);
+        lf_vec_t next = V_LOAD(samples + i + 1);
+        size_t k = v_first(V_ANDNOT(V_GT(cur, prev), V_GT(next, cur)));
+        if (k < VW)
+            return i + k;
+    }
+    return lf_find_peak_scalar(samples, i, n);
+}
+
+size_t lf_find_rise(const uint8_t *samples, size_t start, size_t n) {
+    size_t i = start;
+    for (; i + VW <= n; i += VW) {
+        size_t k = v_first(V_GT(V_LOAD(samples + i), V_LOAD(samples + i - 1)));
+        if (k < VW)
+            return i + k;
+    }
+    return lf_find_rise_scalar(samples, i, n);
+}
+
+#endif
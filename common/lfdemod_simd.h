@@ -0,0 +1,70 @@
+//-----------------------------------------------------------------------------
+// Copyright (C) Proxmark3 contributors. See AUTHORS.md for details.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// See LICENSE.txt for the text of the license.
+//-----------------------------------------------------------------------------
+// Sample scanning primitives the LF demodulators are built on.
+//
+// Every primitive has a plain C version (_scalar) and a default one which is
+// the widest of AVX2 / SSE2 / NEON (aarch64) the build targets, or the plain C
+// one when there is none (device side, 32 bit ARM, ...). Both always return
+// the same results.
+//-----------------------------------------------------------------------------
+
+#ifndef LFDEMOD_SIMD_H__
+#define LFDEMOD_SIMD_H__
+
+#include "common.h"
+
+// instruction set behind the default primitives, "avx2", "sse2", "neon" or "scalar"
+const char *lf_simd_name(void);
+
+// smallest and largest sample, n > 0
+void lf_minmax(const uint8_t *samples, size_t n, uint8_t *low, uint8_t *high);
+void lf_minmax_scalar(const uint8_t *samples, size_t n, uint8_t *low, uint8_t *high);
+
+// sum and count of the samples within [low, high]
+uint32_t lf_sum_range(const uint8_t *samples, size_t n, uint8_t low, uint8_t high, uint32_t *cnt);
+uint32_t lf_sum_range_scalar(const uint8_t *samples, size_t n, uint8_t low, uint8_t high, uint32_t *cnt);
+
+// add offset to every sample,  saturating at 0 and 255
+void lf_shift(uint8_t *samples, size_t n, int offset);
+void lf_shift_scalar(uint8_t *samples, size_t n, int offset);
+
+// samples become 0 below threshold, 1 otherwise
+void lf_threshold(uint8_t *samples, size_t n, int threshold);
+void lf_threshold_scalar(uint8_t *samples, size_t n, int threshold);
+
+// mask[x] = 1 where samples[x] >= high or samples[x] <= low, 0 elsewhere
+void lf_peak_mask(const uint8_t *samples, size_t n, int high, int low, uint8_t *mask);
+void lf_peak_mask_scalar(const uint8_t *samples, size_t n, int high, int low, uint8_t *mask);
+
+// first index from start on with samples[x] <= low,  or n if there is none
+size_t lf_find_le(const uint8_t *samples, size_t start, size_t n, int low);
+size_t lf_find_le_scalar(const uint8_t *samples, size_t start, size_t n, int low);
+
+// first index from start on with samples[x] >= high,  or n if there is none
+size_t lf_find_ge(const uint8_t *samples, size_t start, size_t n, int high);
+size_t lf_find_ge_scalar(const uint8_t *samples, size_t start, size_t n, int high);
+
+// first index from start on with samples[x - 1] < samples[x] >= samples[x + 1],  or n if there is none
+// start must be > 0,  samples[n] is read
+size_t lf_find_peak(const uint8_t *samples, size_t start, size_t n);
+size_t lf_find_peak_scalar(const uint8_t *samples, size_t start, size_t n);
+
+// first index from start on with samples[x - 1] < samples[x],  or n if there is none
+// start must be > 0
+size_t lf_find_rise(const uint8_t *samples, size_t start, size_t n);
+size_t lf_find_rise_scalar(const uint8_t *samples, size_t start, size_t n);
+
+#endif
@@ -39,6 +39,7 @@
 #define RESOURCES_SUBDIR     "resources" PATHSEP
 #define TRACES_SUBDIR        "traces" PATHSEP
 #define LOGS_SUBDIR          "logs" PATHSEP
+#define CACHE_SUBDIR         "cache" PATHSEP
 #define FIRMWARES_SUBDIR     "firmware" PATHSEP
 #define BOOTROM_SUBDIR       "bootrom" PATHSEP "obj" PATHSEP
 #define FULLIMAGE_SUBDIR     "armsrc" PATHSEP "obj" PATHSEP
@@ -370,16 +370,97 @@ static inline void sm_left_mask(const uint8_t *ks, uint8_t *mask, uint64_t rstat
 
 std::atomic<bool> key_found{0};
 std::atomic<uint64_t> key{0};
-std::atomic<size_t> g_topbits{0};
 std::mutex g_ice_mtx;
 static uint32_t g_num_cpus = std::thread::hardware_concurrency();
 
+// The worker threads keep their candidate states in their own buffer, as bin keys
+// with the correct bits count on top. Sorted descending these give the order the
+// shared std::map used to: highest bin first, then highest state.
+#define ICE_BIN_KEY(bits, state)    ((((uint64_t)(bits)) << 56) | (state))
+#define ICE_BIN_STATE(key)          ((key) & 0x00ffffffffffffffull)
+
+// largest amount of memory the state buffers held at once
+static size_t g_store_peak = 0;
+
+static void ice_store_account(size_t bytes) {
+    if (bytes > g_store_peak)
+        g_store_peak = bytes;
+}
+
+// Sort with all threads, every thread sorts a slice then neighbouring slices get merged
+template <typename T, typename Compare>
+static void ice_parallel_sort(vector<T> *v, Compare comp) {
+
+    size_t parts = g_num_cpus;
+    if (parts > v->size() / 0x1000)
+        parts = v->size() / 0x1000;
+    if (parts < 2) {
+        sort(v->begin(), v->end(), comp);
+        return;
+    }
+
+    vector<size_t> bounds(parts + 1);
+    for (size_t i = 0; i <= parts; i++) {
+        bounds[i] = (v->size() * i) / parts;
+    }
+
+    std::vector<std::thread> threads;
+    for (size_t i = 0; i < parts; i++) {
+        threads.push_back(std::thread([v, &bounds, comp, i]() {
+            sort(v->begin() + bounds[i], v->begin() + bounds[i + 1], comp);
+        }));
+    }
+    for (auto &t : threads) {
+        t.join();
+    }
+
+    for (size_t width = 1; width < parts; width <<= 1) {
+        threads.clear();
+        for (size_t i = 0; i + width < parts; i += 2 * width) {
+            size_t lo = bounds[i];
+            size_t mid = bounds[i + width];
+            size_t hi = bounds[min(i + 2 * width, parts)];
+            threads.push_back(std::thread([v, comp, lo, mid, hi]() {
+                inplace_merge(v->begin() + lo, v->begin() + mid, v->begin() + hi, comp);
+            }));
+        }
+        for (auto &t : threads) {
+            t.join();
+        }
+    }
+}
+
+// Concatenate the per thread buffers, freeing them on the way.
+// held is what the caller keeps allocated meanwhile, in bytes
+static void ice_gather(vector<vector<uint64_t>> *buffers, vector<uint64_t> *out, size_t held) {
+    size_t total = 0;
+    for (auto &b : *buffers) {
+        total += b.size();
+        held += b.capacity() * sizeof(uint64_t);
+    }
+
+    out->clear();
+    out->reserve(total);
+    ice_store_account(held + out->capacity() * sizeof(uint64_t));
+
+    for (auto &b : *buffers) {
+        out->insert(out->end(), b.begin(), b.end());
+        vector<uint64_t>().swap(b);
+    }
+}
+
+typedef struct {
+    vector<uint64_t> bins;  // bin key of every state with at least 90 correct bits
+    size_t topbits;
+    uint64_t topstate;
+    uint8_t mask[16];
+} ice_right_result_t;
+
 static void ice_sm_right_thread(
     uint8_t offset,
     uint8_t skips,
     const uint8_t *ks,
-    map<uint64_t, uint64_t> *bincstates,
-    uint8_t *mask
+    ice_right_result_t *res
 ) {
 
     uint8_t tmp_mask[16];
@@ -419,23 +500,18 @@ static void ice_sm_right_thread(
             if (((bt >> 7) & 0x01) == 0) bits++;
         }
 
-        g_ice_mtx.lock();
-        if (bits > g_topbits.load(std::memory_order_relaxed)) {
+        // Best of this thread, the first (lowest) state wins a tie
+        if (bits > res->topbits) {
             // Copy the winning mask
-            g_topbits = bits;
-            memcpy(mask, tmp_mask, 16);
+            res->topbits = bits;
+            res->topstate = counter;
+            memcpy(res->mask, tmp_mask, 16);
         }
-        g_ice_mtx.unlock();
 
         // Ignore states under 90
         if (bits >= 90) {
             //  Make sure the bits are used for ordering
-            g_ice_mtx.lock();
-            if (bincstates->find((((uint64_t)bits) << 56) | counter) != bincstates->end())
-                bincstates->at((((uint64_t)bits) << 56) | counter) = counter;
-            else
-                bincstates->insert(std::pair<uint64_t, uint64_t>((((uint64_t)bits) << 56) | counter, counter));
-            g_ice_mtx.unlock();
+            res->bins.push_back(ICE_BIN_KEY(bits, counter));
         }
 
         if ((counter & 0xfffff) == 0) {
@@ -448,12 +524,12 @@ static void ice_sm_right_thread(
 }
 static uint32_t ice_sm_right(const uint8_t *ks, uint8_t *mask, vector<uint64_t> *pcrstates) {
 
-    map<uint64_t, uint64_t> bincstates;
-    g_topbits = ATOMIC_VAR_INIT(0);
-
+    vector<ice_right_result_t> results(g_num_cpus);
     std::vector<std::thread> threads(g_num_cpus);
     for (uint8_t m = 0; m < g_num_cpus; m++) {
-        threads[m] = std::thread(ice_sm_right_thread, m, g_num_cpus, ks, &bincstates, mask);
+        results[m].topbits = 0;
+        results[m].topstate = 0;
+        threads[m] = std::thread(ice_sm_right_thread, m, g_num_cpus, ks, &results[m]);
     }
     for (auto &t : threads) {
         t.join();
@@ -461,26 +537,42 @@ static uint32_t ice_sm_right(const uint8_t *ks, uint8_t *mask, vector<uint64_t>
 
     printf("\n");
 
+    // Winning mask over all threads, ties go to the lowest state like a single thread would
+    size_t topbits = 0;
+    uint64_t topstate = 0;
+    vector<vector<uint64_t>> buffers(g_num_cpus);
+    for (uint8_t m = 0; m < g_num_cpus; m++) {
+        ice_right_result_t *res = &results[m];
+        if (res->topbits > topbits || (res->topbits == topbits && topbits && res->topstate < topstate)) {
+            topbits = res->topbits;
+            topstate = res->topstate;
+            memcpy(mask, res->mask, 16);
+        }
+        buffers[m].swap(res->bins);
+    }
+
+    vector<uint64_t> bins;
+    ice_gather(&buffers, &bins, 0);
+
+    // highest bin first
+    ice_parallel_sort(&bins, greater<uint64_t>());
+
     // Clear the candidate state vector
     pcrstates->clear();
-
-    // Copy the order the states from lowest-bin to highest-bin
-    map<uint64_t, uint64_t>::iterator it;
-    for (it = bincstates.begin(); it != bincstates.end(); ++it) {
-        pcrstates->push_back(it->second);
+    pcrstates->reserve(bins.size());
+    ice_store_account(bins.capacity() * sizeof(uint64_t) + pcrstates->capacity() * sizeof(uint64_t));
+    for (auto b : bins) {
+        pcrstates->push_back(ICE_BIN_STATE(b));
     }
 
-    // Reverse the vector order (so the highest bin comes first)
-    reverse(pcrstates->begin(), pcrstates->end());
-
-    return g_topbits;
+    return topbits;
 }
 
 static void ice_sm_left_thread(
     uint8_t offset,
     uint8_t skips,
     const uint8_t *ks,
-    map<uint64_t, cs_t> *bincstates,
+    vector<uint64_t> *bins,
     const uint8_t *mask
 ) {
 
@@ -489,11 +581,6 @@ static void ice_sm_left_thread(
     uint8_t bt;
     lookup_entry *lookup;
 
-    // Reset and initialize the cryptostate and vector
-    cs_t state;
-    memset(&state, 0x00, sizeof(cs_t));
-    state.invalid = false;
-
     for (uint64_t counter = offset; counter < 0x800000000ull; counter += skips) {
         uint64_t lstate = counter;
 
@@ -538,18 +625,8 @@ static void ice_sm_left_thread(
                 if (((bt >> 7) & 0x01) == 0) bits++;
             }
 
-            state.l = counter;
-
             //  Make sure the bits are used for ordering
-            g_ice_mtx.lock();
-            printf(".");
-            fflush(stdout);
-            if (bincstates->find((((uint64_t)bits) << 56) | counter) != bincstates->end())
-                bincstates->at((((uint64_t)bits) << 56) | counter) = state;
-            else
-                bincstates->insert(std::pair<uint64_t, cs_t>((((uint64_t)bits) << 56) | counter, state));
-            g_ice_mtx.unlock();
-
+            bins->push_back(ICE_BIN_KEY(bits, counter));
         }
 
         if ((counter & 0xffffffffull) == 0) {
@@ -563,10 +640,10 @@ static void ice_sm_left_thread(
 
 static void ice_sm_left(const uint8_t *ks, uint8_t *mask, vector<cs_t> *pcstates) {
 
-    map<uint64_t, cs_t> bincstates;
+    vector<vector<uint64_t>> buffers(g_num_cpus);
     std::vector<std::thread> threads(g_num_cpus);
     for (uint8_t m = 0; m < g_num_cpus; m++) {
-        threads[m] = std::thread(ice_sm_left_thread, m, g_num_cpus, ks, &bincstates, mask);
+        threads[m] = std::thread(ice_sm_left_thread, m, g_num_cpus, ks, &buffers[m], mask);
     }
 
     for (auto &t : threads) {
@@ -575,16 +652,25 @@ static void ice_sm_left(const uint8_t *ks, uint8_t *mask, vector<cs_t> *pcstates
 
     printf("100%%\n");
 
+    vector<uint64_t> bins;
+    ice_gather(&buffers, &bins, 0);
+
+    // highest bin first
+    ice_parallel_sort(&bins, greater<uint64_t>());
+
+    // Reset and initialize the cryptostate and vector
+    cs_t state;
+    memset(&state, 0x00, sizeof(cs_t));
+    state.invalid = false;
+
     // Clear the candidate state vector
     pcstates->clear();
-
-    // Copy the order the states from lowest-bin to highest-bin
-    map<uint64_t, cs_t>::iterator it;
-    for (it = bincstates.begin(); it != bincstates.end(); ++it) {
-        pcstates->push_back(it->second);
+    pcstates->reserve(bins.size());
+    ice_store_account(bins.capacity() * sizeof(uint64_t) + pcstates->capacity() * sizeof(cs_t));
+    for (auto b : bins) {
+        state.l = ICE_BIN_STATE(b);
+        pcstates->push_back(state);
     }
-    // Reverse the vector order (so the highest bin comes first)
-    reverse(pcstates->begin(), pcstates->end());
 }
 
 static inline uint32_t sm_right(const uint8_t *ks, uint8_t *mask, vector<uint64_t> *pcrstates) {
@@ -883,49 +969,89 @@ static inline void search_gc_candidates_left(const uint64_t lstate_before_gc, co
     printf("\n");
 }
 
+// The 16 bits of Gc both sides recover (8 x 2bits), left and right candidates have to agree on them
+static inline uint64_t gc_overlap(const cs_t *s) {
+    uint64_t overlap = 0;
+    for (size_t pos = 0; pos < 8; pos++) {
+        overlap = (overlap << 2) | ((s->Gc[pos] & 0x18) >> 3);
+    }
+    return overlap;
+}
+
+// (overlap << 32) | index of every state,  sorted
+static void gc_overlap_index(const vector<cs_t> *pcstates, vector<uint64_t> *sorted) {
+    sorted->clear();
+    sorted->reserve(pcstates->size());
+    for (size_t i = 0; i < pcstates->size(); i++) {
+        sorted->push_back((gc_overlap(&(*pcstates)[i]) << 32) | i);
+    }
+    ice_parallel_sort(sorted, less<uint64_t>());
+}
+
+static void ice_combine_thread(
+    const vector<uint64_t> *outer,
+    size_t from,
+    size_t to,
+    const vector<uint64_t> *inner,
+    const vector<cs_t> *pouter,
+    const vector<cs_t> *pinner,
+    vector<uint64_t> *gc_candidates
+) {
+    // Merge join, both sides are sorted on the overlap
+    auto itr = inner->begin();
+    for (size_t i = from; i < to; i++) {
+        uint64_t overlap = (*outer)[i] >> 32;
+
+        while (itr != inner->end() && (*itr >> 32) < overlap)
+            ++itr;
+
+        const cs_t *lo = &(*pouter)[(*outer)[i] & 0xffffffff];
+        for (auto it = itr; it != inner->end() && (*it >> 32) == overlap; ++it) {
+            const cs_t *li = &(*pinner)[*it & 0xffffffff];
+
+            uint64_t gc = 0;
+            for (size_t pos = 0; pos < 8; pos++) {
+                gc <<= 8;
+                gc |= (lo->Gc[pos] | li->Gc[pos]);
+            }
+            gc_candidates->push_back(gc);
+        }
+    }
+}
+
 void combine_valid_left_right_states(vector<cs_t> *plcstates, vector<cs_t> *prcstates, vector<uint64_t> *pgc_candidates) {
-    vector<cs_t>::iterator itl, itr;
-    size_t pos, count;
-    uint64_t gc;
-    bool valid;
 
-    vector<cs_t> outer, inner;
+    const vector<cs_t> *pouter, *pinner;
     if (plcstates->size() > prcstates->size()) {
-        outer = *plcstates;
-        inner = *prcstates;
+        pouter = plcstates;
+        pinner = prcstates;
     } else {
-        outer = *prcstates;
-        inner = *plcstates;
+        pouter = prcstates;
+        pinner = plcstates;
     }
 
-    printf("Outer  " _YELLOW_("%zu")" , inner " _YELLOW_("%zu") "\n", outer.size(), inner.size());
+    printf("Outer  " _YELLOW_("%zu")" , inner " _YELLOW_("%zu") "\n", pouter->size(), pinner->size());
 
-    // Clean up the candidate list
-    pgc_candidates->clear();
-    count = 0;
-    for (itl = outer.begin(); itl != outer.end(); ++itl) {
-        for (itr = inner.begin(); itr != inner.end(); ++itr) {
-            valid = true;
-            // Check for left and right candidates that share the overlapping bits (8 x 2bits of Gc)
-            for (pos = 0; pos < 8; pos++) {
-                if ((itl->Gc[pos] & 0x18) != (itr->Gc[pos] & 0x18)) {
-                    valid = false;
-                    break;
-                }
-            }
+    // Sort both sides on the overlapping bits instead of testing every pair
+    vector<uint64_t> outer, inner;
+    gc_overlap_index(pouter, &outer);
+    gc_overlap_index(pinner, &inner);
 
-            if (valid) {
-                gc = 0;
-                for (pos = 0; pos < 8; pos++) {
-                    gc <<= 8;
-                    gc |= (itl->Gc[pos] | itr->Gc[pos]);
-                }
-
-                pgc_candidates->push_back(gc);
-            }
-            count++;
-        }
+    // Every thread joins a slice of the outer side
+    vector<vector<uint64_t>> buffers(g_num_cpus);
+    std::vector<std::thread> threads(g_num_cpus);
+    for (uint8_t m = 0; m < g_num_cpus; m++) {
+        size_t from = (outer.size() * m) / g_num_cpus;
+        size_t to = (outer.size() * (m + 1)) / g_num_cpus;
+        threads[m] = std::thread(ice_combine_thread, &outer, from, to, &inner, pouter, pinner, &buffers[m]);
+    }
+    for (auto &t : threads) {
+        t.join();
     }
+
+    // Clean up the candidate list
+    ice_gather(&buffers, pgc_candidates, (outer.capacity() + inner.capacity()) * sizeof(uint64_t));
+
     printf("Found a total of " _YELLOW_("%llu")" combinations, ", ((unsigned long long)plcstates->size()) * prcstates->size());
     printf("but only " _GREEN_("%zu")" were valid!\n", pgc_candidates->size());
 }
@@ -1128,5 +1254,7 @@ int main(int argc, const char *argv[]) {
 
         printf(_RED_("\nCould not find key using this right cipher state.\n\n"));
     }
+
+    printf("Peak state store memory " _YELLOW_("%.1f") " MiB\n", (double)g_store_peak / (1024 * 1024));
     return 0;
 }
@@ -0,0 +1,496 @@
+//-----------------------------------------------------------------------------
+// ht2crack5 search kernel, compiled once per instruction set by
+// bitslice_instances.h.
+//
+// Each lane of a bitslice holds one value of the lowest log2(BS_BITS) bits
+// of filter_pos[], the i1 loop guesses the remaining ones, so every width
+// searches the same states in a different order.
+//-----------------------------------------------------------------------------
+
+static inline BS_TARGET uint64_t BS_FN(unbitslice)(const bs_slice *restrict b, uint32_t lane, uint8_t n) {
+    uint64_t result = 0;
+    for (uint8_t i = 0; i < n; ++i) {
+        result <<= 1;
+        result |= bs_lane(&b[n - 1 - i], lane);
+    }
+    return result;
+}
+
+static BS_TARGET void BS_FN(find_state)(uint64_t state0) {
+    // we never actually set or use the lowest 2 bits the initial state, so we can save 2 bitslices everywhere
+    bs_slice state[-2 + 32 + 48];
+    bs_slice keystream[32];
+    const uint32_t lane_bits = __builtin_ctz(BS_BITS);
+
+    // bitslice inverse target bits
+    for (size_t i = 0; i < 32; i++) {
+        keystream[i].v = bs_fill((aR1 >> (31 - i)) & 1);
+    }
+
+    for (size_t i = 0; i < 46; i++) {
+        state[i].v = bs_fill((state0 >> (i + 2)) & 1);
+    }
+
+    // bitslice all possible values of the lowest lane_bits bits, lane r gets value r
+    for (uint32_t bit = 0; bit < lane_bits; bit++) {
+        bs_slice *s = &state[-2 + filter_pos[bit]];
+        s->v = bs_fill(false);
+        for (uint32_t r = 0; r < BS_BITS; r++) {
+            s->w[r >> 6] |= (uint64_t)((r >> bit) & 1) << (r & 0x3f);
+        }
+    }
+
+    for (uint32_t i1 = 0; i1 < (1u << (bits[1] + 1 - lane_bits)); i1++) {
+        for (uint32_t bit = lane_bits; bit < 14; bit++) {
+            state[-2 + filter_pos[bit]].v = bs_fill((i1 >> (bit - lane_bits)) & 1);
+        }
+        state[-2 + 48].v = bs_fill((i1 >> (14 - lane_bits)) & 1); // guess lfsr output 0
+        // 0xfc07fef3f9fe
+        const bs_vec filter1_0 = f_a_bs(state[-2 + 3].v, state[-2 + 4].v, state[-2 + 6].v, state[-2 + 7].v);
+        const bs_vec filter1_1 = f_b_bs(state[-2 + 9].v, state[-2 + 13].v, state[-2 + 15].v, state[-2 + 16].v);
+        const bs_vec filter1_2 = f_b_bs(state[-2 + 18].v, state[-2 + 22].v, state[-2 + 24].v, state[-2 + 27].v);
+        const bs_vec filter1_3 = f_b_bs(state[-2 + 29].v, state[-2 + 30].v, state[-2 + 32].v, state[-2 + 34].v);
+        const bs_vec filter1_4 = f_a_bs(state[-2 + 35].v, state[-2 + 44].v, state[-2 + 45].v, state[-2 + 47].v);
+        const bs_vec filter1 = f_c_bs(filter1_0, filter1_1, filter1_2, filter1_3, filter1_4);
+        bs_slice results1;
+        results1.v = filter1 ^ keystream[1].v;
+
+        if (!bs_any(results1.v)) {
+            continue;
+        }
+        const bs_vec filter2_0 = f_a_bs(state[-2 + 4].v, state[-2 + 5].v, state[-2 + 7].v, state[-2 + 8].v);
+        const bs_vec filter2_3 = f_b_bs(state[-2 + 30].v, state[-2 + 31].v, state[-2 + 33].v, state[-2 + 35].v);
+        const bs_vec filter3_0 = f_a_bs(state[-2 + 5].v, state[-2 + 6].v, state[-2 + 8].v, state[-2 + 9].v);
+        const bs_vec filter5_2 = f_b_bs(state[-2 + 22].v, state[-2 + 26].v, state[-2 + 28].v, state[-2 + 31].v);
+        const bs_vec filter6_2 = f_b_bs(state[-2 + 23].v, state[-2 + 27].v, state[-2 + 29].v, state[-2 + 32].v);
+        const bs_vec filter7_2 = f_b_bs(state[-2 + 24].v, state[-2 + 28].v, state[-2 + 30].v, state[-2 + 33].v);
+        const bs_vec filter9_1 = f_b_bs(state[-2 + 17].v, state[-2 + 21].v, state[-2 + 23].v, state[-2 + 24].v);
+        const bs_vec filter9_2 = f_b_bs(state[-2 + 26].v, state[-2 + 30].v, state[-2 + 32].v, state[-2 + 35].v);
+        const bs_vec filter10_0 = f_a_bs(state[-2 + 12].v, state[-2 + 13].v, state[-2 + 15].v, state[-2 + 16].v);
+        const bs_vec filter11_0 = f_a_bs(state[-2 + 13].v, state[-2 + 14].v, state[-2 + 16].v, state[-2 + 17].v);
+        const bs_vec filter12_0 = f_a_bs(state[-2 + 14].v, state[-2 + 15].v, state[-2 + 17].v, state[-2 + 18].v);
+
+        for (uint16_t i2 = 0; i2 < (1 << (bits[2] + 1)); i2++) {
+            state[-2 + 10].v = bs_fill(i2 & 0x1);
+            state[-2 + 19].v = bs_fill(i2 & 0x2);
+            state[-2 + 25].v = bs_fill(i2 & 0x4);
+            state[-2 + 36].v = bs_fill(i2 & 0x8);
+            state[-2 + 49].v = bs_fill(i2 & 0x10); // guess lfsr output 1
+            // 0xfe07fffbfdff
+            const bs_vec filter2_1 = f_b_bs(state[-2 + 10].v, state[-2 + 14].v, state[-2 + 16].v, state[-2 + 17].v);
+            const bs_vec filter2_2 = f_b_bs(state[-2 + 19].v, state[-2 + 23].v, state[-2 + 25].v, state[-2 + 28].v);
+            const bs_vec filter2_4 = f_a_bs(state[-2 + 36].v, state[-2 + 45].v, state[-2 + 46].v, state[-2 + 48].v);
+            const bs_vec filter2 = f_c_bs(filter2_0, filter2_1, filter2_2, filter2_3, filter2_4);
+            bs_slice results2;
+            results2.v = results1.v & (filter2 ^ keystream[2].v);
+
+            if (!bs_any(results2.v)) {
+                continue;
+            }
+            state[-2 + 50].v = lfsr_bs(2);
+            const bs_vec filter3_3 = f_b_bs(state[-2 + 31].v, state[-2 + 32].v, state[-2 + 34].v, state[-2 + 36].v);
+            const bs_vec filter4_0 = f_a_bs(state[-2 + 6].v, state[-2 + 7].v, state[-2 + 9].v, state[-2 + 10].v);
+            const bs_vec filter4_1 = f_b_bs(state[-2 + 12].v, state[-2 + 16].v, state[-2 + 18].v, state[-2 + 19].v);
+            const bs_vec filter4_2 = f_b_bs(state[-2 + 21].v, state[-2 + 25].v, state[-2 + 27].v, state[-2 + 30].v);
+            const bs_vec filter7_0 = f_a_bs(state[-2 + 9].v, state[-2 + 10].v, state[-2 + 12].v, state[-2 + 13].v);
+            const bs_vec filter7_1 = f_b_bs(state[-2 + 15].v, state[-2 + 19].v, state[-2 + 21].v, state[-2 + 22].v);
+            const bs_vec filter8_2 = f_b_bs(state[-2 + 25].v, state[-2 + 29].v, state[-2 + 31].v, state[-2 + 34].v);
+            const bs_vec filter10_1 = f_b_bs(state[-2 + 18].v, state[-2 + 22].v, state[-2 + 24].v, state[-2 + 25].v);
+            const bs_vec filter10_2 = f_b_bs(state[-2 + 27].v, state[-2 + 31].v, state[-2 + 33].v, state[-2 + 36].v);
+            const bs_vec filter11_1 = f_b_bs(state[-2 + 19].v, state[-2 + 23].v, state[-2 + 25].v, state[-2 + 26].v);
+
+            for (uint8_t i3 = 0; i3 < (1 << bits[3]); i3++) {
+                state[-2 + 11].v = bs_fill(i3 & 0x1);
+                state[-2 + 20].v = bs_fill(i3 & 0x2);
+                state[-2 + 37].v = bs_fill(i3 & 0x4);
+                // 0xff07ffffffff
+                const bs_vec filter3_1 = f_b_bs(state[-2 + 11].v, state[-2 + 15].v, state[-2 + 17].v, state[-2 + 18].v);
+                const bs_vec filter3_2 = f_b_bs(state[-2 + 20].v, state[-2 + 24].v, state[-2 + 26].v, state[-2 + 29].v);
+                const bs_vec filter3_4 = f_a_bs(state[-2 + 37].v, state[-2 + 46].v, state[-2 + 47].v, state[-2 + 49].v);
+                const bs_vec filter3 = f_c_bs(filter3_0, filter3_1, filter3_2, filter3_3, filter3_4);
+                bs_slice results3;
+                results3.v = results2.v & (filter3 ^ keystream[3].v);
+
+                if (!bs_any(results3.v)) {
+                    continue;
+                }
+
+                state[-2 + 51].v = lfsr_bs(3);
+                state[-2 + 52].v = lfsr_bs(4);
+                state[-2 + 53].v = lfsr_bs(5);
+                state[-2 + 54].v = lfsr_bs(6);
+                state[-2 + 55].v = lfsr_bs(7);
+                const bs_vec filter4_3 = f_b_bs(state[-2 + 32].v, state[-2 + 33].v, state[-2 + 35].v, state[-2 + 37].v);
+                const bs_vec filter5_0 = f_a_bs(state[-2 + 7].v, state[-2 + 8].v, state[-2 + 10].v, state[-2 + 11].v);
+                const bs_vec filter5_1 = f_b_bs(state[-2 + 13].v, state[-2 + 17].v, state[-2 + 19].v, state[-2 + 20].v);
+                const bs_vec filter6_0 = f_a_bs(state[-2 + 8].v, state[-2 + 9].v, state[-2 + 11].v, state[-2 + 12].v);
+                const bs_vec filter6_1 = f_b_bs(state[-2 + 14].v, state[-2 + 18].v, state[-2 + 20].v, state[-2 + 21].v);
+                const bs_vec filter8_0 = f_a_bs(state[-2 + 10].v, state[-2 + 11].v, state[-2 + 13].v, state[-2 + 14].v);
+                const bs_vec filter8_1 = f_b_bs(state[-2 + 16].v, state[-2 + 20].v, state[-2 + 22].v, state[-2 + 23].v);
+                const bs_vec filter9_0 = f_a_bs(state[-2 + 11].v, state[-2 + 12].v, state[-2 + 14].v, state[-2 + 15].v);
+                const bs_vec filter9_4 = f_a_bs(state[-2 + 43].v, state[-2 + 52].v, state[-2 + 53].v, state[-2 + 55].v);
+                const bs_vec filter11_2 = f_b_bs(state[-2 + 28].v, state[-2 + 32].v, state[-2 + 34].v, state[-2 + 37].v);
+                const bs_vec filter12_1 = f_b_bs(state[-2 + 20].v, state[-2 + 24].v, state[-2 + 26].v, state[-2 + 27].v);
+
+                for (uint8_t i4 = 0; i4 < (1 << bits[4]); i4++) {
+                    state[-2 + 38].v = bs_fill(i4 & 0x1);
+                    // 0xff87ffffffff
+                    const bs_vec filter4_4 = f_a_bs(state[-2 + 38].v, state[-2 + 47].v, state[-2 + 48].v, state[-2 + 50].v);
+                    const bs_vec filter4 = f_c_bs(filter4_0, filter4_1, filter4_2, filter4_3, filter4_4);
+                    bs_slice results4;
+                    results4.v = results3.v & (filter4 ^ keystream[4].v);
+                    if (!bs_any(results4.v)) {
+                        continue;
+                    }
+
+                    state[-2 + 56].v = lfsr_bs(8);
+                    const bs_vec filter5_3 = f_b_bs(state[-2 + 33].v, state[-2 + 34].v, state[-2 + 36].v, state[-2 + 38].v);
+                    const bs_vec filter10_4 = f_a_bs(state[-2 + 44].v, state[-2 + 53].v, state[-2 + 54].v, state[-2 + 56].v);
+                    const bs_vec filter12_2 = f_b_bs(state[-2 + 29].v, state[-2 + 33].v, state[-2 + 35].v, state[-2 + 38].v);
+
+                    for (uint8_t i5 = 0; i5 < (1 << bits[5]); i5++) {
+                        state[-2 + 39].v = bs_fill(i5 & 0x1);
+                        // 0xffc7ffffffff
+                        const bs_vec filter5_4 = f_a_bs(state[-2 + 39].v, state[-2 + 48].v, state[-2 + 49].v, state[-2 + 51].v);
+                        const bs_vec filter5 = f_c_bs(filter5_0, filter5_1, filter5_2, filter5_3, filter5_4);
+                        bs_slice results5;
+                        results5.v = results4.v & (filter5 ^ keystream[5].v);
+
+                        if (!bs_any(results5.v)) {
+                            continue;
+                        }
+
+                        state[-2 + 57].v = lfsr_bs(9);
+                        const bs_vec filter6_3 = f_b_bs(state[-2 + 34].v, state[-2 + 35].v, state[-2 + 37].v, state[-2 + 39].v);
+                        const bs_vec filter11_4 = f_a_bs(state[-2 + 45].v, state[-2 + 54].v, state[-2 + 55].v, state[-2 + 57].v);
+                        for (uint8_t i6 = 0; i6 < (1 << bits[6]); i6++) {
+                            state[-2 + 40].v = bs_fill(i6 & 0x1);
+                            // 0xffe7ffffffff
+                            const bs_vec filter6_4 = f_a_bs(state[-2 + 40].v, state[-2 + 49].v, state[-2 + 50].v, state[-2 + 52].v);
+                            const bs_vec filter6 = f_c_bs(filter6_0, filter6_1, filter6_2, filter6_3, filter6_4);
+                            bs_slice results6;
+                            results6.v = results5.v & (filter6 ^ keystream[6].v);
+
+                            if (!bs_any(results6.v)) {
+                                continue;
+                            }
+
+                            state[-2 + 58].v = lfsr_bs(10);
+                            const bs_vec filter7_3 = f_b_bs(state[-2 + 35].v, state[-2 + 36].v, state[-2 + 38].v, state[-2 + 40].v);
+                            const bs_vec filter12_4 = f_a_bs(state[-2 + 46].v, state[-2 + 55].v, state[-2 + 56].v, state[-2 + 58].v);
+                            for (uint8_t i7 = 0; i7 < (1 << bits[7]); i7++) {
+                                state[-2 + 41].v = bs_fill(i7 & 0x1);
+                                // 0xfff7ffffffff
+                                const bs_vec filter7_4 = f_a_bs(state[-2 + 41].v, state[-2 + 50].v, state[-2 + 51].v, state[-2 + 53].v);
+                                const bs_vec filter7 = f_c_bs(filter7_0, filter7_1, filter7_2, filter7_3, filter7_4);
+                                bs_slice results7;
+                                results7.v = results6.v & (filter7 ^ keystream[7].v);
+                                if (!bs_any(results7.v)) {
+                                    continue;
+                                }
+
+                                state[-2 + 59].v = lfsr_bs(11);
+                                const bs_vec filter8_3 = f_b_bs(state[-2 + 36].v, state[-2 + 37].v, state[-2 + 39].v, state[-2 + 41].v);
+                                const bs_vec filter10_3 = f_b_bs(state[-2 + 38].v, state[-2 + 39].v, state[-2 + 41].v, state[-2 + 43].v);
+                                const bs_vec filter12_3 = f_b_bs(state[-2 + 40].v, state[-2 + 41].v, state[-2 + 43].v, state[-2 + 45].v);
+                                for (uint8_t i8 = 0; i8 < (1 << bits[8]); i8++) {
+                                    state[-2 + 42].v = bs_fill(i8 & 0x1);
+                                    // 0xffffffffffff
+                                    const bs_vec filter8_4 = f_a_bs(state[-2 + 42].v, state[-2 + 51].v, state[-2 + 52].v, state[-2 + 54].v);
+                                    const bs_vec filter8 = f_c_bs(filter8_0, filter8_1, filter8_2, filter8_3, filter8_4);
+                                    bs_slice results8;
+                                    results8.v = results7.v & (filter8 ^ keystream[8].v);
+
+                                    if (!bs_any(results8.v)) {
+                                        continue;
+                                    }
+
+                                    const bs_vec filter9_3 = f_b_bs(state[-2 + 37].v, state[-2 + 38].v, state[-2 + 40].v, state[-2 + 42].v);
+                                    const bs_vec filter9 = f_c_bs(filter9_0, filter9_1, filter9_2, filter9_3, filter9_4);
+                                    results8.v &= (filter9 ^ keystream[9].v);
+
+                                    if (!bs_any(results8.v)) {
+                                        continue;
+                                    }
+
+                                    const bs_vec filter10 = f_c_bs(filter10_0, filter10_1, filter10_2, filter10_3, filter10_4);
+                                    results8.v &= (filter10 ^ keystream[10].v);
+
+                                    if (!bs_any(results8.v)) {
+                                        continue;
+                                    }
+
+                                    const bs_vec filter11_3 = f_b_bs(state[-2 + 39].v, state[-2 + 40].v, state[-2 + 42].v, state[-2 + 44].v);
+                                    const bs_vec filter11 = f_c_bs(filter11_0, filter11_1, filter11_2, filter11_3, filter11_4);
+                                    results8.v &= (filter11 ^ keystream[11].v);
+
+                                    if (!bs_any(results8.v)) {
+                                        continue;
+                                    }
+
+                                    const bs_vec filter12 = f_c_bs(filter12_0, filter12_1, filter12_2, filter12_3, filter12_4);
+                                    results8.v &= (filter12 ^ keystream[12].v);
+
+                                    if (!bs_any(results8.v)) {
+                                        continue;
+                                    }
+
+                                    const bs_vec filter13_0 = f_a_bs(state[-2 + 15].v, state[-2 + 16].v, state[-2 + 18].v, state[-2 + 19].v);
+                                    const bs_vec filter13_1 = f_b_bs(state[-2 + 21].v, state[-2 + 25].v, state[-2 + 27].v, state[-2 + 28].v);
+                                    const bs_vec filter13_2 = f_b_bs(state[-2 + 30].v, state[-2 + 34].v, state[-2 + 36].v, state[-2 + 39].v);
+                                    const bs_vec filter13_3 = f_b_bs(state[-2 + 41].v, state[-2 + 42].v, state[-2 + 44].v, state[-2 + 46].v);
+                                    const bs_vec filter13_4 = f_a_bs(state[-2 + 47].v, state[-2 + 56].v, state[-2 + 57].v, state[-2 + 59].v);
+                                    const bs_vec filter13 = f_c_bs(filter13_0, filter13_1, filter13_2, filter13_3, filter13_4);
+                                    results8.v &= (filter13 ^ keystream[13].v);
+
+                                    if (!bs_any(results8.v)) {
+                                        continue;
+                                    }
+
+                                    state[-2 + 60].v = lfsr_bs(12);
+                                    const bs_vec filter14_0 = f_a_bs(state[-2 + 16].v, state[-2 + 17].v, state[-2 + 19].v, state[-2 + 20].v);
+                                    const bs_vec filter14_1 = f_b_bs(state[-2 + 22].v, state[-2 + 26].v, state[-2 + 28].v, state[-2 + 29].v);
+                                    const bs_vec filter14_2 = f_b_bs(state[-2 + 31].v, state[-2 + 35].v, state[-2 + 37].v, state[-2 + 40].v);
+                                    const bs_vec filter14_3 = f_b_bs(state[-2 + 42].v, state[-2 + 43].v, state[-2 + 45].v, state[-2 + 47].v);
+                                    const bs_vec filter14_4 = f_a_bs(state[-2 + 48].v, state[-2 + 57].v, state[-2 + 58].v, state[-2 + 60].v);
+                                    const bs_vec filter14 = f_c_bs(filter14_0, filter14_1, filter14_2, filter14_3, filter14_4);
+                                    results8.v &= (filter14 ^ keystream[14].v);
+
+                                    if (!bs_any(results8.v)) {
+                                        continue;
+                                    }
+
+                                    state[-2 + 61].v = lfsr_bs(13);
+                                    const bs_vec filter15_0 = f_a_bs(state[-2 + 17].v, state[-2 + 18].v, state[-2 + 20].v, state[-2 + 21].v);
+                                    const bs_vec filter15_1 = f_b_bs(state[-2 + 23].v, state[-2 + 27].v, state[-2 + 29].v, state[-2 + 30].v);
+                                    const bs_vec filter15_2 = f_b_bs(state[-2 + 32].v, state[-2 + 36].v, state[-2 + 38].v, state[-2 + 41].v);
+                                    const bs_vec filter15_3 = f_b_bs(state[-2 + 43].v, state[-2 + 44].v, state[-2 + 46].v, state[-2 + 48].v);
+                                    const bs_vec filter15_4 = f_a_bs(state[-2 + 49].v, state[-2 + 58].v, state[-2 + 59].v, state[-2 + 61].v);
+                                    const bs_vec filter15 = f_c_bs(filter15_0, filter15_1, filter15_2, filter15_3, filter15_4);
+                                    results8.v &= (filter15 ^ keystream[15].v);
+
+                                    if (!bs_any(results8.v)) {
+                                        continue;
+                                    }
+
+                                    state[-2 + 62].v = lfsr_bs(14);
+                                    const bs_vec filter16_0 = f_a_bs(state[-2 + 18].v, state[-2 + 19].v, state[-2 + 21].v, state[-2 + 22].v);
+                                    const bs_vec filter16_1 = f_b_bs(state[-2 + 24].v, state[-2 + 28].v, state[-2 + 30].v, state[-2 + 31].v);
+                                    const bs_vec filter16_2 = f_b_bs(state[-2 + 33].v, state[-2 + 37].v, state[-2 + 39].v, state[-2 + 42].v);
+                                    const bs_vec filter16_3 = f_b_bs(state[-2 + 44].v, state[-2 + 45].v, state[-2 + 47].v, state[-2 + 49].v);
+                                    const bs_vec filter16_4 = f_a_bs(state[-2 + 50].v, state[-2 + 59].v, state[-2 + 60].v, state[-2 + 62].v);
+                                    const bs_vec filter16 = f_c_bs(filter16_0, filter16_1, filter16_2, filter16_3, filter16_4);
+                                    results8.v &= (filter16 ^ keystream[16].v);
+
+                                    if (!bs_any(results8.v)) {
+                                        continue;
+                                    }
+
+                                    state[-2 + 63].v = lfsr_bs(15);
+                                    const bs_vec filter17_0 = f_a_bs(state[-2 + 19].v, state[-2 + 20].v, state[-2 + 22].v, state[-2 + 23].v);
+                                    const bs_vec filter17_1 = f_b_bs(state[-2 + 25].v, state[-2 + 29].v, state[-2 + 31].v, state[-2 + 32].v);
+                                    const bs_vec filter17_2 = f_b_bs(state[-2 + 34].v, state[-2 + 38].v, state[-2 + 40].v, state[-2 + 43].v);
+                                    const bs_vec filter17_3 = f_b_bs(state[-2 + 45].v, state[-2 + 46].v, state[-2 + 48].v, state[-2 + 50].v);
+                                    const bs_vec filter17_4 = f_a_bs(state[-2 + 51].v, state[-2 + 60].v, state[-2 + 61].v, state[-2 + 63].v);
+                                    const bs_vec filter17 = f_c_bs(filter17_0, filter17_1, filter17_2, filter17_3, filter17_4);
+                                    results8.v &= (filter17 ^ keystream[17].v);
+
+                                    if (!bs_any(results8.v)) {
+                                        continue;
+                                    }
+
+                                    state[-2 + 64].v = lfsr_bs(16);
+                                    const bs_vec filter18_0 = f_a_bs(state[-2 + 20].v, state[-2 + 21].v, state[-2 + 23].v, state[-2 + 24].v);
+                                    const bs_vec filter18_1 = f_b_bs(state[-2 + 26].v, state[-2 + 30].v, state[-2 + 32].v, state[-2 + 33].v);
+                                    const bs_vec filter18_2 = f_b_bs(state[-2 + 35].v, state[-2 + 39].v, state[-2 + 41].v, state[-2 + 44].v);
+                                    const bs_vec filter18_3 = f_b_bs(state[-2 + 46].v, state[-2 + 47].v, state[-2 + 49].v, state[-2 + 51].v);
+                                    const bs_vec filter18_4 = f_a_bs(state[-2 + 52].v, state[-2 + 61].v, state[-2 + 62].v, state[-2 + 64].v);
+                                    const bs_vec filter18 = f_c_bs(filter18_0, filter18_1, filter18_2, filter18_3, filter18_4);
+                                    results8.v &= (filter18 ^ keystream[18].v);
+
+                                    if (!bs_any(results8.v)) {
+                                        continue;
+                                    }
+
+                                    state[-2 + 65].v = lfsr_bs(17);
+                                    const bs_vec filter19_0 = f_a_bs(state[-2 + 21].v, state[-2 + 22].v, state[-2 + 24].v, state[-2 + 25].v);
+                                    const bs_vec filter19_1 = f_b_bs(state[-2 + 27].v, state[-2 + 31].v, state[-2 + 33].v, state[-2 + 34].v);
+                                    const bs_vec filter19_2 = f_b_bs(state[-2 + 36].v, state[-2 + 40].v, state[-2 + 42].v, state[-2 + 45].v);
+                                    const bs_vec filter19_3 = f_b_bs(state[-2 + 47].v, state[-2 + 48].v, state[-2 + 50].v, state[-2 + 52].v);
+                                    const bs_vec filter19_4 = f_a_bs(state[-2 + 53].v, state[-2 + 62].v, state[-2 + 63].v, state[-2 + 65].v);
+                                    const bs_vec filter19 = f_c_bs(filter19_0, filter19_1, filter19_2, filter19_3, filter19_4);
+                                    results8.v &= (filter19 ^ keystream[19].v);
+
+                                    if (!bs_any(results8.v)) {
+                                        continue;
+                                    }
+
+                                    state[-2 + 66].v = lfsr_bs(18);
+                                    const bs_vec filter20_0 = f_a_bs(state[-2 + 22].v, state[-2 + 23].v, state[-2 + 25].v, state[-2 + 26].v);
+                                    const bs_vec filter20_1 = f_b_bs(state[-2 + 28].v, state[-2 + 32].v, state[-2 + 34].v, state[-2 + 35].v);
+                                    const bs_vec filter20_2 = f_b_bs(state[-2 + 37].v, state[-2 + 41].v, state[-2 + 43].v, state[-2 + 46].v);
+                                    const bs_vec filter20_3 = f_b_bs(state[-2 + 48].v, state[-2 + 49].v, state[-2 + 51].v, state[-2 + 53].v);
+                                    const bs_vec filter20_4 = f_a_bs(state[-2 + 54].v, state[-2 + 63].v, state[-2 + 64].v, state[-2 + 66].v);
+                                    const bs_vec filter20 = f_c_bs(filter20_0, filter20_1, filter20_2, filter20_3, filter20_4);
+                                    results8.v &= (filter20 ^ keystream[20].v);
+
+                                    if (!bs_any(results8.v)) {
+                                        continue;
+                                    }
+
+                                    state[-2 + 67].v = lfsr_bs(19);
+                                    const bs_vec filter21_0 = f_a_bs(state[-2 + 23].v, state[-2 + 24].v, state[-2 + 26].v, state[-2 + 27].v);
+                                    const bs_vec filter21_1 = f_b_bs(state[-2 + 29].v, state[-2 + 33].v, state[-2 + 35].v, state[-2 + 36].v);
+                                    const bs_vec filter21_2 = f_b_bs(state[-2 + 38].v, state[-2 + 42].v, state[-2 + 44].v, state[-2 + 47].v);
+                                    const bs_vec filter21_3 = f_b_bs(state[-2 + 49].v, state[-2 + 50].v, state[-2 + 52].v, state[-2 + 54].v);
+                                    const bs_vec filter21_4 = f_a_bs(state[-2 + 55].v, state[-2 + 64].v, state[-2 + 65].v, state[-2 + 67].v);
+                                    const bs_vec filter21 = f_c_bs(filter21_0, filter21_1, filter21_2, filter21_3, filter21_4);
+                                    results8.v &= (filter21 ^ keystream[21].v);
+
+                                    if (!bs_any(results8.v)) {
+                                        continue;
+                                    }
+
+                                    state[-2 + 68].v = lfsr_bs(20);
+                                    const bs_vec filter22_0 = f_a_bs(state[-2 + 24].v, state[-2 + 25].v, state[-2 + 27].v, state[-2 + 28].v);
+                                    const bs_vec filter22_1 = f_b_bs(state[-2 + 30].v, state[-2 + 34].v, state[-2 + 36].v, state[-2 + 37].v);
+                                    const bs_vec filter22_2 = f_b_bs(state[-2 + 39].v, state[-2 + 43].v, state[-2 + 45].v, state[-2 + 48].v);
+                                    const bs_vec filter22_3 = f_b_bs(state[-2 + 50].v, state[-2 + 51].v, state[-2 + 53].v, state[-2 + 55].v);
+                                    const bs_vec filter22_4 = f_a_bs(state[-2 + 56].v, state[-2 + 65].v, state[-2 + 66].v, state[-2 + 68].v);
+                                    const bs_vec filter22 = f_c_bs(filter22_0, filter22_1, filter22_2, filter22_3, filter22_4);
+                                    results8.v &= (filter22 ^ keystream[22].v);
+
+                                    if (!bs_any(results8.v)) {
+                                        continue;
+                                    }
+
+                                    state[-2 + 69].v = lfsr_bs(21);
+                                    const bs_vec filter23_0 = f_a_bs(state[-2 + 25].v, state[-2 + 26].v, state[-2 + 28].v, state[-2 + 29].v);
+                                    const bs_vec filter23_1 = f_b_bs(state[-2 + 31].v, state[-2 + 35].v, state[-2 + 37].v, state[-2 + 38].v);
+                                    const bs_vec filter23_2 = f_b_bs(state[-2 + 40].v, state[-2 + 44].v, state[-2 + 46].v, state[-2 + 49].v);
+                                    const bs_vec filter23_3 = f_b_bs(state[-2 + 51].v, state[-2 + 52].v, state[-2 + 54].v, state[-2 + 56].v);
+                                    const bs_vec filter23_4 = f_a_bs(state[-2 + 57].v, state[-2 + 66].v, state[-2 + 67].v, state[-2 + 69].v);
+                                    const bs_vec filter23 = f_c_bs(filter23_0, filter23_1, filter23_2, filter23_3, filter23_4);
+                                    results8.v &= (filter23 ^ keystream[23].v);
+                                    if (!bs_any(results8.v)) {
+                                        continue;
+                                    }
+                                    state[-2 + 70].v = lfsr_bs(22);
+                                    const bs_vec filter24_0 = f_a_bs(state[-2 + 26].v, state[-2 + 27].v, state[-2 + 29].v, state[-2 + 30].v);
+                                    const bs_vec filter24_1 = f_b_bs(state[-2 + 32].v, state[-2 + 36].v, state[-2 + 38].v, state[-2 + 39].v);
+                                    const bs_vec filter24_2 = f_b_bs(state[-2 + 41].v, state[-2 + 45].v, state[-2 + 47].v, state[-2 + 50].v);
+                                    const bs_vec filter24_3 = f_b_bs(state[-2 + 52].v, state[-2 + 53].v, state[-2 + 55].v, state[-2 + 57].v);
+                                    const bs_vec filter24_4 = f_a_bs(state[-2 + 58].v, state[-2 + 67].v, state[-2 + 68].v, state[-2 + 70].v);
+                                    const bs_vec filter24 = f_c_bs(filter24_0, filter24_1, filter24_2, filter24_3, filter24_4);
+                                    results8.v &= (filter24 ^ keystream[24].v);
+                                    if (!bs_any(results8.v)) {
+                                        continue;
+                                    }
+                                    state[-2 + 71].v = lfsr_bs(23);
+                                    const bs_vec filter25_0 = f_a_bs(state[-2 + 27].v, state[-2 + 28].v, state[-2 + 30].v, state[-2 + 31].v);
+                                    const bs_vec filter25_1 = f_b_bs(state[-2 + 33].v, state[-2 + 37].v, state[-2 + 39].v, state[-2 + 40].v);
+                                    const bs_vec filter25_2 = f_b_bs(state[-2 + 42].v, state[-2 + 46].v, state[-2 + 48].v, state[-2 + 51].v);
+                                    const bs_vec filter25_3 = f_b_bs(state[-2 + 53].v, state[-2 + 54].v, state[-2 + 56].v, state[-2 + 58].v);
+                                    const bs_vec filter25_4 = f_a_bs(state[-2 + 59].v, state[-2 + 68].v, state[-2 + 69].v, state[-2 + 71].v);
+                                    const bs_vec filter25 = f_c_bs(filter25_0, filter25_1, filter25_2, filter25_3, filter25_4);
+                                    results8.v &= (filter25 ^ keystream[25].v);
+
+                                    if (!bs_any(results8.v)) {
+                                        continue;
+                                    }
+
+                                    state[-2 + 72].v = lfsr_bs(24);
+                                    const bs_vec filter26_0 = f_a_bs(state[-2 + 28].v, state[-2 + 29].v, state[-2 + 31].v, state[-2 + 32].v);
+                                    const bs_vec filter26_1 = f_b_bs(state[-2 + 34].v, state[-2 + 38].v, state[-2 + 40].v, state[-2 + 41].v);
+                                    const bs_vec filter26_2 = f_b_bs(state[-2 + 43].v, state[-2 + 47].v, state[-2 + 49].v, state[-2 + 52].v);
+                                    const bs_vec filter26_3 = f_b_bs(state[-2 + 54].v, state[-2 + 55].v, state[-2 + 57].v, state[-2 + 59].v);
+                                    const bs_vec filter26_4 = f_a_bs(state[-2 + 60].v, state[-2 + 69].v, state[-2 + 70].v, state[-2 + 72].v);
+                                    const bs_vec filter26 = f_c_bs(filter26_0, filter26_1, filter26_2, filter26_3, filter26_4);
+                                    results8.v &= (filter26 ^ keystream[26].v);
+
+                                    if (!bs_any(results8.v)) {
+                                        continue;
+                                    }
+
+                                    state[-2 + 73].v = lfsr_bs(25);
+                                    const bs_vec filter27_0 = f_a_bs(state[-2 + 29].v, state[-2 + 30].v, state[-2 + 32].v, state[-2 + 33].v);
+                                    const bs_vec filter27_1 = f_b_bs(state[-2 + 35].v, state[-2 + 39].v, state[-2 + 41].v, state[-2 + 42].v);
+                                    const bs_vec filter27_2 = f_b_bs(state[-2 + 44].v, state[-2 + 48].v, state[-2 + 50].v, state[-2 + 53].v);
+                                    const bs_vec filter27_3 = f_b_bs(state[-2 + 55].v, state[-2 + 56].v, state[-2 + 58].v, state[-2 + 60].v);
+                                    const bs_vec filter27_4 = f_a_bs(state[-2 + 61].v, state[-2 + 70].v, state[-2 + 71].v, state[-2 + 73].v);
+                                    const bs_vec filter27 = f_c_bs(filter27_0, filter27_1, filter27_2, filter27_3, filter27_4);
+                                    results8.v &= (filter27 ^ keystream[27].v);
+
+                                    if (!bs_any(results8.v)) {
+                                        continue;
+                                    }
+
+                                    state[-2 + 74].v = lfsr_bs(26);
+                                    const bs_vec filter28_0 = f_a_bs(state[-2 + 30].v, state[-2 + 31].v, state[-2 + 33].v, state[-2 + 34].v);
+                                    const bs_vec filter28_1 = f_b_bs(state[-2 + 36].v, state[-2 + 40].v, state[-2 + 42].v, state[-2 + 43].v);
+                                    const bs_vec filter28_2 = f_b_bs(state[-2 + 45].v, state[-2 + 49].v, state[-2 + 51].v, state[-2 + 54].v);
+                                    const bs_vec filter28_3 = f_b_bs(state[-2 + 56].v, state[-2 + 57].v, state[-2 + 59].v, state[-2 + 61].v);
+                                    const bs_vec filter28_4 = f_a_bs(state[-2 + 62].v, state[-2 + 71].v, state[-2 + 72].v, state[-2 + 74].v);
+                                    const bs_vec filter28 = f_c_bs(filter28_0, filter28_1, filter28_2, filter28_3, filter28_4);
+                                    results8.v &= (filter28 ^ keystream[28].v);
+
+                                    if (!bs_any(results8.v)) {
+                                        continue;
+                                    }
+
+                                    state[-2 + 75].v = lfsr_bs(27);
+                                    const bs_vec filter29_0 = f_a_bs(state[-2 + 31].v, state[-2 + 32].v, state[-2 + 34].v, state[-2 + 35].v);
+                                    const bs_vec filter29_1 = f_b_bs(state[-2 + 37].v, state[-2 + 41].v, state[-2 + 43].v, state[-2 + 44].v);
+                                    const bs_vec filter29_2 = f_b_bs(state[-2 + 46].v, state[-2 + 50].v, state[-2 + 52].v, state[-2 + 55].v);
+                                    const bs_vec filter29_3 = f_b_bs(state[-2 + 57].v, state[-2 + 58].v, state[-2 + 60].v, state[-2 + 62].v);
+                                    const bs_vec filter29_4 = f_a_bs(state[-2 + 63].v, state[-2 + 72].v, state[-2 + 73].v, state[-2 + 75].v);
+                                    const bs_vec filter29 = f_c_bs(filter29_0, filter29_1, filter29_2, filter29_3, filter29_4);
+                                    results8.v &= (filter29 ^ keystream[29].v);
+
+                                    if (!bs_any(results8.v)) {
+                                        continue;
+                                    }
+
+                                    state[-2 + 76].v = lfsr_bs(28);
+                                    const bs_vec filter30_0 = f_a_bs(state[-2 + 32].v, state[-2 + 33].v, state[-2 + 35].v, state[-2 + 36].v);
+                                    const bs_vec filter30_1 = f_b_bs(state[-2 + 38].v, state[-2 + 42].v, state[-2 + 44].v, state[-2 + 45].v);
+                                    const bs_vec filter30_2 = f_b_bs(state[-2 + 47].v, state[-2 + 51].v, state[-2 + 53].v, state[-2 + 56].v);
+                                    const bs_vec filter30_3 = f_b_bs(state[-2 + 58].v, state[-2 + 59].v, state[-2 + 61].v, state[-2 + 63].v);
+                                    const bs_vec filter30_4 = f_a_bs(state[-2 + 64].v, state[-2 + 73].v, state[-2 + 74].v, state[-2 + 76].v);
+                                    const bs_vec filter30 = f_c_bs(filter30_0, filter30_1, filter30_2, filter30_3, filter30_4);
+                                    results8.v &= (filter30 ^ keystream[30].v);
+
+                                    if (!bs_any(results8.v)) {
+                                        continue;
+                                    }
+
+                                    state[-2 + 77].v = lfsr_bs(29);
+                                    const bs_vec filter31_0 = f_a_bs(state[-2 + 33].v, state[-2 + 34].v, state[-2 + 36].v, state[-2 + 37].v);
+                                    const bs_vec filter31_1 = f_b_bs(state[-2 + 39].v, state[-2 + 43].v, state[-2 + 45].v, state[-2 + 46].v);
+                                    const bs_vec filter31_2 = f_b_bs(state[-2 + 48].v, state[-2 + 52].v, state[-2 + 54].v, state[-2 + 57].v);
+                                    const bs_vec filter31_3 = f_b_bs(state[-2 + 59].v, state[-2 + 60].v, state[-2 + 62].v, state[-2 + 64].v);
+                                    const bs_vec filter31_4 = f_a_bs(state[-2 + 65].v, state[-2 + 74].v, state[-2 + 75].v, state[-2 + 77].v);
+                                    const bs_vec filter31 = f_c_bs(filter31_0, filter31_1, filter31_2, filter31_3, filter31_4);
+                                    results8.v &= (filter31 ^ keystream[31].v);
+
+                                    if (!bs_any(results8.v)) {
+                                        continue;
+                                    }
+
+                                    for (uint32_t r = 0; r < BS_BITS; r++) {
+                                        if (!bs_lane(&results8, r)) continue;
+                                        // take the state from layer 2 so we can recover the lowest 2 bits by inverting the LFSR
+                                        uint64_t state31 = BS_FN(unbitslice)(&state[-2 + 2], r, 48);
+                                        state31 = lfsr_inv(state31);
+                                        state31 = lfsr_inv(state31);
+                                        try_state(state31 & ((1ull << 48) - 1));
+                                    }
+                                } // 8
+                            } // 7
+                        } // 6
+                    } // 5
+                } // 4
+            } // 3
+        } // 2
+    } // 1
+}
@@ -0,0 +1,326 @@
+//-----------------------------------------------------------------------------
+// Copyright (C) Proxmark3 contributors. See AUTHORS.md for details.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// See LICENSE.txt for the text of the license.
+//-----------------------------------------------------------------------------
+// Micro benchmark of the LF demod sample primitives (common/lfdemod_simd.c).
+// Runs the plain C and the vector version of every primitive over recorded
+// .pm3 captures,  or synthetic ones when none are given,  checks they agree
+// and reports samples per second.
+//-----------------------------------------------------------------------------
+#define _DEFAULT_SOURCE
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include <errno.h>
+#include <time.h>
+#include <getopt.h>
+
+#include "common.h"
+#include "commonutil.h"  // ARRAYLEN
+#include "lfdemod_simd.h"
+
+// largest capture the client graph buffer holds
+#define MAX_SAMPLES    (40000 * 8)
+
+// every run returns a digest of its result,  scalar and vector runs must match
+static uint64_t run_minmax(const uint8_t *s, size_t n, uint8_t *scratch, bool vec) {
+    (void) scratch;
+    uint8_t lo, hi;
+    if (vec)
+        lf_minmax(s, n, &lo, &hi);
+    else
+        lf_minmax_scalar(s, n, &lo, &hi);
+    return ((uint64_t)lo << 8) | hi;
+}
+
+static uint64_t run_sum_range(const uint8_t *s, size_t n, uint8_t *scratch, bool vec) {
+    (void) scratch;
+    uint32_t cnt, sum;
+    if (vec)
+        sum = lf_sum_range(s, n, 100, 160, &cnt);
+    else
+        sum = lf_sum_range_scalar(s, n, 100, 160, &cnt);
+    return ((uint64_t)cnt << 32) | sum;
+}
+
+static uint64_t digest(const uint8_t *b, size_t n) {
+    uint64_t h = 14695981039346656037ULL;
+    for (size_t i = 0; i < n; i++)
+        h = (h ^ b[i]) * 1099511628211ULL;
+    return h;
+}
+
+// in place primitives work on a copy,  the copy is part of both timings
+static uint64_t run_shift(const uint8_t *s, size_t n, uint8_t *scratch, bool vec) {
+    memcpy(scratch, s, n);
+    if (vec)
+        lf_shift(scratch, n, -20);
+    else
+        lf_shift_scalar(scratch, n, -20);
+    return scratch[n / 2];
+}
+
+static uint64_t run_threshold(const uint8_t *s, size_t n, uint8_t *scratch, bool vec) {
+    memcpy(scratch, s, n);
+    if (vec)
+        lf_threshold(scratch, n, 128);
+    else
+        lf_threshold_scalar(scratch, n, 128);
+    return scratch[n / 2];
+}
+
+static uint64_t run_peak_mask(const uint8_t *s, size_t n, uint8_t *scratch, bool vec) {
+    if (vec)
+        lf_peak_mask(s, n, 170, 86, scratch);
+    else
+        lf_peak_mask_scalar(s, n, 170, 86, scratch);
+    return scratch[n / 2];
+}
+
+// high / low edge walk as in loadWaveCounters()
+static uint64_t run_find_edges(const uint8_t *s, size_t n, uint8_t *scratch, bool vec) {
+    (void) scratch;
+    uint64_t edges = 0, sum = 0;
+    size_t i = 0;
+    while (i < n) {
+        i = (vec) ? lf_find_ge(s, i, n, 170) : lf_find_ge_scalar(s, i, n, 170);
+        i = (vec) ? lf_find_le(s, i, n, 86) : lf_find_le_scalar(s, i, n, 86);
+        sum += i;
+        edges++;
+    }
+    return (edges << 40) ^ sum;
+}
+
+// field clock walk as in countFC()
+static uint64_t run_find_peak(const uint8_t *s, size_t n, uint8_t *scratch, bool vec) {
+    (void) scratch;
+    uint64_t peaks = 0, sum = 0;
+    for (size_t i = 1; i < n - 1; i++) {
+        i = (vec) ? lf_find_peak(s, i, n - 1) : lf_find_peak_scalar(s, i, n - 1);
+        sum += i;
+        peaks++;
+    }
+    return (peaks << 40) ^ sum;
+}
+
+// transition walk as in fsk_wave_demod(),  over thresholded samples
+static uint64_t run_find_rise(const uint8_t *s, size_t n, uint8_t *scratch, bool vec) {
+    memcpy(scratch, s, n);
+    lf_threshold_scalar(scratch, n, 128);
+    uint64_t rises = 0, sum = 0;
+    for (size_t i = 1; i < n; i++) {
+        i = (vec) ? lf_find_rise(scratch, i, n) : lf_find_rise_scalar(scratch, i, n);
+        sum += i;
+        rises++;
+    }
+    return (rises << 40) ^ sum;
+}
+
+typedef struct {
+    const char *name;
+    uint64_t (*run)(const uint8_t *s, size_t n, uint8_t *scratch, bool vec);
+    bool scratch_result;   // scratch holds the result,  compare it too
+} primitive_t;
+
+static const primitive_t primitives[] = {
+    {"minmax",     run_minmax,     false},
+    {"sum_range",  run_sum_range,  false},
+    {"shift",      run_shift,      true},
+    {"threshold",  run_threshold,  true},
+    {"peak_mask",  run_peak_mask,  true},
+    {"find_le/ge", run_find_edges, false},
+    {"find_peak",  run_find_peak,  false},
+    {"find_rise",  run_find_rise,  false},
+};
+
+static double now_sec(void) {
+    struct timespec t;
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return t.tv_sec + (t.tv_nsec / 1e9);
+}
+
+// samples per second of one variant,  run for at least min_time seconds
+static double measure(const primitive_t *p, const uint8_t *s, size_t n, uint8_t *scratch, bool vec, double min_time) {
+    uint64_t runs = 0;
+    volatile uint64_t sink = 0;
+    double start = now_sec(), elapsed;
+    do {
+        for (int i = 0; i < 16; i++)
+            sink ^= p->run(s, n, scratch, vec);
+        runs += 16;
+        elapsed = now_sec() - start;
+    } while (elapsed < min_time);
+    (void) sink;
+    return (double)runs * n / elapsed;
+}
+
+// .pm3 files hold one graph value per line,  the demods see value + 128
+static size_t load_pm3(const char *fn, uint8_t *dest, size_t maxlen) {
+    FILE *f = fopen(fn, "r");
+    if (f == NULL) {
+        fprintf(stderr, "can't open %s: %s\n", fn, strerror(errno));
+        return 0;
+    }
+
+    size_t n = 0;
+    int v;
+    while (n < maxlen && fscanf(f, "%d", &v) == 1) {
+        dest[n++] = (uint8_t)MAX(0, MIN(255, v + 128));
+    }
+    fclose(f);
+    return n;
+}
+
+static int bench_samples(const char *name, const uint8_t *samples, size_t n, uint8_t *scratch, uint8_t *scratch_vec, double min_time) {
+
+    printf("\n%s  (%zu samples)\n", name, n);
+    printf("  %-12s %14s %14s %8s\n", "primitive", "scalar MS/s", "vector MS/s", "speedup");
+
+    int mismatches = 0;
+    for (size_t i = 0; i < ARRAYLEN(primitives); i++) {
+        const primitive_t *p = &primitives[i];
+
+        bool same = p->run(samples, n, scratch, false) == p->run(samples, n, scratch_vec, true);
+        if (p->scratch_result)
+            same = same && digest(scratch, n) == digest(scratch_vec, n);
+        if (same == false)
+            mismatches++;
+
+        double sc = measure(p, samples, n, scratch, false, min_time);
+        double ve = measure(p, samples, n, scratch, true, min_time);
+        printf("  %-12s %14.1f %14.1f %7.2fx%s\n", p->name, sc / 1e6, ve / 1e6, ve / sc, same ? "" : "  MISMATCH");
+    }
+    return mismatches;
+}
+
+static int bench_file(const char *fn, uint8_t *samples, uint8_t *scratch, uint8_t *scratch_vec, double min_time) {
+    size_t n = load_pm3(fn, samples, MAX_SAMPLES);
+    if (n < 64) {
+        fprintf(stderr, "%s: not enough samples, skipped\n", fn);
+        return 0;
+    }
+    return bench_samples(fn, samples, n, scratch, scratch_vec, min_time);
+}
+
+// xorshift,  synthetic captures are the same on every run
+static uint32_t synth_rand(uint32_t *state) {
+    uint32_t x = *state;
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    return *state = x;
+}
+
+// antenna voltage of a field cycle of fc samples,  amp around the 128 mid level plus some noise
+static uint8_t synth_sample(uint32_t pos, uint8_t fc, int amp, uint32_t *state) {
+    int v = ((pos % fc) < fc / 2) ? amp : -amp;
+    v += (int)(synth_rand(state) % 17) - 8;
+    return (uint8_t)MAX(0, MIN(255, 128 + v));
+}
+
+// FSK2a RF/50,  a one is fc/10 and a zero fc/8,  like HID Prox
+static size_t synth_fsk(uint8_t *dest, size_t n) {
+    uint32_t state = 0x2545f491, bits = 0x1d2a5b3c;
+    for (size_t i = 0; i < n; i++) {
+        if (i % 50 == 0)
+            bits = (bits >> 1) | ((synth_rand(&state) & 1) << 31);
+        dest[i] = synth_sample(i, (bits & 1) ? 10 : 8, 90, &state);
+    }
+    return n;
+}
+
+// ASK manchester RF/64 at fc/8,  the tag damps the field for half a bit,  like EM410x
+static size_t synth_ask(uint8_t *dest, size_t n) {
+    uint32_t state = 0x9e3779b9, bit = 0;
+    for (size_t i = 0; i < n; i++) {
+        if (i % 64 == 0)
+            bit = synth_rand(&state) & 1;
+        bool damped = ((i % 64) < 32) == (bit == 1);
+        dest[i] = synth_sample(i, 8, (damped) ? 30 : 100, &state);
+    }
+    return n;
+}
+
+static const struct {
+    const char *name;
+    size_t (*make)(uint8_t *dest, size_t n);
+} synth_captures[] = {
+    {"synthetic FSK2a RF/50", synth_fsk},
+    {"synthetic ASK RF/64",   synth_ask},
+};
+
+static void usage(const char *name) {
+    printf("Benchmark of the LF demod sample primitives over .pm3 captures\n\n");
+    printf("Usage: %s [options] [file.pm3 ...]\n", name);
+    printf("  -t, --time <ms>     minimum run time per primitive and variant (default: 200)\n");
+    printf("\nWithout files synthetic FSK and ASK captures are used.\n");
+}
+
+int main(int argc, char *argv[]) {
+
+    double min_time = 0.2;
+
+    static const struct option long_opts[] = {
+        {"time",    required_argument, NULL, 't'},
+        {"help",    no_argument,       NULL, 'h'},
+        {NULL, 0, NULL, 0}
+    };
+
+    int c;
+    while ((c = getopt_long(argc, argv, "t:h", long_opts, NULL)) != -1) {
+        switch (c) {
+            case 't':
+                min_time = strtoul(optarg, NULL, 0) / 1000.0;
+                break;
+            default:
+                usage(argv[0]);
+                return (c == 'h') ? 0 : 1;
+        }
+    }
+
+    char **files = argv + optind;
+    size_t nfiles = argc - optind;
+
+    // one spare byte, lf_find_peak() looks one sample ahead
+    uint8_t *samples = calloc(MAX_SAMPLES + 1, sizeof(uint8_t));
+    uint8_t *scratch = calloc(MAX_SAMPLES + 1, sizeof(uint8_t));
+    uint8_t *scratch_vec = calloc(MAX_SAMPLES + 1, sizeof(uint8_t));
+    if (samples == NULL || scratch == NULL || scratch_vec == NULL) {
+        fprintf(stderr, "failed to allocate memory\n");
+        return 1;
+    }
+
+    printf("vector primitives: %s\n", lf_simd_name());
+
+    int mismatches = 0;
+    for (size_t i = 0; i < nfiles; i++) {
+        mismatches += bench_file(files[i], samples, scratch, scratch_vec, min_time);
+    }
+
+    for (size_t i = 0; nfiles == 0 && i < ARRAYLEN(synth_captures); i++) {
+        size_t n = synth_captures[i].make(samples, MAX_SAMPLES);
+        mismatches += bench_samples(synth_captures[i].name, samples, n, scratch, scratch_vec, min_time);
+    }
+
+    if (mismatches)
+        printf("\n%d primitive results differ between scalar and vector\n", mismatches);
+
+    free(samples);
+    free(scratch);
+    free(scratch_vec);
+    return (mismatches) ? 1 : 0;
+}
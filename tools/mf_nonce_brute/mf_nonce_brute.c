@@ -9,6 +9,7 @@
 #include <unistd.h>
 #include <ctype.h>
 #include "crapto1/crapto1.h"
+#include "crapto1/crypto1_bs.h"
 #include "protocol.h"
 #include "iso14443crc.h"
 #include "util_posix.h"
@@ -21,9 +22,6 @@
 
 #define odd_parity(i) (( (i) ^ (i)>>1 ^ (i)>>2 ^ (i)>>3 ^ (i)>>4 ^ (i)>>5 ^ (i)>>6 ^ (i)>>7 ^ 1) & 0x01)
 
-// a global mutex to prevent interlaced printing from different threads
-pthread_mutex_t print_lock;
-
 //--------------------- define options here
 uint32_t uid = 0;     // serial number
 uint32_t nt_enc = 0;  // Encrypted tag nonce
@@ -39,14 +37,11 @@ uint32_t at_par_err = 0;
 typedef struct thread_args {
     uint16_t xored;
     int thread;
-    int idx;
-    bool ev1;
 } targs;
 
 #define ENC_LEN  (200)
 typedef struct thread_key_args {
     int thread;
-    int idx;
     uint32_t uid;
     uint32_t part_key;
     uint32_t nt_enc;
@@ -68,11 +63,21 @@ uint8_t cmds[8][2] = {
     {MIFARE_CMD_TRANSFER, 0}
 };
 
-//static int global_counter = 0;
+// threads claim work in chunks through global_next_chunk.
+// phase 1: first all regular tag nonces, then the EV1 ones.
+// phase 2: one chunk is one bitsliced batch of keys.
+#define NONCE_CHUNK_SIZE  256
+#define NONCE_CHUNKS      (2 * (0x10000 / NONCE_CHUNK_SIZE))
+#define KEY_CHUNKS        (0x10000 / CRYPTO1_BS_WIDTH)
+
+static uint32_t global_next_chunk = 0;
+// set by the first thread finding a key, stops all threads
 static int global_found = 0;
+static uint64_t global_found_key = 0;
+// first EV1 candidate, only used when the regular search finds nothing
 static int global_found_candidate = 0;
 static uint64_t global_candidate_key = 0;
-static int thread_count = 2;
+static int thread_count = 0;
 
 static int param_getptr(const char *line, int *bg, int *en, int paramnum) {
     int i;
@@ -358,6 +363,26 @@ static bool checkCRC(uint32_t decrypted) {
     return CheckCrc14443(CRC_14443_A, data, sizeof(data));
 }
 
+// the first thread to report a key wins, returns false if another thread was first
+static bool set_found(uint64_t key) {
+    int expected = 0;
+    if (__atomic_compare_exchange_n(&global_found, &expected, 1, false, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE) == false)
+        return false;
+
+    global_found_key = key;
+    return true;
+}
+
+// keeps the first EV1 candidate without stopping the search, returns false if there already is one
+static bool set_candidate(uint64_t key) {
+    int expected = 0;
+    if (__atomic_compare_exchange_n(&global_found_candidate, &expected, 1, false, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE) == false)
+        return false;
+
+    global_candidate_key = key;
+    return true;
+}
+
 static void *brute_thread(void *arguments) {
 
     //int shift = (int)arg;
@@ -371,36 +396,44 @@ static void *brute_thread(void *arguments) {
     uint32_t nt;      // current tag nonce
 
     uint32_t p64 = 0;
-    uint32_t count;
-    // TC == 4  (
-    // threads calls 0 ev1 == false
-    // threads calls 0,1,2  ev1 == true
-    for (count = args->idx; count <= 0xFFFF; count += thread_count - 1) {
+    uint32_t chunk;
 
-        if (__atomic_load_n(&global_found, __ATOMIC_ACQUIRE) == 1) {
-            break;
-        }
+    // recovery tables are reused for all nonces of this thread
+    struct Crypto1Recovery *recovery = lfsr_recovery_create(1);
 
-        nt = count << 16 | prng_successor(count, 16);
+    while ((chunk = __atomic_fetch_add(&global_next_chunk, 1, __ATOMIC_RELAXED)) < NONCE_CHUNKS) {
 
-        if (candidate_nonce(args->xored, nt, args->ev1) == false)
-            continue;
+        bool ev1 = (chunk >= NONCE_CHUNKS / 2);
+        uint32_t first = (chunk % (NONCE_CHUNKS / 2)) * NONCE_CHUNK_SIZE;
+
+        for (uint32_t count = first; count < first + NONCE_CHUNK_SIZE; count++) {
+
+            if (__atomic_load_n(&global_found, __ATOMIC_ACQUIRE) == 1) {
+                goto out;
+            }
+
+            nt = count << 16 | prng_successor(count, 16);
 
-        p64 = prng_successor(nt, 64);
-        ks2 = ar_enc ^ p64;
-        ks3 = at_enc ^ prng_successor(p64, 32);
-        revstate = lfsr_recovery64(ks2, ks3);
-        ks4 = crypto1_word(revstate, 0, 0);
+            if (candidate_nonce(args->xored, nt, ev1) == false)
+                continue;
 
-        if (ks4 != 0) {
+            // the EV1 checks are a subset of the regular ones, don't try a nonce twice
+            if (ev1 && candidate_nonce(args->xored, nt, false))
+                continue;
 
-            // lock this section to avoid interlacing prints from different threats
-            pthread_mutex_lock(&print_lock);
-            if (args->ev1)
-                printf("\n**** Possible key candidate ****\n");
+            p64 = prng_successor(nt, 64);
+            ks2 = ar_enc ^ p64;
+            ks3 = at_enc ^ prng_successor(p64, 32);
+            revstate = (recovery) ? lfsr_recovery64_ex(recovery, ks2, ks3) : lfsr_recovery64(ks2, ks3);
+            ks4 = crypto1_word(revstate, 0, 0);
+
+            if (ks4 == 0) {
+                free(revstate);
+                continue;
+            }
 
 #if 0
-            printf("thread #%d idx %d %s\n", args->thread, args->idx, (args->ev1) ? "(Ev1)" : "");
+            printf("thread #%d chunk %u %s\n", args->thread, chunk, (ev1) ? "(Ev1)" : "");
             printf("current nt(%08x)  ar_enc(%08x)  at_enc(%08x)\n", nt, ar_enc, at_enc);
             printf("ks2:%08x\n", ks2);
             printf("ks3:%08x\n", ks3);
@@ -408,27 +441,19 @@ static void *brute_thread(void *arguments) {
 #endif
             if (cmd_enc) {
                 uint32_t decrypted = ks4 ^ cmd_enc;
-                printf("CMD enc( %08x )\n", cmd_enc);
-                printf("    dec( %08x )    ", decrypted);
-
-                // check if cmd exists
-                uint8_t isOK = checkValidCmd(decrypted);
-                if (isOK == false) {
-                    printf(_RED_("<-- not a valid cmd\n"));
-                    pthread_mutex_unlock(&print_lock);
-                    free(revstate);
-                    continue;
-                }
 
-                // Add a crc-check.
-                isOK = checkCRC(decrypted);
-                if (isOK == false) {
-                    printf(_RED_("<-- not a valid crc\n"));
-                    pthread_mutex_unlock(&print_lock);
+                // check if cmd exists, then add a crc-check.
+                bool valid_cmd = checkValidCmd(decrypted);
+                bool valid_crc = valid_cmd && checkCRC(decrypted);
+
+                // one printf per candidate, so lines of different threads don't interlace
+                printf("CMD enc( %08x )\n    dec( %08x )    %s", cmd_enc, decrypted,
+                       (valid_cmd == false) ? _RED_("<-- not a valid cmd\n") :
+                       (valid_crc == false) ? _RED_("<-- not a valid crc\n") : "<-- valid cmd\n");
+
+                if (valid_crc == false) {
                     free(revstate);
                     continue;
-                } else {
-                    printf("<-- valid cmd\n");
                 }
             }
 
@@ -438,71 +463,112 @@ static void *brute_thread(void *arguments) {
             lfsr_rollback_word(revstate, nr_enc, 1);
             lfsr_rollback_word(revstate, uid ^ nt, 0);
             crypto1_get_lfsr(revstate, &key);
+            free(revstate);
 
-            if (args->ev1) {
-                // if it was EV1,  we know for sure xxxAAAAAAAA recovery
-                printf("\nKey candidate [ " _YELLOW_("....%08" PRIx64)" ]\n\n", key & 0xFFFFFFFF);
-                __sync_fetch_and_add(&global_found_candidate, 1);
-            } else {
-                printf("\nKey candidate [ " _GREEN_("....%08" PRIx64) " ]\n\n", key & 0xFFFFFFFF);
-                __sync_fetch_and_add(&global_found, 1);
+            if (ev1) {
+                // an EV1 candidate may be a false positive, keep searching for a regular hit
+                if (set_candidate(key)) {
+                    // if it was EV1,  we know for sure xxxAAAAAAAA recovery
+                    printf("\n**** Possible key candidate ****\n\nKey candidate [ " _YELLOW_("....%08" PRIx64)" ]\n\n", key & 0xFFFFFFFF);
+                }
+                continue;
             }
-            //release lock
-            pthread_mutex_unlock(&print_lock);
-            __sync_fetch_and_add(&global_candidate_key, key);
-            free(revstate);
-            break;
+
+            if (set_found(key) == false)
+                goto out;
+
+            printf("\nKey candidate [ " _GREEN_("....%08" PRIx64) " ]\n\n", key & 0xFFFFFFFF);
+            goto out;
         }
-        free(revstate);
     }
+out:
+    lfsr_recovery_destroy(recovery);
     free(args);
     return NULL;
 }
 
+static bool checkValidCmdFirstByte(uint8_t cmd) {
+    for (int i = 0; i < 8; ++i) {
+        if (cmd == cmds[i][0])
+            return true;
+    }
+    return false;
+}
+
+// full scalar check of a key whose first decrypted byte looked like a command
+static bool check_key(struct thread_key_args *args, const uint8_t *local_enc, uint64_t key) {
+
+    // Init cipher with key
+    struct Crypto1State *pcs = crypto1_create(key);
+
+    // NESTED decrypt nt with help of new key
+    crypto1_word(pcs, args->nt_enc ^ args->uid, 1);
+    crypto1_word(pcs, args->nr_enc, 1);
+    crypto1_word(pcs, 0, 0);
+    crypto1_word(pcs, 0, 0);
+
+    // decrypt 22 bytes
+    uint8_t dec[args->enc_len];
+    for (int i = 0; i < args->enc_len; i++)
+        dec[i] = crypto1_byte(pcs, 0x00, 0) ^ local_enc[i];
+
+    crypto1_destroy(pcs);
+
+    // check if cmd exists
+    if (checkValidCmdByte(dec, args->enc_len) == false) {
+        return false;
+    }
+
+    // another thread already reported its key
+    if (set_found(key) == false) {
+        return true;
+    }
+
+    // sprint_hex_inrow_ex uses a static buffer
+    printf("\nenc:  %s\n", sprint_hex_inrow_ex(local_enc, args->enc_len, 0));
+    printf("dec:  %s\n", sprint_hex_inrow_ex(dec, args->enc_len, 0));
+    printf("\nValid Key found [ " _GREEN_("%012" PRIx64) " ]\n\n", key);
+    return true;
+}
+
 static void *brute_key_thread(void *arguments) {
 
     struct thread_key_args *args = (struct thread_key_args *) arguments;
-    uint64_t key;
     uint8_t local_enc[args->enc_len];
     memcpy(local_enc, args->enc, args->enc_len);
 
-    for (uint64_t count = args->idx; count <= 0xFFFF; count += thread_count) {
+    uint64_t keys[CRYPTO1_BS_WIDTH];
+    uint8_t ks[CRYPTO1_BS_WIDTH];
+    struct Crypto1BsState bs;
+
+    uint32_t chunk;
+    while ((chunk = __atomic_fetch_add(&global_next_chunk, 1, __ATOMIC_RELAXED)) < KEY_CHUNKS) {
 
         if (__atomic_load_n(&global_found, __ATOMIC_ACQUIRE) == 1) {
             break;
         }
 
-        key = args->part_key | (count << 32);
-
-        // Init cipher with key
-        struct Crypto1State *pcs = crypto1_create(key);
-
-        // NESTED decrypt nt with help of new key
-        crypto1_word(pcs, args->nt_enc ^ args->uid, 1);
-        crypto1_word(pcs, args->nr_enc, 1);
-        crypto1_word(pcs, 0, 0);
-        crypto1_word(pcs, 0, 0);
-
-        // decrypt 22 bytes
-        uint8_t dec[args->enc_len];
-        for (int i = 0; i < args->enc_len; i++)
-            dec[i] = crypto1_byte(pcs, 0x00, 0) ^ local_enc[i];
-
-        crypto1_destroy(pcs);
-
-        // check if cmd exists
-        if (checkValidCmdByte(dec, args->enc_len) == false) {
-            continue;
+        size_t n = 0;
+        for (uint64_t count = (uint64_t)chunk * CRYPTO1_BS_WIDTH; n < CRYPTO1_BS_WIDTH; count++)
+            keys[n++] = args->part_key | (count << 32);
+
+        // run the whole batch up to the first decrypted byte, bitsliced
+        crypto1_bs_init(&bs, keys, n);
+        crypto1_bs_word(&bs, args->nt_enc ^ args->uid, 1, NULL);
+        crypto1_bs_word(&bs, args->nr_enc, 1, NULL);
+        crypto1_bs_word(&bs, 0, 0, NULL);
+        crypto1_bs_word(&bs, 0, 0, NULL);
+        crypto1_bs_byte(&bs, 0x00, 0, ks);
+
+        for (size_t i = 0; i < n; i++) {
+            if (checkValidCmdFirstByte(ks[i] ^ local_enc[0]) == false) {
+                continue;
+            }
+            if (check_key(args, local_enc, keys[i])) {
+                free(args);
+                return NULL;
+            }
         }
-        __sync_fetch_and_add(&global_found, 1);
-
-        // lock this section to avoid interlacing prints from different threats
-        pthread_mutex_lock(&print_lock);
-        printf("\nenc:  %s\n", sprint_hex_inrow_ex(local_enc, args->enc_len, 0));
-        printf("dec:  %s\n", sprint_hex_inrow_ex(dec, args->enc_len, 0));
-        printf("\nValid Key found [ " _GREEN_("%012" PRIx64) " ]\n\n", key);
-        pthread_mutex_unlock(&print_lock);
-        break;
     }
     free(args);
     return NULL;
@@ -510,7 +576,13 @@ static void *brute_key_thread(void *arguments) {
 
 static int usage(void) {
     printf("\n");
-    printf("syntax:  mf_nonce_brute <uid> <nt> <nt_par_err> <nr> <ar> <ar_par_err> <at> <at_par_err> [<next_command>]\n\n");
+    printf("syntax:  mf_nonce_brute [--threads <n>] <uid> <nt> <nt_par_err> <nr> <ar> <ar_par_err> <at> <at_par_err> [<next_command>]\n\n");
+    printf("    --threads <n>  number of threads, default is one per cpu\n\n");
+    printf("the last line of output is the result for scripts, one of:\n");
+    printf("    RESULT key <12 hex digits>             full key\n");
+    printf("    RESULT partial <8 hex digits>          lower 32 bits of the key\n");
+    printf("    RESULT candidate <8 hex digits>        lower 32 bits of the key, EV1 nonce\n");
+    printf("    RESULT none\n\n");
     printf("how to convert trace data to needed input:\n");
     printf("    nt in trace = 8c! 42 e6! 4e!\n");
     printf("             nt = 8c42e64e\n");
@@ -534,6 +606,19 @@ static int usage(void) {
 int main(int argc, char *argv[]) {
     printf("\nMifare classic nested auth key recovery\n\n");
 
+    // --threads <n> may be given anywhere, remove it from the positional arguments
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--threads") != 0)
+            continue;
+
+        if (i + 1 >= argc || (thread_count = atoi(argv[i + 1])) < 1)
+            return usage();
+
+        memmove(&argv[i], &argv[i + 2], (argc - i - 1) * sizeof(char *));
+        argc -= 2;
+        i--;
+    }
+
     if (argc < 9) return usage();
 
     sscanf(argv[1], "%x", &uid);
@@ -575,36 +660,27 @@ int main(int argc, char *argv[]) {
     //calc (parity XOR corresponding nonce bit encoded with the same keystream bit)
     uint16_t xored = xored_bits(nt_par, nt_enc, ar_par, ar_enc, at_par, at_enc);
 
+    if (thread_count == 0) {
+        thread_count = 1;
 #if !defined(_WIN32) || !defined(__WIN32__)
-    thread_count = sysconf(_SC_NPROCESSORS_CONF);
-    if (thread_count < 2)
-        thread_count = 2;
+        thread_count = sysconf(_SC_NPROCESSORS_CONF);
+        if (thread_count < 1)
+            thread_count = 1;
 #endif  /* _WIN32 */
+    }
 
     printf("\nBruteforce using " _YELLOW_("%d") " threads\n", thread_count);
     printf("looking for the last bytes of the encrypted tagnonce\n");
 
     pthread_t threads[thread_count];
 
-    // create a mutex to avoid interlacing print commands from our different threads
-    pthread_mutex_init(&print_lock, NULL);
-
-    // one thread T0 for none EV1.
-    struct thread_args *a = calloc(1, sizeof(struct thread_args));
-    a->xored = xored;
-    a->thread = 0;
-    a->idx = 0;
-    a->ev1 = false;
-    pthread_create(&threads[0], NULL, brute_thread, (void *)a);
-
-    // the rest of available threads to EV1 scenario
-    for (int i = 0; i < thread_count - 1; ++i) {
-        struct thread_args *b = calloc(1, sizeof(struct thread_args));
-        b->xored = xored;
-        b->thread = i + 1;
-        b->idx = i;
-        b->ev1 = true;
-        pthread_create(&threads[i + 1], NULL, brute_thread, (void *)b);
+    // all threads search both the regular and the EV1 nonces
+    global_next_chunk = 0;
+    for (int i = 0; i < thread_count; ++i) {
+        struct thread_args *a = calloc(1, sizeof(struct thread_args));
+        a->xored = xored;
+        a->thread = i;
+        pthread_create(&threads[i], NULL, brute_thread, (void *)a);
     }
 
     // wait for threads to terminate:
@@ -614,15 +690,20 @@ int main(int argc, char *argv[]) {
     t1 = msclock() - t1;
     printf("execution time " _YELLOW_("%.2f") " sec\n", (float)t1 / 1000.0);
 
-
     if (!global_found && !global_found_candidate) {
         printf("\nFailed to find a key\n\n");
-        goto out;
+        printf("RESULT none\n");
+        return 0;
     }
 
+    // a regular hit beats any EV1 candidate
+    uint32_t part_key = (uint32_t)(((global_found) ? global_found_key : global_candidate_key) & 0xFFFFFFFF);
+    const char *part_result = (global_found) ? "partial" : "candidate";
+
     if (enc_len < 4) {
         printf("Too few next cmd bytes, skipping phase 2\n");
-        goto out;
+        printf("RESULT %s %08x\n", part_result, part_key);
+        return 0;
     }
 
     // reset thread signals
@@ -631,7 +712,7 @@ int main(int argc, char *argv[]) {
 
     printf("\n----------- " _CYAN_("Phase 2") " ------------------------\n");
     printf("uid.................. %08x\n", uid);
-    printf("partial key.......... %08x\n", (uint32_t)(global_candidate_key & 0xFFFFFFFF));
+    printf("partial key.......... %08x\n", part_key);
     printf("nt enc............... %08x\n", nt_enc);
     printf("nr enc............... %08x\n", nr_enc);
     printf("next encrypted cmd... %s\n", sprint_hex_inrow_ex(enc, enc_len, 0));
@@ -639,12 +720,12 @@ int main(int argc, char *argv[]) {
     fflush(stdout);
 
     // threads
+    global_next_chunk = 0;
     for (int i = 0; i < thread_count; ++i) {
         struct thread_key_args *b = calloc(1, sizeof(struct thread_key_args));
         b->thread = i;
-        b->idx = i;
         b->uid = uid;
-        b->part_key = (uint32_t)(global_candidate_key & 0xFFFFFFFF);
+        b->part_key = part_key;
         b->nt_enc = nt_enc;
         b->nr_enc = nr_enc;
         b->enc_len = enc_len;
@@ -656,12 +737,12 @@ int main(int argc, char *argv[]) {
     for (int i = 0; i < thread_count; ++i)
         pthread_join(threads[i], NULL);
 
-    if (!global_found && !global_found_candidate) {
+    if (!global_found) {
         printf("\nfailed to find a key\n\n");
+        printf("RESULT %s %08x\n", part_result, part_key);
+        return 0;
     }
 
-out:
-    // clean up mutex
-    pthread_mutex_destroy(&print_lock);
+    printf("RESULT key %012" PRIx64 "\n", global_found_key);
     return 0;
 }
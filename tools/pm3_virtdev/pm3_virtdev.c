@@ -0,0 +1,535 @@
+//-----------------------------------------------------------------------------
+// Copyright (C) Proxmark3 contributors. See AUTHORS.md for details.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// See LICENSE.txt for the text of the license.
+//-----------------------------------------------------------------------------
+// Virtual Proxmark3 device on a pseudo terminal.
+// Speaks the NG frame protocol like armsrc/cmd.c and answers the commands
+// needed to benchmark the client side of the link without hardware:
+// ping, capabilities, version, BigBuf and emulator memory download.
+//-----------------------------------------------------------------------------
+#define _XOPEN_SOURCE 600
+#define _DEFAULT_SOURCE
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <termios.h>
+#include <signal.h>
+#include <time.h>
+#include <getopt.h>
+
+#include "common.h"
+#include "pm3_cmd.h"
+#include "crc16.h"
+
+#define DEFAULT_BIGBUF_SIZE  40000
+#define DEFAULT_EML_SIZE     4096
+// device->client writes are split in pieces of this size when emulating a baudrate
+#define THROTTLE_CHUNK       64
+
+static int fd = -1;
+static uint32_t baudrate = 0;      // 0 = USB-CDC, no throttling
+static bool verbose = false;
+static uint64_t link_busy_until;   // emulated link clock, in us
+
+static uint8_t *bigbuf;
+static uint32_t bigbuf_size = DEFAULT_BIGBUF_SIZE;
+static uint32_t tracelen = 0;
+static uint8_t *emlbuf;
+static uint32_t eml_size = DEFAULT_EML_SIZE;
+
+static const char *link_path = NULL;
+
+static uint64_t usclock(void) {
+    struct timespec t;
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return ((uint64_t)t.tv_sec * 1000000) + (t.tv_nsec / 1000);
+}
+
+static void usleep_until(uint64_t t) {
+    uint64_t now = usclock();
+    if (t <= now)
+        return;
+
+    struct timespec ts = { .tv_sec = (t - now) / 1000000, .tv_nsec = ((t - now) % 1000000) * 1000 };
+    while (nanosleep(&ts, &ts) == -1 && errno == EINTR) {};
+}
+
+// account n bytes on the emulated link, 8N1 framing
+static void link_transfer(size_t n) {
+    if (baudrate == 0)
+        return;
+
+    uint64_t now = usclock();
+    if (link_busy_until < now)
+        link_busy_until = now;
+    link_busy_until += ((uint64_t)n * 10 * 1000000) / baudrate;
+    usleep_until(link_busy_until);
+}
+
+static bool read_exact(uint8_t *dst, size_t len) {
+    while (len) {
+        ssize_t r = read(fd, dst, len);
+        if (r < 0 && errno == EINTR)
+            continue;
+        if (r <= 0)
+            return false;
+        dst += r;
+        len -= r;
+    }
+    return true;
+}
+
+static bool write_exact(const uint8_t *src, size_t len) {
+    while (len) {
+        size_t n = (baudrate) ? MIN(len, THROTTLE_CHUNK) : len;
+        ssize_t w = write(fd, src, n);
+        if (w < 0 && errno == EINTR)
+            continue;
+        if (w <= 0)
+            return false;
+        link_transfer(w);
+        src += w;
+        len -= w;
+    }
+    return true;
+}
+
+static int reply_ng_internal(uint16_t cmd, int16_t status, const uint8_t *data, size_t len, bool ng) {
+    PacketResponseNGRaw tx;
+    memset(&tx, 0, sizeof(tx));
+
+    tx.pre.magic = RESPONSENG_PREAMBLE_MAGIC;
+    tx.pre.cmd = cmd;
+    tx.pre.status = status;
+    tx.pre.ng = ng;
+    if (len > PM3_CMD_DATA_SIZE) {
+        len = PM3_CMD_DATA_SIZE;
+        tx.pre.status = PM3_EOVFLOW;
+    }
+    tx.pre.length = (len & 0x7FFF);
+
+    if (data && len)
+        memcpy(tx.data, data, len);
+
+    // like the device,  replies over FPC carry a CRC, over USB the magic placeholder
+    PacketResponseNGPostamble *tx_post = (PacketResponseNGPostamble *)((uint8_t *)&tx + sizeof(PacketResponseNGPreamble) + len);
+    if (baudrate) {
+        uint8_t first, second;
+        compute_crc(CRC_14443_A, (uint8_t *)&tx, sizeof(PacketResponseNGPreamble) + len, &first, &second);
+        tx_post->crc = ((first << 8) | second);
+    } else {
+        tx_post->crc = RESPONSENG_POSTAMBLE_MAGIC;
+    }
+
+    size_t txlen = sizeof(PacketResponseNGPreamble) + len + sizeof(PacketResponseNGPostamble);
+    return write_exact((uint8_t *)&tx, txlen) ? PM3_SUCCESS : PM3_EIO;
+}
+
+static int reply_ng(uint16_t cmd, int16_t status, const uint8_t *data, size_t len) {
+    return reply_ng_internal(cmd, status, data, len, true);
+}
+
+static int reply_mix(uint64_t cmd, uint64_t arg0, uint64_t arg1, uint64_t arg2, const void *data, size_t len) {
+    int16_t status = PM3_SUCCESS;
+    uint64_t arg[3] = {arg0, arg1, arg2};
+    if (len > PM3_CMD_DATA_SIZE - sizeof(arg)) {
+        len = PM3_CMD_DATA_SIZE - sizeof(arg);
+        status = PM3_EOVFLOW;
+    }
+    uint8_t cmddata[PM3_CMD_DATA_SIZE];
+    memcpy(cmddata, arg, sizeof(arg));
+    if (len && data)
+        memcpy(cmddata + sizeof(arg), data, len);
+
+    return reply_ng_internal((cmd & 0xFFFF), status, cmddata, len + sizeof(arg), false);
+}
+
+// same as receive_ng_internal() in armsrc/cmd.c
+static int receive_ng(PacketCommandNG *rx) {
+    PacketCommandNGRaw rx_raw;
+
+    if (read_exact((uint8_t *)&rx_raw.pre, sizeof(PacketCommandNGPreamble)) == false)
+        return PM3_ENODATA;
+
+    rx->magic = rx_raw.pre.magic;
+    rx->ng = rx_raw.pre.ng;
+    uint16_t length = rx_raw.pre.length;
+    rx->cmd = rx_raw.pre.cmd;
+
+    if (rx->magic == COMMANDNG_PREAMBLE_MAGIC) {
+        if (length > PM3_CMD_DATA_SIZE)
+            return PM3_EOVFLOW;
+
+        if (read_exact(rx_raw.data, length) == false)
+            return PM3_EIO;
+
+        if (rx->ng) {
+            memcpy(rx->data.asBytes, rx_raw.data, length);
+            rx->length = length;
+        } else {
+            uint64_t arg[3];
+            if (length < sizeof(arg))
+                return PM3_EIO;
+
+            memcpy(arg, rx_raw.data, sizeof(arg));
+            rx->oldarg[0] = arg[0];
+            rx->oldarg[1] = arg[1];
+            rx->oldarg[2] = arg[2];
+            memcpy(rx->data.asBytes, rx_raw.data + sizeof(arg), length - sizeof(arg));
+            rx->length = length - sizeof(arg);
+        }
+
+        if (read_exact((uint8_t *)&rx_raw.foopost, sizeof(PacketCommandNGPostamble)) == false)
+            return PM3_EIO;
+
+        // Check CRC, accept MAGIC as placeholder
+        rx->crc = rx_raw.foopost.crc;
+        if (rx->crc != COMMANDNG_POSTAMBLE_MAGIC) {
+            uint8_t first, second;
+            compute_crc(CRC_14443_A, (uint8_t *)&rx_raw, sizeof(PacketCommandNGPreamble) + length, &first, &second);
+            if ((first << 8) + second != rx->crc)
+                return PM3_EIO;
+        }
+        link_transfer(sizeof(PacketCommandNGPreamble) + length + sizeof(PacketCommandNGPostamble));
+    } else {
+        PacketCommandOLD rx_old;
+        memcpy(&rx_old, &rx_raw.pre, sizeof(PacketCommandNGPreamble));
+        if (read_exact(((uint8_t *)&rx_old) + sizeof(PacketCommandNGPreamble), sizeof(PacketCommandOLD) - sizeof(PacketCommandNGPreamble)) == false)
+            return PM3_EIO;
+
+        rx->ng = false;
+        rx->magic = 0;
+        rx->crc = 0;
+        rx->cmd = (rx_old.cmd & 0xFFFF);
+        rx->oldarg[0] = rx_old.arg[0];
+        rx->oldarg[1] = rx_old.arg[1];
+        rx->oldarg[2] = rx_old.arg[2];
+        rx->length = PM3_CMD_DATA_SIZE;
+        memcpy(&rx->data, &rx_old.d.asBytes, rx->length);
+        link_transfer(sizeof(PacketCommandOLD));
+    }
+    return PM3_SUCCESS;
+}
+
+static void send_capabilities(void) {
+    capabilities_t caps;
+    memset(&caps, 0, sizeof(caps));
+    caps.version = CAPABILITIES_VERSION;
+    caps.via_fpc = (baudrate != 0);
+    caps.via_usb = (baudrate == 0);
+    caps.baudrate = (baudrate) ? baudrate : 115200;
+    caps.bigbuf_size = bigbuf_size;
+    caps.compiled_with_lf = true;
+    caps.compiled_with_hfsniff = true;
+    caps.compiled_with_iso14443a = true;
+    caps.compiled_with_iso14443b = true;
+    caps.compiled_with_iso15693 = true;
+    caps.compiled_with_iclass = true;
+    reply_ng(CMD_CAPABILITIES, PM3_SUCCESS, (uint8_t *)&caps, sizeof(caps));
+}
+
+static void send_version(void) {
+    struct p {
+        uint32_t id;
+        uint32_t section_size;
+        uint32_t versionstr_len;
+        char versionstr[PM3_CMD_DATA_SIZE - 12];
+    } PACKED payload;
+    memset(&payload, 0, sizeof(payload));
+
+    payload.versionstr_len = snprintf(payload.versionstr, sizeof(payload.versionstr),
+                                      " [ ARM ]\n  bootrom: virtual device\n       os: virtual device\n") + 1;
+    reply_ng(CMD_VERSION, PM3_SUCCESS, (uint8_t *)&payload, 12 + payload.versionstr_len);
+}
+
+// same framing as CMD_DOWNLOAD_BIGBUF / CMD_DOWNLOAD_EML_BIGBUF in armsrc/appmain.c
+static void send_memory(uint16_t rec_cmd, const uint8_t *mem, uint32_t memsize, uint32_t startidx, uint32_t numofbytes, uint32_t arg2, const void *ackdata, size_t acklen) {
+
+    if (startidx > memsize)
+        startidx = memsize;
+    if (numofbytes > memsize - startidx)
+        numofbytes = memsize - startidx;
+
+    for (size_t i = 0; i < numofbytes; i += PM3_CMD_DATA_SIZE) {
+        size_t len = MIN((numofbytes - i), PM3_CMD_DATA_SIZE);
+        // OLD frame, like reply_old() on the device
+        PacketResponseOLD txcmd;
+        memset(&txcmd, 0, sizeof(txcmd));
+        txcmd.cmd = rec_cmd;
+        txcmd.arg[0] = i;
+        txcmd.arg[1] = len;
+        txcmd.arg[2] = arg2;
+        memcpy(txcmd.d.asBytes, mem + startidx + i, len);
+        if (write_exact((uint8_t *)&txcmd, sizeof(txcmd)) == false)
+            return;
+    }
+    reply_mix(CMD_ACK, 1, 0, arg2, ackdata, acklen);
+}
+
+static void handle(PacketCommandNG *packet) {
+
+    if (verbose)
+        fprintf(stderr, "cmd 0x%04x %s len %u\n", packet->cmd, packet->ng ? "NG" : "MIX", packet->length);
+
+    switch (packet->cmd) {
+        case CMD_PING: {
+            reply_ng(CMD_PING, PM3_SUCCESS, packet->data.asBytes, packet->length);
+            break;
+        }
+        case CMD_CAPABILITIES: {
+            send_capabilities();
+            break;
+        }
+        case CMD_VERSION: {
+            send_version();
+            break;
+        }
+        case CMD_QUIT_SESSION: {
+            break;
+        }
+        case CMD_BUFF_CLEAR: {
+            memset(bigbuf, 0, bigbuf_size);
+            tracelen = 0;
+            break;
+        }
+        case CMD_DOWNLOAD_BIGBUF: {
+            sample_config sc = {
+                .decimation = 1,
+                .bits_per_sample = 8,
+                .averaging = 1,
+                .divisor = LF_DIVISOR_125,
+                .trigger_threshold = 0,
+                .samples_to_skip = 0,
+                .verbose = false,
+            };
+            send_memory(CMD_DOWNLOADED_BIGBUF, bigbuf, bigbuf_size, packet->oldarg[0], packet->oldarg[1], tracelen, &sc, sizeof(sc));
+            break;
+        }
+        case CMD_FLASHMEM_INFO: {
+            // no flash memory
+            reply_mix(CMD_ACK, 0, 0, 0, NULL, 0);
+            break;
+        }
+        case CMD_DOWNLOAD_EML_BIGBUF: {
+            send_memory(CMD_DOWNLOADED_EML_BIGBUF, emlbuf, eml_size, packet->oldarg[0], packet->oldarg[1], 0, NULL, 0);
+            break;
+        }
+        default: {
+            if (verbose)
+                fprintf(stderr, "  not implemented\n");
+            if (packet->ng)
+                reply_ng(packet->cmd, PM3_ENOTIMPL, NULL, 0);
+            else
+                reply_mix(CMD_ACK, 0, 0, 0, NULL, 0);
+            break;
+        }
+    }
+}
+
+// .pm3 files hold one graph value per line, the device buffer holds value + 127
+static int load_file(const char *fn, uint8_t *dest, uint32_t maxlen, uint32_t *loaded) {
+    FILE *f = fopen(fn, "rb");
+    if (f == NULL) {
+        fprintf(stderr, "can't open %s: %s\n", fn, strerror(errno));
+        return PM3_EFILE;
+    }
+
+    uint32_t n = 0;
+    const char *ext = strrchr(fn, '.');
+    if (ext && strcmp(ext, ".pm3") == 0) {
+        int v;
+        while (n < maxlen && fscanf(f, "%d", &v) == 1) {
+            dest[n++] = (uint8_t)MAX(0, MIN(255, v + 127));
+        }
+    } else {
+        n = fread(dest, 1, maxlen, f);
+    }
+
+    int dummy;
+    if (ext && strcmp(ext, ".pm3") == 0) {
+        if (fscanf(f, "%d", &dummy) == 1)
+            fprintf(stderr, "%s is larger than the device memory, truncated to %u samples\n", fn, n);
+    } else if (fgetc(f) != EOF) {
+        fprintf(stderr, "%s is larger than the device memory, truncated to %u bytes\n", fn, n);
+    }
+
+    fclose(f);
+    *loaded = n;
+    return PM3_SUCCESS;
+}
+
+static void cleanup(void) {
+    if (link_path)
+        unlink(link_path);
+}
+
+static void sighandler(int sig) {
+    (void) sig;
+    cleanup();
+    _exit(0);
+}
+
+static void usage(const char *name) {
+    printf("Virtual Proxmark3 device on a pseudo terminal\n\n");
+    printf("Usage: %s [options]\n", name);
+    printf("  -b, --baud <n>      emulate a FPC/BT link at <n> baud (default: USB-CDC, unthrottled)\n");
+    printf("  -m, --bigbuf <n>    BigBuf size in bytes (default: %u)\n", DEFAULT_BIGBUF_SIZE);
+    printf("  -s, --samples <fn>  preload BigBuf with samples, raw bytes or a .pm3 file\n");
+    printf("  -t, --trace <fn>    preload BigBuf with a .trace file, sets the tracelog length\n");
+    printf("  -e, --eml <fn>      preload emulator memory with a binary dump\n");
+    printf("  -l, --link <path>   create a symlink to the pty,  removed on exit\n");
+    printf("  -v, --verbose       log every command to stderr\n");
+    printf("\nThen connect with:  proxmark3 <pty or link>\n");
+}
+
+int main(int argc, char *argv[]) {
+
+    const char *samples_fn = NULL;
+    const char *trace_fn = NULL;
+    const char *eml_fn = NULL;
+
+    static const struct option long_opts[] = {
+        {"baud",    required_argument, NULL, 'b'},
+        {"bigbuf",  required_argument, NULL, 'm'},
+        {"samples", required_argument, NULL, 's'},
+        {"trace",   required_argument, NULL, 't'},
+        {"eml",     required_argument, NULL, 'e'},
+        {"link",    required_argument, NULL, 'l'},
+        {"verbose", no_argument,       NULL, 'v'},
+        {"help",    no_argument,       NULL, 'h'},
+        {NULL, 0, NULL, 0}
+    };
+
+    int c;
+    while ((c = getopt_long(argc, argv, "b:m:s:t:e:l:vh", long_opts, NULL)) != -1) {
+        switch (c) {
+            case 'b':
+                baudrate = strtoul(optarg, NULL, 0);
+                break;
+            case 'm':
+                bigbuf_size = strtoul(optarg, NULL, 0);
+                break;
+            case 's':
+                samples_fn = optarg;
+                break;
+            case 't':
+                trace_fn = optarg;
+                break;
+            case 'e':
+                eml_fn = optarg;
+                break;
+            case 'l':
+                link_path = optarg;
+                break;
+            case 'v':
+                verbose = true;
+                break;
+            default:
+                usage(argv[0]);
+                return (c == 'h') ? 0 : 1;
+        }
+    }
+
+    if (samples_fn && trace_fn) {
+        fprintf(stderr, "samples and trace both live at the start of BigBuf, use only one of them\n");
+        return 1;
+    }
+
+    bigbuf = calloc(bigbuf_size, sizeof(uint8_t));
+    emlbuf = calloc(eml_size, sizeof(uint8_t));
+    if (bigbuf == NULL || emlbuf == NULL) {
+        fprintf(stderr, "failed to allocate memory\n");
+        return 1;
+    }
+
+    uint32_t loaded = 0;
+    if (samples_fn && load_file(samples_fn, bigbuf, bigbuf_size, &loaded) != PM3_SUCCESS)
+        return 1;
+
+    if (trace_fn) {
+        if (load_file(trace_fn, bigbuf, bigbuf_size, &loaded) != PM3_SUCCESS)
+            return 1;
+        tracelen = loaded;
+    }
+
+    if (eml_fn && load_file(eml_fn, emlbuf, eml_size, &loaded) != PM3_SUCCESS)
+        return 1;
+
+    fd = posix_openpt(O_RDWR | O_NOCTTY);
+    if (fd < 0 || grantpt(fd) != 0 || unlockpt(fd) != 0) {
+        fprintf(stderr, "failed to create pty: %s\n", strerror(errno));
+        return 1;
+    }
+
+    const char *slave = ptsname(fd);
+
+    // keep the slave side open,  so the master doesn't see EIO between client sessions
+    int slave_fd = open(slave, O_RDWR | O_NOCTTY);
+    if (slave_fd < 0) {
+        fprintf(stderr, "failed to open %s: %s\n", slave, strerror(errno));
+        return 1;
+    }
+
+    struct termios tio;
+    tcgetattr(slave_fd, &tio);
+    cfmakeraw(&tio);
+    tcsetattr(slave_fd, TCSANOW, &tio);
+
+    if (link_path) {
+        unlink(link_path);
+        if (symlink(slave, link_path) != 0) {
+            fprintf(stderr, "failed to create link %s: %s\n", link_path, strerror(errno));
+            return 1;
+        }
+        atexit(cleanup);
+    }
+
+    signal(SIGINT, sighandler);
+    signal(SIGTERM, sighandler);
+
+    printf("Virtual Proxmark3 on %s%s%s\n", slave, link_path ? " -> " : "", link_path ? link_path : "");
+    if (baudrate)
+        printf("Emulating FPC link at %u baud\n", baudrate);
+    printf("BigBuf %u bytes, tracelen %u\n", bigbuf_size, tracelen);
+    fflush(stdout);
+
+    PacketCommandNG rx;
+    while (true) {
+        memset(&rx, 0, sizeof(rx));
+        int res = receive_ng(&rx);
+        if (res == PM3_ENODATA) {
+            fprintf(stderr, "pty closed\n");
+            break;
+        }
+        if (res != PM3_SUCCESS) {
+            if (verbose)
+                fprintf(stderr, "bad frame (%d), flushing\n", res);
+            tcflush(fd, TCIFLUSH);
+            continue;
+        }
+        handle(&rx);
+    }
+
+    close(slave_fd);
+    close(fd);
+    free(bigbuf);
+    free(emlbuf);
+    return 0;
+}
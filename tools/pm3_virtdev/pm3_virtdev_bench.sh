@@ -0,0 +1,102 @@
+#!/usr/bin/env bash
+#-----------------------------------------------------------------------------
+# Copyright (C) Proxmark3 contributors. See AUTHORS.md for details.
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation, either version 3 of the License, or
+# (at your option) any later version.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# See LICENSE.txt for the text of the license.
+#-----------------------------------------------------------------------------
+# Client protocol benchmark against pm3_virtdev
+#
+# Usage: pm3_virtdev_bench.sh [baud ...]     (0 = USB-CDC, unthrottled)
+#
+# Every measurement runs the client twice,  once with a single command and once
+# with the command repeated,  so connection setup and client start-up cancel out.
+#
+#   PM3BIN    client binary           (default: ../../client/proxmark3)
+#   ROUNDS    pings per measurement   (default: 50)
+#   DLROUNDS  BigBuf downloads        (default: 3)
+
+cd "$(dirname "$0")" || exit 1
+
+PM3BIN=${PM3BIN:-../../client/proxmark3}
+ROUNDS=${ROUNDS:-50}
+DLROUNDS=${DLROUNDS:-3}
+BIGBUF=40000
+LINK=$(mktemp -u /tmp/pm3_virtdev.XXXXXX)
+DEVPID=
+
+if [ ! -x "$PM3BIN" ]; then
+    echo "client not found at $PM3BIN,  set PM3BIN"
+    exit 1
+fi
+if [ ! -x ./pm3_virtdev ]; then
+    echo "pm3_virtdev not built,  run make first"
+    exit 1
+fi
+
+stop_dev() {
+    if [ -n "$DEVPID" ]; then
+        kill "$DEVPID" 2>/dev/null
+        wait "$DEVPID" 2>/dev/null
+        DEVPID=
+    fi
+}
+trap stop_dev EXIT
+
+now_ns() {
+    date +%s%N
+}
+
+# repeat <cmd> <n>   ->   "cmd;cmd;..."
+repeat() {
+    local s="$1"
+    for ((i = 1; i < $2; i++)); do
+        s="$s;$1"
+    done
+    echo "$s"
+}
+
+# elapsed ns of one client session running <cmds>
+run() {
+    local t0
+    t0=$(now_ns)
+    "$PM3BIN" "$LINK" -c "$1" > /dev/null 2>&1 < /dev/null
+    echo $(( $(now_ns) - t0 ))
+}
+
+[ $# -eq 0 ] && set -- 0 460800 115200
+
+printf "%-10s | %-14s | %-14s\n" "baud" "ping rtt (ms)" "download (MB/s)"
+printf -- "-----------+----------------+----------------\n"
+
+for baud in "$@"; do
+    ./pm3_virtdev -b "$baud" -m "$BIGBUF" -l "$LINK" > /dev/null 2>&1 &
+    DEVPID=$!
+    for ((w = 0; w < 50; w++)); do
+        [ -e "$LINK" ] && break
+        sleep 0.1
+    done
+
+    base=$(run "hw ping")
+    full=$(run "$(repeat "hw ping" $((ROUNDS + 1)))")
+    rtt=$(awk -v d=$((full - base)) -v n="$ROUNDS" 'BEGIN { printf "%.3f", d / n / 1e6 }')
+
+    base=$(run "d samples")
+    full=$(run "$(repeat "d samples" $((DLROUNDS + 1)))")
+    mbs=$(awk -v d=$((full - base)) -v n="$DLROUNDS" -v b=$((BIGBUF - 1)) 'BEGIN { printf "%.3f", (b * n) / (d / 1e9) / 1e6 }')
+
+    label=$baud
+    [ "$baud" = "0" ] && label="usb-cdc"
+    printf "%-10s | %14s | %14s\n" "$label" "$rtt" "$mbs"
+
+    stop_dev
+done